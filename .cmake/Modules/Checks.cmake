@@ -3,6 +3,7 @@ check_include_file (endian.h HAVE_ENDIAN_H)
 check_include_file (inttypes.h HAVE_INTTYPES_H)
 check_include_file (libkern/OSByteOrder.h HAVE_LIBKERN_OSBYTEORDER_H)
 check_include_file (memory.h HAVE_MEMORY_H)
+check_include_file (stdatomic.h HAVE_STDATOMIC_H)
 check_include_file (stdbool.h HAVE_STDBOOL_H)
 check_include_file (stdint.h HAVE_STDINT_H)
 check_include_file (stdlib.h HAVE_STDLIB_H)
@@ -0,0 +1,19 @@
+AC_DEFUN([PROG_CXX_CXX17],
+[AC_CACHE_CHECK([for the C++ option to accept ISO C++17],
+  [neo4j_cv_prog_cxx_cxx17], [
+  AC_LANG_PUSH([C++])
+  neo4j_save_flags=$CXXFLAGS
+  CXXFLAGS="$neo4j_save_flags -std=c++17"
+  AC_COMPILE_IFELSE([AC_LANG_PROGRAM([[
+#include <string_view>
+    ]],[[std::string_view s("x"); return (int)s.size() - 1;]])],
+    [neo4j_cv_prog_cxx_cxx17="-std=c++17"],
+    [neo4j_cv_prog_cxx_cxx17="none found"])
+  CXXFLAGS=$neo4j_save_flags
+  AC_LANG_POP([C++])])
+
+  AS_IF([test "X$neo4j_cv_prog_cxx_cxx17" != "Xnone found"],
+    [AC_SUBST([CXX17_FLAGS], [$neo4j_cv_prog_cxx_cxx17])])
+  AM_CONDITIONAL([HAVE_CXX17],
+    [test "X$neo4j_cv_prog_cxx_cxx17" != "Xnone found"])
+])
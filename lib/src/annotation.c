@@ -17,6 +17,7 @@
 #include "../../config.h"
 #include "annotation.h"
 #include "astnode.h"
+#include "atomics.h"
 #include "util.h"
 #include <assert.h>
 #include <stdlib.h>
@@ -38,6 +39,10 @@ static void detach_annotation_from_context(
         struct cypher_astnode_annotation *annotation);
 
 
+// annotations attached to any AST node, in any context
+static atomic_uint nannotations;
+
+
 cypher_ast_annotation_context_t *cypher_ast_annotation_context(void)
 {
     return calloc(1, sizeof(cypher_ast_annotation_context_t));
@@ -100,6 +105,7 @@ int cypher_astnode_attach_annotation(cypher_ast_annotation_context_t *context,
 
     attach_annotation_to_astnode(node, annotation_node);
     attach_annotation_to_context(context, annotation_node);
+    atomic_fetch_add_explicit(&nannotations, 1, memory_order_relaxed);
 
     if (previous_annotation != NULL)
     {
@@ -128,6 +134,7 @@ void *cypher_astnode_remove_annotation(cypher_ast_annotation_context_t *context,
 
     detach_annotation_from_astnode(annotation);
     detach_annotation_from_context(annotation);
+    atomic_fetch_sub_explicit(&nannotations, 1, memory_order_relaxed);
 
     void *data = annotation->data;
     free(annotation);
@@ -250,6 +257,7 @@ void cp_release_annotation(struct cypher_astnode_annotation *annotation)
 
     detach_annotation_from_astnode(annotation);
     detach_annotation_from_context(annotation);
+    atomic_fetch_sub_explicit(&nannotations, 1, memory_order_relaxed);
     if (context->release_cb != NULL)
     {
         context->release_cb(context->release_cb_userdata,
@@ -258,3 +266,9 @@ void cp_release_annotation(struct cypher_astnode_annotation *annotation)
 
     free(annotation);
 }
+
+
+unsigned int cp_nannotations(void)
+{
+    return atomic_load_explicit(&nannotations, memory_order_relaxed);
+}
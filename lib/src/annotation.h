@@ -44,5 +44,11 @@ struct cypher_ast_annotation_context
 
 void cp_release_annotation(struct cypher_astnode_annotation *annotation);
 
+/*
+ * The number of annotations attached to AST nodes, across all contexts. When
+ * this is zero, there is no need to walk an AST to release annotations.
+ */
+unsigned int cp_nannotations(void);
+
 
 #endif/*CYPHER_PARSER_ANNOTATION_H*/
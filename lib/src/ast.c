@@ -16,10 +16,15 @@
  */
 #include "../../config.h"
 #include "ast.h"
+#include "annotation.h"
 #include "astnode.h"
 #include "util.h"
 #include <assert.h>
 #include <math.h>
+#include <stddef.h>
+#ifdef HAVE_PTHREADS
+#include <pthread.h>
+#endif
 
 
 struct cypher_astnode_vts
@@ -244,6 +249,7 @@ static const struct cypher_astnode_vts cypher_astnode_vts =
     .rel_pattern = &cypher_rel_pattern_astnode_vt,
     .range = &cypher_range_astnode_vt,
     .command = &cypher_command_astnode_vt,
+    .comment = &cypher_comment_astnode_vt,
     .line_comment = &cypher_line_comment_astnode_vt,
     .block_comment = &cypher_block_comment_astnode_vt,
     .error = &cypher_error_astnode_vt,
@@ -392,6 +398,22 @@ static_assert(
     (sizeof(struct cypher_astnode_vts) / sizeof(struct cypher_astnode_vt *)) <= UINT8_MAX,
     "cannot have more than 2^8 AST node types");
 
+#define NTYPES \
+    (sizeof(struct cypher_astnode_vts) / sizeof(struct cypher_astnode_vt *))
+#define MAX_TYPE_ANCESTORS 8
+
+// the types each type is an instance of, other than itself
+static cypher_astnode_type_t type_ancestors[NTYPES][MAX_TYPE_ANCESTORS];
+static uint8_t ntype_ancestors[NTYPES];
+#ifdef HAVE_PTHREADS
+static pthread_once_t type_ancestors_once = PTHREAD_ONCE_INIT;
+#else
+static bool type_ancestors_initialized = false;
+#endif
+
+static void init_type_ancestors(void);
+static uint_fast32_t type_attributes(cypher_astnode_type_t type);
+
 
 cypher_astnode_type_t cypher_astnode_type(const cypher_astnode_t *node)
 {
@@ -418,6 +440,47 @@ static bool cypher_astnode_vt_instanceof(const struct cypher_astnode_vt *vt,
 }
 
 
+unsigned int cp_ast_ntypes(void)
+{
+    return NTYPES;
+}
+
+
+const cypher_astnode_type_t *cp_ast_type_ancestors(cypher_astnode_type_t type,
+        unsigned int *n)
+{
+    assert(type < NTYPES);
+#ifdef HAVE_PTHREADS
+    pthread_once(&type_ancestors_once, init_type_ancestors);
+#else
+    if (!type_ancestors_initialized)
+    {
+        init_type_ancestors();
+        type_ancestors_initialized = true;
+    }
+#endif
+    *n = ntype_ancestors[type];
+    return type_ancestors[type];
+}
+
+
+void init_type_ancestors(void)
+{
+    for (unsigned int i = 0; i < NTYPES; ++i)
+    {
+        for (unsigned int j = 0; j < NTYPES; ++j)
+        {
+            if (j == i || !cypher_astnode_vt_instanceof(VT_PTR(i), VT_PTR(j)))
+            {
+                continue;
+            }
+            assert(ntype_ancestors[i] < MAX_TYPE_ANCESTORS);
+            type_ancestors[i][(ntype_ancestors[i])++] = j;
+        }
+    }
+}
+
+
 bool cypher_astnode_instanceof(const cypher_astnode_t *node,
         cypher_astnode_type_t type)
 {
@@ -509,7 +572,24 @@ void cypher_ast_free(cypher_astnode_t *ast)
     vt->release(ast);
 
     cypher_ast_vfree(children, nchildren);
-    free(children);
+    cp_astnode_free(children);
+}
+
+
+void cp_ast_vrelease_annotations(cypher_astnode_t * const *ast, unsigned int n)
+{
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        if (ast[i] == NULL)
+        {
+            continue;
+        }
+        while (ast[i]->annotations != NULL)
+        {
+            cp_release_annotation(ast[i]->annotations);
+        }
+        cp_ast_vrelease_annotations(ast[i]->children, ast[i]->nchildren);
+    }
 }
 
 
@@ -531,7 +611,7 @@ void cypher_astnode_free(cypher_astnode_t *ast)
     const struct cypher_astnode_vt *vt = VT_PTR(ast->type);
     vt->release(ast);
 
-    free(children);
+    cp_astnode_free(children);
 }
 
 
@@ -552,13 +632,12 @@ cypher_astnode_t *cypher_ast_clone(const cypher_astnode_t *ast)
         }
     }
 
-    assert(ast->type < _MAX_VT_OFF);
-    const struct cypher_astnode_vt *vt = VT_PTR(ast->type);
-    cypher_astnode_t *clone = vt->clone(ast, children);
+    cypher_astnode_t *clone = cp_astnode_clone(ast, children);
     if (clone == NULL)
     {
         goto failure;
     }
+    free(children);
     return clone;
 
     int errsv;
@@ -571,14 +650,457 @@ failure:
 }
 
 
-unsigned int cypher_ast_depth(const cypher_astnode_t *ast)
+/*
+ * Clone a single node, with the supplied children in place of its own.
+ * Each child must be of a type acceptable in the corresponding position.
+ */
+cypher_astnode_t *cp_astnode_clone(const cypher_astnode_t *node,
+        cypher_astnode_t **children)
 {
-    unsigned int depth = 0;
-    for (unsigned int i = 0; i < ast->nchildren; ++i)
+    assert(node->type < _MAX_VT_OFF);
+    const struct cypher_astnode_vt *vt = VT_PTR(node->type);
+    return vt->clone(node, children);
+}
+
+
+struct ast_arena
+{
+    char *buffer;
+    size_t size;
+    size_t used;
+};
+
+
+struct ast_arena_alignment
+{
+    char c;
+    union { void *p; long double d; intmax_t i; } u;
+};
+#define AST_ARENA_ALIGNMENT offsetof(struct ast_arena_alignment, u)
+
+struct ast_compaction
+{
+    // the bytes allocated by the constructor of each node, and the arena
+    // offset of its allocations, indexed in post-order
+    size_t *sizes;
+    size_t *offsets;
+    unsigned int next;
+};
+
+// When set, node allocations are taken from the arena (or, if the arena
+// has no buffer, only measured)
+static THREAD_LOCAL struct ast_arena *ast_arena = NULL;
+
+// When set, node allocations are taken from a growable scratch arena, and
+// node frees are ignored (the arena is reset as a whole)
+static THREAD_LOCAL struct cp_ast_scratch *ast_scratch = NULL;
+
+// A count of the node allocations made by this thread, for the slowlog
+static THREAD_LOCAL unsigned long ast_nallocations = 0;
+
+static void ast_transfer(cypher_astnode_t *from, cypher_astnode_t *to);
+static cypher_astnode_t *compact_clone(const cypher_astnode_t *node,
+        struct ast_compaction *c);
+static size_t preorder_offsets(const cypher_astnode_t *node,
+        unsigned int first, size_t offset, struct ast_compaction *c);
+static void *scratch_alloc(struct cp_ast_scratch *scratch, size_t size);
+
+
+void *cp_astnode_calloc(size_t size)
+{
+    ++ast_nallocations;
+    if (ast_scratch != NULL)
+    {
+        return scratch_alloc(ast_scratch, size);
+    }
+
+    struct ast_arena *arena = ast_arena;
+    if (arena == NULL)
+    {
+        return calloc(1, size);
+    }
+
+    size_t aligned = (size + AST_ARENA_ALIGNMENT - 1) &
+            ~(AST_ARENA_ALIGNMENT - 1);
+    if (arena->buffer == NULL)
+    {
+        arena->used += aligned;
+        return calloc(1, size);
+    }
+
+    // the arena is sized by a prior measuring pass over identical input,
+    // so constructors never see an allocation failure from it
+    assert(arena->size - arena->used >= aligned);
+    if (arena->size - arena->used < aligned)
+    {
+        errno = ENOMEM;
+        return NULL;
+    }
+    void *ptr = arena->buffer + arena->used;
+    arena->used += aligned;
+    return memset(ptr, 0, size);
+}
+
+
+unsigned long cp_ast_nallocations(void)
+{
+    return ast_nallocations;
+}
+
+
+void *cp_astnode_mdup(const void *src, size_t n)
+{
+    if (n == 0)
+    {
+        return NULL;
+    }
+    void *dst = cp_astnode_calloc(n);
+    if (dst == NULL)
+    {
+        return NULL;
+    }
+    return memcpy(dst, src, n);
+}
+
+
+void cp_astnode_free(void *ptr)
+{
+    if (ast_scratch != NULL)
+    {
+        return;
+    }
+    struct ast_arena *arena = ast_arena;
+    if (arena != NULL && arena->buffer != NULL &&
+            (char *)ptr >= arena->buffer &&
+            (char *)ptr < arena->buffer + arena->size)
+    {
+        return;
+    }
+    free(ptr);
+}
+
+
+void *cp_ast_vcompact(cypher_astnode_t * const *ast, unsigned int n,
+        cypher_astnode_t **compacted, size_t *size)
+{
+    REQUIRE(n > 0, NULL);
+    assert(ast_arena == NULL);
+
+    unsigned int nnodes = 0;
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        nnodes += ast[i]->size;
+    }
+    struct ast_compaction c = { .sizes = NULL, .offsets = NULL, .next = 0 };
+    c.sizes = malloc(nnodes * sizeof(size_t));
+    c.offsets = malloc(nnodes * sizeof(size_t));
+    struct ast_arena arena = { .buffer = NULL, .size = 0, .used = 0 };
+    unsigned int i = 0;
+    if (c.sizes == NULL || c.offsets == NULL)
+    {
+        goto failure;
+    }
+
+    // measure the allocations made by each node's constructor
+    ast_arena = &arena;
+    for (; i < n; ++i)
+    {
+        cypher_astnode_t *measured = compact_clone(ast[i], &c);
+        if (measured == NULL)
+        {
+            ast_arena = NULL;
+            goto failure;
+        }
+        ast_arena = NULL;
+        cypher_ast_free(measured);
+        ast_arena = &arena;
+    }
+    ast_arena = NULL;
+    assert(c.next == nnodes);
+
+    // nodes are constructed after their children, so each is placed at
+    // its pre-order offset rather than at the end of the arena
+    size_t offset = 0;
+    unsigned int first = 0;
+    for (i = 0; i < n; ++i)
+    {
+        offset = preorder_offsets(ast[i], first, offset, &c);
+        first += ast[i]->size;
+    }
+    assert(offset == arena.used);
+
+    arena.buffer = malloc(maxzu(arena.used, 1));
+    if (arena.buffer == NULL)
+    {
+        i = 0;
+        goto failure;
+    }
+    arena.size = arena.used;
+    arena.used = 0;
+    c.next = 0;
+
+    ast_arena = &arena;
+    for (i = 0; i < n; ++i)
+    {
+        compacted[i] = compact_clone(ast[i], &c);
+        if (compacted[i] == NULL)
+        {
+            goto failure;
+        }
+    }
+    ast_arena = NULL;
+
+    for (i = 0; i < n; ++i)
+    {
+        ast_transfer(ast[i], compacted[i]);
+    }
+    free(c.sizes);
+    free(c.offsets);
+    *size = arena.size;
+    return arena.buffer;
+
+    int errsv;
+failure:
+    errsv = errno;
+    if (arena.buffer != NULL)
+    {
+        cypher_ast_vfree(compacted, i);
+    }
+    ast_arena = NULL;
+    free(arena.buffer);
+    free(c.sizes);
+    free(c.offsets);
+    errno = errsv;
+    return NULL;
+}
+
+
+/*
+ * Clone a tree, recording (when measuring) or applying the arena offset of
+ * each node, indexed in the post-order in which nodes are constructed.
+ */
+cypher_astnode_t *compact_clone(const cypher_astnode_t *node,
+        struct ast_compaction *c)
+{
+    cypher_astnode_t **children = NULL;
+    unsigned int i = 0;
+    if (node->nchildren > 0)
+    {
+        children = calloc(node->nchildren, sizeof(cypher_astnode_t *));
+        if (children == NULL)
+        {
+            return NULL;
+        }
+        for (; i < node->nchildren; ++i)
+        {
+            children[i] = compact_clone(node->children[i], c);
+            if (children[i] == NULL)
+            {
+                goto failure;
+            }
+        }
+    }
+
+    struct ast_arena *arena = ast_arena;
+    unsigned int index = c->next++;
+    size_t start = arena->used;
+    if (arena->buffer != NULL)
+    {
+        start = arena->used = c->offsets[index];
+    }
+    cypher_astnode_t *clone = cp_astnode_clone(node, children);
+    if (clone == NULL)
+    {
+        goto failure;
+    }
+    if (arena->buffer == NULL)
+    {
+        c->sizes[index] = arena->used - start;
+    }
+    assert(arena->used - start == c->sizes[index]);
+    free(children);
+    return clone;
+
+    int errsv;
+failure:
+    errsv = errno;
+    cypher_ast_vfree(children, i);
+    free(children);
+    errno = errsv;
+    return NULL;
+}
+
+
+/*
+ * Assign the offsets of the nodes of a tree in pre-order, where `first` is
+ * the post-order index of the first node of the tree, returning the offset
+ * following the tree.
+ */
+size_t preorder_offsets(const cypher_astnode_t *node, unsigned int first,
+        size_t offset, struct ast_compaction *c)
+{
+    unsigned int index = first + node->size - 1;
+    c->offsets[index] = offset;
+    offset += c->sizes[index];
+    for (unsigned int i = 0; i < node->nchildren; ++i)
+    {
+        offset = preorder_offsets(node->children[i], first, offset, c);
+        first += node->children[i]->size;
+    }
+    return offset;
+}
+
+
+void ast_transfer(cypher_astnode_t *from, cypher_astnode_t *to)
+{
+    assert(from->type == to->type && from->nchildren == to->nchildren);
+    to->ordinal = from->ordinal;
+    to->annotations = from->annotations;
+    from->annotations = NULL;
+    for (struct cypher_astnode_annotation *a = to->annotations; a != NULL;
+            a = a->node_next)
+    {
+        a->astnode = to;
+    }
+    for (unsigned int i = 0; i < from->nchildren; ++i)
+    {
+        ast_transfer(from->children[i], to->children[i]);
+    }
+}
+
+
+void cp_ast_vfree_compacted(cypher_astnode_t * const *ast, unsigned int n,
+        void *buffer, size_t size)
+{
+    assert(buffer != NULL);
+    assert(ast_arena == NULL);
+    struct ast_arena arena = { .buffer = buffer, .size = size, .used = size };
+    ast_arena = &arena;
+    cypher_ast_vfree(ast, n);
+    ast_arena = NULL;
+    free(buffer);
+}
+
+
+struct ast_scratch_chunk
+{
+    struct ast_scratch_chunk *next;
+    size_t size;
+    size_t used;
+};
+#define AST_SCRATCH_HEADER_SIZE \
+    ((sizeof(struct ast_scratch_chunk) + AST_ARENA_ALIGNMENT - 1) & \
+        ~(AST_ARENA_ALIGNMENT - 1))
+#define AST_SCRATCH_MIN_CHUNK_SIZE 65536
+
+struct cp_ast_scratch
+{
+    struct ast_scratch_chunk *chunks; // most recent first
+    size_t total;
+};
+
+
+static struct ast_scratch_chunk *scratch_chunk(size_t size)
+{
+    struct ast_scratch_chunk *chunk = malloc(AST_SCRATCH_HEADER_SIZE + size);
+    if (chunk == NULL)
+    {
+        return NULL;
+    }
+    chunk->next = NULL;
+    chunk->size = size;
+    chunk->used = 0;
+    return chunk;
+}
+
+
+struct cp_ast_scratch *cp_ast_scratch_new(void)
+{
+    return calloc(1, sizeof(struct cp_ast_scratch));
+}
+
+
+void cp_ast_scratch_activate(struct cp_ast_scratch *scratch)
+{
+    assert(ast_arena == NULL);
+    ast_scratch = scratch;
+}
+
+
+bool cp_ast_scratch_active(void)
+{
+    return ast_scratch != NULL;
+}
+
+
+void cp_ast_scratch_reset(struct cp_ast_scratch *scratch)
+{
+    struct ast_scratch_chunk *chunk = scratch->chunks;
+    if (chunk == NULL)
+    {
+        return;
+    }
+    if (chunk->next == NULL)
+    {
+        chunk->used = 0;
+        return;
+    }
+
+    // replace multiple chunks with one large enough for all of them, so
+    // that subsequent use requires no further allocation
+    while (chunk != NULL)
+    {
+        struct ast_scratch_chunk *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    scratch->chunks = scratch_chunk(scratch->total);
+    if (scratch->chunks == NULL)
+    {
+        scratch->total = 0;
+    }
+}
+
+
+void cp_ast_scratch_free(struct cp_ast_scratch *scratch)
+{
+    if (scratch == NULL)
     {
-        depth = maxu(depth, cypher_ast_depth(ast->children[i]));
+        return;
     }
-    return 1 + depth;
+    assert(ast_scratch != scratch);
+    struct ast_scratch_chunk *chunk = scratch->chunks;
+    while (chunk != NULL)
+    {
+        struct ast_scratch_chunk *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    free(scratch);
+}
+
+
+void *scratch_alloc(struct cp_ast_scratch *scratch, size_t size)
+{
+    size_t aligned = (size + AST_ARENA_ALIGNMENT - 1) &
+            ~(AST_ARENA_ALIGNMENT - 1);
+    struct ast_scratch_chunk *chunk = scratch->chunks;
+    if (chunk == NULL || chunk->size - chunk->used < aligned)
+    {
+        size_t chunk_size = maxzu(maxzu(aligned, scratch->total),
+                AST_SCRATCH_MIN_CHUNK_SIZE);
+        chunk = scratch_chunk(chunk_size);
+        if (chunk == NULL)
+        {
+            return NULL;
+        }
+        chunk->next = scratch->chunks;
+        scratch->chunks = chunk;
+        scratch->total += chunk_size;
+    }
+    char *ptr = (char *)chunk + AST_SCRATCH_HEADER_SIZE + chunk->used;
+    chunk->used += aligned;
+    return memset(ptr, 0, size);
 }
 
 
@@ -842,21 +1364,39 @@ int cypher_ast_fprintv(cypher_astnode_t * const *asts, unsigned int n,
         uint_fast32_t flags)
 {
     REQUIRE(n == 0 || asts != NULL, -1);
-    if (colorization == NULL)
+    struct cp_ast_field_widths widths = { 0, 0, 0, 0 };
+    cp_ast_vfield_widths(asts, n, &widths);
+    return cp_ast_vfprint_widths(asts, n, stream, width, colorization,
+            &widths);
+}
+
+
+void cp_ast_vfield_widths(cypher_astnode_t * const *asts, unsigned int n,
+        struct cp_ast_field_widths *widths)
+{
+    for (unsigned int i = 0; i < n; ++i)
     {
-        colorization = cypher_parser_no_colorization;
+        ast_fprint_field_widths(asts[i], &(widths->max_ordinal),
+                &(widths->max_start), &(widths->max_end),
+                &(widths->name_width), 0);
     }
+}
 
-    unsigned int max_ordinal = 0, name_width = 0;
-    size_t max_start = 0, max_end = 0;
-    for (unsigned int i = 0; i < n; ++i)
+
+int cp_ast_vfprint_widths(cypher_astnode_t * const *asts, unsigned int n,
+        FILE *stream, unsigned int width,
+        const struct cypher_parser_colorization *colorization,
+        const struct cp_ast_field_widths *widths)
+{
+    REQUIRE(n == 0 || asts != NULL, -1);
+    if (colorization == NULL)
     {
-        ast_fprint_field_widths(asts[i], &max_ordinal, &max_start, &max_end,
-                &name_width, 0);
+        colorization = cypher_parser_no_colorization;
     }
-    unsigned int ordinal_width = (unsigned int)log10(max_ordinal)+2;
-    unsigned int start_width = (unsigned int)log10(max_start)+1;
-    unsigned int end_width = (unsigned int)log10(max_end)+1;
+
+    unsigned int ordinal_width = (unsigned int)log10(widths->max_ordinal)+2;
+    unsigned int start_width = (unsigned int)log10(widths->max_start)+1;
+    unsigned int end_width = (unsigned int)log10(widths->max_end)+1;
 
     size_t bufcap = 1024;
     char *buf = malloc(bufcap);
@@ -871,7 +1411,7 @@ int cypher_ast_fprintv(cypher_astnode_t * const *asts, unsigned int n,
     {
         if (_cypher_ast_fprint(asts[i], stream, colorization,
                     &buf, &bufcap, width, ordinal_width, start_width,
-                    end_width, name_width, 0) < 0)
+                    end_width, widths->name_width, 0) < 0)
         {
             goto cleanup;
         }
@@ -894,9 +1434,33 @@ int cypher_astnode_init(cypher_astnode_t *node,
 
     node->type = type;
     node->range = range;
+
+    node->size = 1;
+    node->depth = 0;
+    uint_fast32_t attributes = type_attributes(type);
+    for (unsigned int i = 0; i < nchildren; ++i)
+    {
+        node->size += children[i]->size;
+        node->depth = maxu(node->depth, children[i]->depth);
+        attributes |= children[i]->attributes;
+    }
+    node->depth++;
+    attributes &= ~CYPHER_AST_IS_CONSTANT;
+    if (cypher_astnode_vt_instanceof(VT_PTR(type),
+                &cypher_expression_astnode_vt) &&
+        !(attributes & (CYPHER_AST_HAS_AGGREGATE | CYPHER_AST_HAS_PARAMETER |
+                CYPHER_AST_HAS_PATTERN | CYPHER_AST_HAS_NONDETERMINISTIC |
+                CYPHER_AST_HAS_UPDATE | CYPHER_AST_HAS_IDENTIFIER |
+                CYPHER_AST_HAS_UNRESOLVED_FUNCTION)))
+    {
+        attributes |= CYPHER_AST_IS_CONSTANT;
+    }
+    node->attributes = attributes;
+
     if (nchildren > 0)
     {
-        node->children = mdup(children, nchildren * sizeof(cypher_astnode_t *));
+        node->children = cp_astnode_mdup(children,
+                nchildren * sizeof(cypher_astnode_t *));
         if (node->children == NULL)
         {
             return -1;
@@ -912,9 +1476,55 @@ int cypher_astnode_init(cypher_astnode_t *node,
 }
 
 
+uint_fast32_t type_attributes(cypher_astnode_type_t type)
+{
+    assert(type < _MAX_VT_OFF);
+    const struct cypher_astnode_vt *vt = VT_PTR(type);
+    if (type == CYPHER_AST_IDENTIFIER)
+    {
+        return CYPHER_AST_HAS_IDENTIFIER;
+    }
+    if (type == CYPHER_AST_PARAMETER)
+    {
+        return CYPHER_AST_HAS_PARAMETER;
+    }
+    if (cypher_astnode_vt_instanceof(vt, &cypher_pattern_astnode_vt) ||
+        cypher_astnode_vt_instanceof(vt, &cypher_pattern_path_astnode_vt) ||
+        type == CYPHER_AST_PATTERN_COMPREHENSION)
+    {
+        return CYPHER_AST_HAS_PATTERN;
+    }
+    if (type == CYPHER_AST_CREATE || type == CYPHER_AST_MERGE ||
+        type == CYPHER_AST_SET || type == CYPHER_AST_DELETE ||
+        type == CYPHER_AST_REMOVE)
+    {
+        return CYPHER_AST_HAS_UPDATE;
+    }
+    return 0;
+}
+
+
+uint_fast32_t cypher_astnode_attributes(const cypher_astnode_t *node)
+{
+    return node->attributes;
+}
+
+
+unsigned int cypher_astnode_subtree_size(const cypher_astnode_t *node)
+{
+    return node->size;
+}
+
+
+unsigned int cypher_astnode_depth(const cypher_astnode_t *node)
+{
+    return node->depth;
+}
+
+
 void cypher_astnode_release(cypher_astnode_t *node)
 {
-    free(node);
+    cp_astnode_free(node);
 }
 
 
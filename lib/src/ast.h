@@ -18,19 +18,83 @@
 #define CYPHER_PARSER_AST_H
 
 #include "cypher-parser.h"
+#include "key_index.h"
 
 
 unsigned int cypher_ast_set_ordinals(cypher_astnode_t *ast, unsigned int n);
 
+unsigned int cp_ast_ntypes(void);
+
+const cypher_astnode_type_t *cp_ast_type_ancestors(cypher_astnode_type_t type,
+        unsigned int *n);
+
 int cypher_ast_fprintv(cypher_astnode_t * const *asts, unsigned int n,
         FILE *stream, unsigned int width,
         const struct cypher_parser_colorization *colorization,
         uint_fast32_t flags);
 
+struct cp_ast_field_widths
+{
+    unsigned int max_ordinal;
+    size_t max_start;
+    size_t max_end;
+    unsigned int name_width;
+};
+
+void cp_ast_vfield_widths(cypher_astnode_t * const *asts, unsigned int n,
+        struct cp_ast_field_widths *widths);
+
+int cp_ast_vfprint_widths(cypher_astnode_t * const *asts, unsigned int n,
+        FILE *stream, unsigned int width,
+        const struct cypher_parser_colorization *colorization,
+        const struct cp_ast_field_widths *widths);
+
 void cypher_ast_vfree(cypher_astnode_t * const *ast, unsigned int n);
 
 cypher_astnode_t **cypher_ast_vclone(cypher_astnode_t * const *ast,
         unsigned int n);
 
+cypher_astnode_t *cp_astnode_clone(const cypher_astnode_t *node,
+        cypher_astnode_t **children);
+
+void *cp_ast_vcompact(cypher_astnode_t * const *ast, unsigned int n,
+        cypher_astnode_t **compacted, size_t *size);
+
+void cp_ast_vfree_compacted(cypher_astnode_t * const *ast, unsigned int n,
+        void *buffer, size_t size);
+
+unsigned long cp_ast_nallocations(void);
+
+void cp_ast_vrelease_annotations(cypher_astnode_t * const *ast, unsigned int n);
+
+cypher_astnode_t *cp_ast_pair_map(cypher_astnode_t * const *pairs,
+        unsigned int nentries, cypher_astnode_t **children,
+        unsigned int nchildren, struct cypher_input_range range,
+        cp_key_index_duplicate_t duplicate, void *userdata);
+
+cypher_astnode_t *cp_ast_map_projection(const cypher_astnode_t *expression,
+        cypher_astnode_t * const *selectors, unsigned int nselectors,
+        cypher_astnode_t **children, unsigned int nchildren,
+        struct cypher_input_range range, cp_key_index_duplicate_t duplicate,
+        void *userdata);
+
+cypher_astnode_t *cp_ast_function_name(const char *s, size_t n, int id,
+        uint_fast32_t flags, struct cypher_input_range range);
+
+cypher_astnode_t *cp_ast_proc_name(const char *s, size_t n, int id,
+        uint_fast32_t flags, struct cypher_input_range range);
+
+struct cp_ast_scratch;
+
+struct cp_ast_scratch *cp_ast_scratch_new(void);
+
+void cp_ast_scratch_activate(struct cp_ast_scratch *scratch);
+
+bool cp_ast_scratch_active(void);
+
+void cp_ast_scratch_reset(struct cp_ast_scratch *scratch);
+
+void cp_ast_scratch_free(struct cp_ast_scratch *scratch);
+
 
 #endif/*CYPHER_PARSER_AST_H*/
@@ -71,7 +71,7 @@ cypher_astnode_t *cypher_ast_any(const cypher_astnode_t *identifier,
     REQUIRE_CHILD_OPTIONAL(children, nchildren, predicate,
             CYPHER_AST_EXPRESSION, NULL);
 
-    struct any *node = calloc(1, sizeof(struct any));
+    struct any *node = cp_astnode_calloc(sizeof(struct any));
     if (node == NULL)
     {
         return NULL;
@@ -79,7 +79,7 @@ cypher_astnode_t *cypher_ast_any(const cypher_astnode_t *identifier,
     if (cypher_list_comprehension_astnode_init(&(node->_list_comprehension_astnode),
             CYPHER_AST_ANY, &lc_vt, children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->identifier = identifier;
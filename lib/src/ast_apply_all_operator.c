@@ -55,7 +55,7 @@ cypher_astnode_t *cypher_ast_apply_all_operator(
             CYPHER_AST_FUNCTION_NAME, NULL);
 
     struct apply_all_operator *node =
-            calloc(1, sizeof(struct apply_all_operator));
+            cp_astnode_calloc(sizeof(struct apply_all_operator));
     if (node == NULL)
     {
         return NULL;
@@ -72,7 +72,7 @@ cypher_astnode_t *cypher_ast_apply_all_operator(
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
@@ -58,8 +58,9 @@ cypher_astnode_t *cypher_ast_apply_operator(const cypher_astnode_t *func_name,
     REQUIRE_CHILD_ALL(children, nchildren, args, nargs,
             CYPHER_AST_EXPRESSION, NULL);
 
-    struct apply_operator *node = calloc(1, sizeof(struct apply_operator) +
-            nargs * sizeof(cypher_astnode_t *));
+    struct apply_operator *node =
+            cp_astnode_calloc(sizeof(struct apply_operator) +
+                nargs * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
         return NULL;
@@ -79,7 +80,7 @@ cypher_astnode_t *cypher_ast_apply_operator(const cypher_astnode_t *func_name,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
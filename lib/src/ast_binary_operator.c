@@ -56,7 +56,8 @@ cypher_astnode_t *cypher_ast_binary_operator(const cypher_operator_t *op,
     REQUIRE_CHILD(children, nchildren, arg1, CYPHER_AST_EXPRESSION, NULL);
     REQUIRE_CHILD(children, nchildren, arg2, CYPHER_AST_EXPRESSION, NULL);
 
-    struct binary_operator *node = calloc(1, sizeof(struct binary_operator));
+    struct binary_operator *node =
+            cp_astnode_calloc(sizeof(struct binary_operator));
     if (node == NULL)
     {
         return NULL;
@@ -64,7 +65,7 @@ cypher_astnode_t *cypher_ast_binary_operator(const cypher_operator_t *op,
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_BINARY_OPERATOR,
             children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->op = op;
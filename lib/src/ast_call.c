@@ -64,7 +64,7 @@ cypher_astnode_t *cypher_ast_call(const cypher_astnode_t *proc_name,
     REQUIRE_CHILD_OPTIONAL(children, nchildren, predicate,
             CYPHER_AST_EXPRESSION, NULL);
 
-    struct call_clause *node = calloc(1, sizeof(struct call_clause) +
+    struct call_clause *node = cp_astnode_calloc(sizeof(struct call_clause) +
             nprojections * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
@@ -78,7 +78,7 @@ cypher_astnode_t *cypher_ast_call(const cypher_astnode_t *proc_name,
     node->proc_name = proc_name;
     if (nargs > 0)
     {
-        node->args = mdup(args, nargs * sizeof(cypher_astnode_t *));
+        node->args = cp_astnode_mdup(args, nargs * sizeof(cypher_astnode_t *));
         if (node->args == NULL)
         {
             goto cleanup;
@@ -94,7 +94,7 @@ cypher_astnode_t *cypher_ast_call(const cypher_astnode_t *proc_name,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
@@ -103,7 +103,7 @@ cleanup:
 void call_release(cypher_astnode_t *self)
 {
     struct call_clause *node = container_of(self, struct call_clause, _astnode);
-    free(node->args);
+    cp_astnode_free(node->args);
     cypher_astnode_release(self);
 }
 
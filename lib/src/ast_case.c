@@ -60,8 +60,9 @@ cypher_astnode_t *cypher_ast_case(const cypher_astnode_t *expression,
     REQUIRE_CHILD_OPTIONAL(children, nchildren, deflt,
             CYPHER_AST_EXPRESSION, NULL);
 
-    struct case_expression *node = calloc(1, sizeof(struct case_expression) +
-            nalternatives * 2 * sizeof(cypher_astnode_t *));
+    struct case_expression *node =
+            cp_astnode_calloc(sizeof(struct case_expression) +
+                nalternatives * 2 * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
         return NULL;
@@ -81,7 +82,7 @@ cypher_astnode_t *cypher_ast_case(const cypher_astnode_t *expression,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
@@ -53,7 +53,7 @@ cypher_astnode_t *cypher_ast_collection(
     REQUIRE_CHILD_ALL(children, nchildren, elements, nelements,
             CYPHER_AST_EXPRESSION, NULL);
 
-    struct collection *node = calloc(1, sizeof(struct collection) +
+    struct collection *node = cp_astnode_calloc(sizeof(struct collection) +
             nelements * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
@@ -62,7 +62,7 @@ cypher_astnode_t *cypher_ast_collection(
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_COLLECTION,
                 children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     memcpy(node->elements, elements, nelements * sizeof(cypher_astnode_t *));
@@ -50,7 +50,7 @@ cypher_astnode_t *cypher_ast_command(const cypher_astnode_t *name,
     REQUIRE_CHILD_ALL(children, nchildren, args, nargs,
             CYPHER_AST_STRING, NULL);
 
-    struct command *node = calloc(1, sizeof(struct command) +
+    struct command *node = cp_astnode_calloc(sizeof(struct command) +
             nargs * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
@@ -69,7 +69,7 @@ cypher_astnode_t *cypher_ast_command(const cypher_astnode_t *name,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
@@ -58,7 +58,7 @@ cypher_astnode_t *cypher_ast_comparison(unsigned int length,
     REQUIRE_CHILD_ALL(children, nchildren, args, length+1,
             CYPHER_AST_EXPRESSION, NULL);
 
-    struct comparison *node = calloc(1, sizeof(struct comparison) +
+    struct comparison *node = cp_astnode_calloc(sizeof(struct comparison) +
             (length + 1) * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
@@ -67,11 +67,11 @@ cypher_astnode_t *cypher_ast_comparison(unsigned int length,
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_COMPARISON,
             children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->length = length;
-    node->ops = mdup(ops, length * sizeof(cypher_astnode_t *));
+    node->ops = cp_astnode_mdup(ops, length * sizeof(cypher_astnode_t *));
     if (node->ops == NULL)
     {
         goto cleanup;
@@ -82,8 +82,8 @@ cypher_astnode_t *cypher_ast_comparison(unsigned int length,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node->ops);
-    free(node);
+    cp_astnode_free(node->ops);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
@@ -92,7 +92,7 @@ cleanup:
 void comparison_release(cypher_astnode_t *self)
 {
     struct comparison *node = container_of(self, struct comparison, _astnode);
-    free(node->ops);
+    cp_astnode_free(node->ops);
     cypher_astnode_release(self);
 }
 
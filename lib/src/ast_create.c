@@ -51,7 +51,7 @@ cypher_astnode_t *cypher_ast_create(bool unique,
 {
     REQUIRE_CHILD(children, nchildren, pattern, CYPHER_AST_PATTERN, NULL);
 
-    struct create *node = calloc(1, sizeof(struct create));
+    struct create *node = cp_astnode_calloc(sizeof(struct create));
     if (node == NULL)
     {
         return NULL;
@@ -59,7 +59,7 @@ cypher_astnode_t *cypher_ast_create(bool unique,
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_CREATE,
             children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->unique = unique;
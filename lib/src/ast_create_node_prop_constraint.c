@@ -57,7 +57,7 @@ cypher_astnode_t *cypher_ast_create_node_prop_constraint(
     REQUIRE_CHILD(children, nchildren, label, CYPHER_AST_LABEL, NULL);
     REQUIRE_CHILD(children, nchildren, expression, CYPHER_AST_EXPRESSION, NULL);
 
-    struct constraint *node = calloc(1, sizeof(struct constraint));
+    struct constraint *node = cp_astnode_calloc(sizeof(struct constraint));
     if (node == NULL)
     {
         return NULL;
@@ -65,7 +65,7 @@ cypher_astnode_t *cypher_ast_create_node_prop_constraint(
     if (cypher_astnode_init(&(node->_astnode),
             CYPHER_AST_CREATE_NODE_PROP_CONSTRAINT, children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->identifier = identifier;
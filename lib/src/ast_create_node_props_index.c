@@ -56,7 +56,7 @@ cypher_astnode_t *cypher_ast_create_node_props_index(
     REQUIRE_CHILD_ALL(children, nchildren, prop_names, nprops,
             CYPHER_AST_PROP_NAME, NULL);
 
-    struct create_index *node = calloc(1, sizeof(struct create_index) +
+    struct create_index *node = cp_astnode_calloc(sizeof(struct create_index) +
             nprops * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
@@ -75,7 +75,7 @@ cypher_astnode_t *cypher_ast_create_node_props_index(
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
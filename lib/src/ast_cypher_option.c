@@ -57,8 +57,9 @@ cypher_astnode_t *cypher_ast_cypher_option(const cypher_astnode_t *version,
     REQUIRE_CHILD_ALL(children, nchildren, params, nparams,
             CYPHER_AST_CYPHER_OPTION_PARAM, NULL);
 
-    struct cypher_option *node = calloc(1, sizeof(struct cypher_option) +
-            nparams * sizeof(cypher_astnode_t *));
+    struct cypher_option *node =
+            cp_astnode_calloc(sizeof(struct cypher_option) +
+                nparams * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
         return NULL;
@@ -77,7 +78,7 @@ cypher_astnode_t *cypher_ast_cypher_option(const cypher_astnode_t *version,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
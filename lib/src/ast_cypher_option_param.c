@@ -48,7 +48,7 @@ cypher_astnode_t *cypher_ast_cypher_option_param(const cypher_astnode_t *name,
     REQUIRE_CHILD(children, nchildren, name, CYPHER_AST_STRING, NULL);
 
     struct cypher_option_param *node =
-            calloc(1, sizeof(struct cypher_option_param));
+            cp_astnode_calloc(sizeof(struct cypher_option_param));
     if (node == NULL)
     {
         return NULL;
@@ -56,7 +56,7 @@ cypher_astnode_t *cypher_ast_cypher_option_param(const cypher_astnode_t *name,
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_CYPHER_OPTION_PARAM,
             children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->name = name;
@@ -55,8 +55,9 @@ cypher_astnode_t *cypher_ast_delete(bool detach,
     REQUIRE_CHILD_ALL(children, nchildren, expressions, nexpressions,
             CYPHER_AST_EXPRESSION, NULL);
 
-    struct delete_clause *node = calloc(1, sizeof(struct delete_clause) +
-            nexpressions * sizeof(cypher_astnode_t *));
+    struct delete_clause *node =
+            cp_astnode_calloc(sizeof(struct delete_clause) +
+                nexpressions * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
         return NULL;
@@ -75,7 +76,7 @@ cypher_astnode_t *cypher_ast_delete(bool detach,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
@@ -46,7 +46,8 @@ const struct cypher_astnode_vt cypher_explain_option_astnode_vt =
 
 cypher_astnode_t *cypher_ast_explain_option(struct cypher_input_range range)
 {
-    struct explain_option *node = calloc(1, sizeof(struct explain_option));
+    struct explain_option *node =
+            cp_astnode_calloc(sizeof(struct explain_option));
     if (node == NULL)
     {
         return NULL;
@@ -54,7 +55,7 @@ cypher_astnode_t *cypher_ast_explain_option(struct cypher_input_range range)
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_EXPLAIN_OPTION,
             NULL, 0, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     return &(node->_astnode);
@@ -71,7 +71,7 @@ cypher_astnode_t *cypher_ast_extract(const cypher_astnode_t *identifier,
     REQUIRE_CHILD_OPTIONAL(children, nchildren, eval,
             CYPHER_AST_EXPRESSION, NULL);
 
-    struct extract *node = calloc(1, sizeof(struct extract));
+    struct extract *node = cp_astnode_calloc(sizeof(struct extract));
     if (node == NULL)
     {
         return NULL;
@@ -79,7 +79,7 @@ cypher_astnode_t *cypher_ast_extract(const cypher_astnode_t *identifier,
     if (cypher_list_comprehension_astnode_init(&(node->_list_comprehension_astnode),
             CYPHER_AST_EXTRACT, &lc_vt, children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->identifier = identifier;
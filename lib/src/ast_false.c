@@ -46,7 +46,8 @@ const struct cypher_astnode_vt cypher_false_astnode_vt =
 
 cypher_astnode_t *cypher_ast_false(struct cypher_input_range range)
 {
-    struct false_literal *node = calloc(1, sizeof(struct false_literal));
+    struct false_literal *node =
+            cp_astnode_calloc(sizeof(struct false_literal));
     if (node == NULL)
     {
         return NULL;
@@ -54,7 +55,7 @@ cypher_astnode_t *cypher_ast_false(struct cypher_input_range range)
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_FALSE,
             NULL, 0, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     return &(node->_astnode);
@@ -71,7 +71,7 @@ cypher_astnode_t *cypher_ast_filter(const cypher_astnode_t *identifier,
     REQUIRE_CHILD_OPTIONAL(children, nchildren, predicate,
             CYPHER_AST_EXPRESSION, NULL);
 
-    struct filter *node = calloc(1, sizeof(struct filter));
+    struct filter *node = cp_astnode_calloc(sizeof(struct filter));
     if (node == NULL)
     {
         return NULL;
@@ -79,7 +79,7 @@ cypher_astnode_t *cypher_ast_filter(const cypher_astnode_t *identifier,
     if (cypher_list_comprehension_astnode_init(&(node->_list_comprehension_astnode),
             CYPHER_AST_FILTER, &lc_vt, children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->identifier = identifier;
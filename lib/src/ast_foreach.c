@@ -58,8 +58,9 @@ cypher_astnode_t *cypher_ast_foreach(const cypher_astnode_t *identifier,
     REQUIRE_CHILD_ALL(children, nchildren, clauses, nclauses,
             CYPHER_AST_QUERY_CLAUSE, NULL);
 
-    struct foreach_clause *node = calloc(1, sizeof(struct foreach_clause) +
-            nclauses * sizeof(cypher_astnode_t *));
+    struct foreach_clause *node =
+            cp_astnode_calloc(sizeof(struct foreach_clause) +
+                nclauses * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
         return NULL;
@@ -78,7 +79,7 @@ cypher_astnode_t *cypher_ast_foreach(const cypher_astnode_t *identifier,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
@@ -23,6 +23,9 @@
 struct function_name
 {
     cypher_astnode_t _astnode;
+    int id;
+    uint_fast32_t flags;
+    size_t n;
     char p[];
 };
 
@@ -42,7 +45,15 @@ const struct cypher_astnode_vt cypher_function_name_astnode_vt =
 cypher_astnode_t *cypher_ast_function_name(const char *s, size_t n,
         struct cypher_input_range range)
 {
-    struct function_name *node = calloc(1, sizeof(struct function_name) + n+1);
+    return cp_ast_function_name(s, n, -1, 0, range);
+}
+
+
+cypher_astnode_t *cp_ast_function_name(const char *s, size_t n, int id,
+        uint_fast32_t flags, struct cypher_input_range range)
+{
+    struct function_name *node =
+            cp_astnode_calloc(sizeof(struct function_name) + n+1);
     if (node == NULL)
     {
         return NULL;
@@ -50,9 +61,24 @@ cypher_astnode_t *cypher_ast_function_name(const char *s, size_t n,
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_FUNCTION_NAME,
                 NULL, 0, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
+    node->id = id;
+    node->flags = flags;
+    if (flags & CYPHER_CATALOG_AGGREGATE)
+    {
+        node->_astnode.attributes |= CYPHER_AST_HAS_AGGREGATE;
+    }
+    if (flags & CYPHER_CATALOG_NONDETERMINISTIC)
+    {
+        node->_astnode.attributes |= CYPHER_AST_HAS_NONDETERMINISTIC;
+    }
+    if (id < 0)
+    {
+        node->_astnode.attributes |= CYPHER_AST_HAS_UNRESOLVED_FUNCTION;
+    }
+    node->n = n;
     memcpy(node->p, s, n);
     node->p[n] = '\0';
     return &(node->_astnode);
@@ -65,7 +91,8 @@ cypher_astnode_t *clone(const cypher_astnode_t *self,
     REQUIRE_TYPE(self, CYPHER_AST_FUNCTION_NAME, NULL);
     struct function_name *node =
             container_of(self, struct function_name, _astnode);
-    return cypher_ast_function_name(node->p, strlen(node->p), self->range);
+    return cp_ast_function_name(node->p, node->n, node->id,
+            node->flags, self->range);
 }
 
 
@@ -78,6 +105,33 @@ const char *cypher_ast_function_name_get_value(const cypher_astnode_t *astnode)
 }
 
 
+size_t cypher_ast_function_name_get_value_len(const cypher_astnode_t *astnode)
+{
+    REQUIRE_TYPE(astnode, CYPHER_AST_FUNCTION_NAME, 0);
+    struct function_name *node =
+            container_of(astnode, struct function_name, _astnode);
+    return node->n;
+}
+
+
+int cypher_ast_function_name_get_id(const cypher_astnode_t *astnode)
+{
+    REQUIRE_TYPE(astnode, CYPHER_AST_FUNCTION_NAME, -1);
+    struct function_name *node =
+            container_of(astnode, struct function_name, _astnode);
+    return node->id;
+}
+
+
+uint_fast32_t cypher_ast_function_name_get_flags(const cypher_astnode_t *astnode)
+{
+    REQUIRE_TYPE(astnode, CYPHER_AST_FUNCTION_NAME, 0);
+    struct function_name *node =
+            container_of(astnode, struct function_name, _astnode);
+    return node->flags;
+}
+
+
 ssize_t detailstr(const cypher_astnode_t *self, char *str, size_t size)
 {
     REQUIRE_TYPE(self, CYPHER_AST_FUNCTION_NAME, -1);
@@ -23,6 +23,7 @@
 struct identifier
 {
     cypher_astnode_t _astnode;
+    size_t n;
     char p[];
 };
 
@@ -47,7 +48,8 @@ const struct cypher_astnode_vt cypher_identifier_astnode_vt =
 cypher_astnode_t *cypher_ast_identifier(const char *s, size_t n,
         struct cypher_input_range range)
 {
-    struct identifier *node = calloc(1, sizeof(struct identifier) + n+1);
+    struct identifier *node =
+            cp_astnode_calloc(sizeof(struct identifier) + n+1);
     if (node == NULL)
     {
         return NULL;
@@ -55,9 +57,10 @@ cypher_astnode_t *cypher_ast_identifier(const char *s, size_t n,
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_IDENTIFIER,
                 NULL, 0, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
+    node->n = n;
     memcpy(node->p, s, n);
     node->p[n] = '\0';
     return &(node->_astnode);
@@ -69,7 +72,7 @@ cypher_astnode_t *clone(const cypher_astnode_t *self,
 {
     REQUIRE_TYPE(self, CYPHER_AST_IDENTIFIER, NULL);
     struct identifier *node = container_of(self, struct identifier, _astnode);
-    return cypher_ast_identifier(node->p, strlen(node->p), self->range);
+    return cypher_ast_identifier(node->p, node->n, self->range);
 }
 
 
@@ -81,6 +84,14 @@ const char *cypher_ast_identifier_get_name(const cypher_astnode_t *astnode)
 }
 
 
+size_t cypher_ast_identifier_get_name_len(const cypher_astnode_t *astnode)
+{
+    REQUIRE_TYPE(astnode, CYPHER_AST_IDENTIFIER, 0);
+    struct identifier *node = container_of(astnode, struct identifier, _astnode);
+    return node->n;
+}
+
+
 ssize_t detailstr(const cypher_astnode_t *self, char *str, size_t size)
 {
     REQUIRE_TYPE(self, CYPHER_AST_IDENTIFIER, -1);
@@ -23,6 +23,7 @@
 struct integer
 {
     cypher_astnode_t _astnode;
+    size_t n;
     char p[];
 };
 
@@ -47,7 +48,7 @@ const struct cypher_astnode_vt cypher_integer_astnode_vt =
 cypher_astnode_t *cypher_ast_integer(const char *s, size_t n,
         struct cypher_input_range range)
 {
-    struct integer *node = calloc(1, sizeof(struct integer) + n+1);
+    struct integer *node = cp_astnode_calloc(sizeof(struct integer) + n+1);
     if (node == NULL)
     {
         return NULL;
@@ -55,9 +56,10 @@ cypher_astnode_t *cypher_ast_integer(const char *s, size_t n,
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_INTEGER, NULL, 0,
                 range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
+    node->n = n;
     memcpy(node->p, s, n);
     node->p[n] = '\0';
     return &(node->_astnode);
@@ -69,7 +71,7 @@ cypher_astnode_t *clone(const cypher_astnode_t *self,
 {
     REQUIRE_TYPE(self, CYPHER_AST_INTEGER, NULL);
     struct integer *node = container_of(self, struct integer, _astnode);
-    return cypher_ast_integer(node->p, strlen(node->p), self->range);
+    return cypher_ast_integer(node->p, node->n, self->range);
 }
 
 
@@ -81,6 +83,14 @@ const char *cypher_ast_integer_get_valuestr(const cypher_astnode_t *astnode)
 }
 
 
+size_t cypher_ast_integer_get_valuestr_len(const cypher_astnode_t *astnode)
+{
+    REQUIRE_TYPE(astnode, CYPHER_AST_INTEGER, 0);
+    struct integer *node = container_of(astnode, struct integer, _astnode);
+    return node->n;
+}
+
+
 ssize_t detailstr(const cypher_astnode_t *self, char *str, size_t size)
 {
     REQUIRE_TYPE(self, CYPHER_AST_INTEGER, -1);
@@ -23,6 +23,7 @@
 struct label
 {
     cypher_astnode_t _astnode;
+    size_t n;
     char p[];
 };
 
@@ -42,7 +43,7 @@ const struct cypher_astnode_vt cypher_label_astnode_vt =
 cypher_astnode_t *cypher_ast_label(const char *s, size_t n,
         struct cypher_input_range range)
 {
-    struct label *node = calloc(1, sizeof(struct label) + n+1);
+    struct label *node = cp_astnode_calloc(sizeof(struct label) + n+1);
     if (node == NULL)
     {
         return NULL;
@@ -50,9 +51,10 @@ cypher_astnode_t *cypher_ast_label(const char *s, size_t n,
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_LABEL, NULL, 0,
                 range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
+    node->n = n;
     memcpy(node->p, s, n);
     node->p[n] = '\0';
     return &(node->_astnode);
@@ -64,7 +66,7 @@ cypher_astnode_t *clone(const cypher_astnode_t *self,
 {
     REQUIRE_TYPE(self, CYPHER_AST_LABEL, NULL);
     struct label *node = container_of(self, struct label, _astnode);
-    return cypher_ast_label(node->p, strlen(node->p), self->range);
+    return cypher_ast_label(node->p, node->n, self->range);
 }
 
 
@@ -76,6 +78,14 @@ const char *cypher_ast_label_get_name(const cypher_astnode_t *astnode)
 }
 
 
+size_t cypher_ast_label_get_name_len(const cypher_astnode_t *astnode)
+{
+    REQUIRE_TYPE(astnode, CYPHER_AST_LABEL, 0);
+    struct label *node = container_of(astnode, struct label, _astnode);
+    return node->n;
+}
+
+
 ssize_t detailstr(const cypher_astnode_t *self, char *str, size_t size)
 {
     REQUIRE_TYPE(self, CYPHER_AST_LABEL, -1);
@@ -57,8 +57,9 @@ cypher_astnode_t *cypher_ast_labels_operator(const cypher_astnode_t *expression,
     REQUIRE_CHILD_ALL(children, nchildren, labels, nlabels,
             CYPHER_AST_LABEL, NULL);
 
-    struct labels_operator *node = calloc(1, sizeof(struct labels_operator) +
-            nlabels * sizeof(cypher_astnode_t *));
+    struct labels_operator *node =
+            cp_astnode_calloc(sizeof(struct labels_operator) +
+                nlabels * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
         return NULL;
@@ -76,7 +77,7 @@ cypher_astnode_t *cypher_ast_labels_operator(const cypher_astnode_t *expression,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
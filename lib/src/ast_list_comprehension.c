@@ -93,7 +93,7 @@ cypher_astnode_t *cypher_ast_list_comprehension(
             CYPHER_AST_EXPRESSION, NULL);
 
     struct list_comprehension *node =
-            calloc(1, sizeof(struct list_comprehension));
+            cp_astnode_calloc(sizeof(struct list_comprehension));
     if (node == NULL)
     {
         return NULL;
@@ -113,7 +113,7 @@ cypher_astnode_t *cypher_ast_list_comprehension(
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
@@ -57,7 +57,7 @@ cypher_astnode_t *cypher_ast_load_csv(bool with_headers,
     REQUIRE_CHILD_OPTIONAL(children, nchildren, field_terminator,
             CYPHER_AST_STRING, NULL);
 
-    struct loadcsv *node = calloc(1, sizeof(struct loadcsv));
+    struct loadcsv *node = cp_astnode_calloc(sizeof(struct loadcsv));
     if (node == NULL)
     {
         return NULL;
@@ -65,7 +65,7 @@ cypher_astnode_t *cypher_ast_load_csv(bool with_headers,
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_LOAD_CSV,
             children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->with_headers = with_headers;
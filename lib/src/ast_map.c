@@ -15,7 +15,9 @@
  * limitations under the License.
  */
 #include "../../config.h"
+#include "ast.h"
 #include "astnode.h"
+#include "key_index.h"
 #include "util.h"
 #include <assert.h>
 
@@ -24,13 +26,17 @@ struct map
 {
     cypher_astnode_t _astnode;
     size_t nentries;
+    atomic_uintptr_t index;
     const cypher_astnode_t *pairs[];
 };
 
 
+static void map_release(cypher_astnode_t *self);
 static cypher_astnode_t *clone(const cypher_astnode_t *self,
         cypher_astnode_t **children);
 static ssize_t detailstr(const cypher_astnode_t *self, char *str, size_t size);
+static const char *entry_key(const void *pairs, unsigned int i,
+        size_t *length);
 
 
 static const struct cypher_astnode_vt *parents[] =
@@ -41,7 +47,7 @@ const struct cypher_astnode_vt cypher_map_astnode_vt =
       .nparents = 1,
       .name = "map",
       .detailstr = detailstr,
-      .release = cypher_astnode_release,
+      .release = map_release,
       .clone = clone };
 
 
@@ -49,7 +55,7 @@ static struct map *map_init(unsigned int nentries,
         cypher_astnode_t **children, unsigned int nchildren,
         struct cypher_input_range range)
 {
-    struct map *node = calloc(1, sizeof(struct map) +
+    struct map *node = cp_astnode_calloc(sizeof(struct map) +
             nentries * 2 * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
@@ -66,12 +72,27 @@ static struct map *map_init(unsigned int nentries,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
 
 
+static cypher_astnode_t *map_index(struct map *node,
+        cp_key_index_duplicate_t duplicate, void *userdata)
+{
+    if (cp_key_index_init(&(node->index), node->nentries, entry_key,
+                node->pairs, duplicate, userdata))
+    {
+        int errsv = errno;
+        cypher_astnode_free(&(node->_astnode));
+        errno = errsv;
+        return NULL;
+    }
+    return &(node->_astnode);
+}
+
+
 cypher_astnode_t *cypher_ast_map(cypher_astnode_t * const *keys,
         cypher_astnode_t * const *values, unsigned int nentries,
         cypher_astnode_t **children, unsigned int nchildren,
@@ -91,13 +112,23 @@ cypher_astnode_t *cypher_ast_map(cypher_astnode_t * const *keys,
         node->pairs[i*2] = keys[i];
         node->pairs[i*2 + 1] = values[i];
     }
-    return &(node->_astnode);
+    return map_index(node, NULL, NULL);
 }
 
 
 cypher_astnode_t *cypher_ast_pair_map(cypher_astnode_t * const *pairs,
         unsigned int nentries, cypher_astnode_t **children,
         unsigned int nchildren, struct cypher_input_range range)
+{
+    return cp_ast_pair_map(pairs, nentries, children, nchildren, range,
+            NULL, NULL);
+}
+
+
+cypher_astnode_t *cp_ast_pair_map(cypher_astnode_t * const *pairs,
+        unsigned int nentries, cypher_astnode_t **children,
+        unsigned int nchildren, struct cypher_input_range range,
+        cp_key_index_duplicate_t duplicate, void *userdata)
 {
     for (unsigned int i = 0; i < nentries; ++i)
     {
@@ -111,7 +142,15 @@ cypher_astnode_t *cypher_ast_pair_map(cypher_astnode_t * const *pairs,
         return NULL;
     }
     memcpy(node->pairs, pairs, nentries * 2 * sizeof(cypher_astnode_t *));
-    return &(node->_astnode);
+    return map_index(node, duplicate, userdata);
+}
+
+
+void map_release(cypher_astnode_t *self)
+{
+    struct map *node = container_of(self, struct map, _astnode);
+    cp_key_index_free(&(node->index));
+    cypher_astnode_release(self);
 }
 
 
@@ -121,13 +160,13 @@ cypher_astnode_t *clone(const cypher_astnode_t *self,
     REQUIRE_TYPE(self, CYPHER_AST_MAP, NULL);
     struct map *node = container_of(self, struct map, _astnode);
 
-    cypher_astnode_t **pairs = calloc(node->nentries,
+    cypher_astnode_t **pairs = calloc(node->nentries * 2,
             sizeof(cypher_astnode_t *));
     if (pairs == NULL)
     {
         return NULL;
     }
-    for (unsigned int i = 0; i < node->nentries; ++i)
+    for (unsigned int i = 0; i < node->nentries * 2; ++i)
     {
         pairs[i] = children[child_index(self, node->pairs[i])];
     }
@@ -175,6 +214,28 @@ const cypher_astnode_t *cypher_ast_map_get_value(const cypher_astnode_t *astnode
 }
 
 
+const cypher_astnode_t *cypher_ast_map_find(const cypher_astnode_t *astnode,
+        const char *name, size_t n)
+{
+    REQUIRE_TYPE(astnode, CYPHER_AST_MAP, NULL);
+    REQUIRE(name != NULL, NULL);
+    struct map *node = container_of(astnode, struct map, _astnode);
+    const struct cp_key_index *index = cp_key_index_get(&(node->index),
+            node->nentries, entry_key, node->pairs);
+    int i = cp_key_index_find(index, node->nentries, entry_key,
+            node->pairs, name, n);
+    return (i < 0)? NULL : node->pairs[i*2 + 1];
+}
+
+
+const char *entry_key(const void *pairs, unsigned int i, size_t *length)
+{
+    const cypher_astnode_t *key = ((const cypher_astnode_t * const *)pairs)[i*2];
+    *length = cypher_ast_prop_name_get_value_len(key);
+    return cypher_ast_prop_name_get_value(key);
+}
+
+
 ssize_t detailstr(const cypher_astnode_t *self, char *str, size_t size)
 {
     REQUIRE_TYPE(self, CYPHER_AST_MAP, -1);
@@ -15,7 +15,9 @@
  * limitations under the License.
  */
 #include "../../config.h"
+#include "ast.h"
 #include "astnode.h"
+#include "key_index.h"
 #include "operators.h"
 #include "util.h"
 #include <assert.h>
@@ -26,13 +28,17 @@ struct map_projection
     cypher_astnode_t _astnode;
     const cypher_astnode_t *expression;
     unsigned int nselectors;
+    atomic_uintptr_t index;
     const cypher_astnode_t *selectors[];
 };
 
 
+static void map_projection_release(cypher_astnode_t *self);
 static cypher_astnode_t *clone(const cypher_astnode_t *self,
         cypher_astnode_t **children);
 static ssize_t detailstr(const cypher_astnode_t *self, char *str, size_t size);
+static const char *selector_key(const void *selectors, unsigned int i,
+        size_t *length);
 
 
 static const struct cypher_astnode_vt *parents[] =
@@ -43,7 +49,7 @@ const struct cypher_astnode_vt cypher_map_projection_astnode_vt =
       .nparents = 1,
       .name = "map projection",
       .detailstr = detailstr,
-      .release = cypher_astnode_release,
+      .release = map_projection_release,
       .clone = clone };
 
 
@@ -52,11 +58,23 @@ cypher_astnode_t *cypher_ast_map_projection(
         cypher_astnode_t * const *selectors, unsigned int nselectors,
         cypher_astnode_t **children, unsigned int nchildren,
         struct cypher_input_range range)
+{
+    return cp_ast_map_projection(expression, selectors, nselectors,
+            children, nchildren, range, NULL, NULL);
+}
+
+
+cypher_astnode_t *cp_ast_map_projection(const cypher_astnode_t *expression,
+        cypher_astnode_t * const *selectors, unsigned int nselectors,
+        cypher_astnode_t **children, unsigned int nchildren,
+        struct cypher_input_range range, cp_key_index_duplicate_t duplicate,
+        void *userdata)
 {
     REQUIRE_CHILD(children, nchildren, expression, CYPHER_AST_EXPRESSION, NULL);
 
-    struct map_projection *node = calloc(1, sizeof(struct map_projection) +
-            nselectors * sizeof(cypher_astnode_t *));
+    struct map_projection *node =
+            cp_astnode_calloc(sizeof(struct map_projection) +
+                nselectors * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
         return NULL;
@@ -64,16 +82,33 @@ cypher_astnode_t *cypher_ast_map_projection(
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_MAP_PROJECTION,
             children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->expression = expression;
     memcpy(node->selectors, selectors, nselectors * sizeof(cypher_astnode_t *));
     node->nselectors = nselectors;
+    if (cp_key_index_init(&(node->index), nselectors, selector_key,
+                node->selectors, duplicate, userdata))
+    {
+        int errsv = errno;
+        cypher_astnode_free(&(node->_astnode));
+        errno = errsv;
+        return NULL;
+    }
     return &(node->_astnode);
 }
 
 
+void map_projection_release(cypher_astnode_t *self)
+{
+    struct map_projection *node =
+            container_of(self, struct map_projection, _astnode);
+    cp_key_index_free(&(node->index));
+    cypher_astnode_release(self);
+}
+
+
 cypher_astnode_t *clone(const cypher_astnode_t *self,
         cypher_astnode_t **children)
 {
@@ -137,6 +172,54 @@ const cypher_astnode_t *cypher_ast_map_projection_get_selector(
 }
 
 
+const cypher_astnode_t *cypher_ast_map_projection_find(
+        const cypher_astnode_t *astnode, const char *name, size_t n)
+{
+    REQUIRE_TYPE(astnode, CYPHER_AST_MAP_PROJECTION, NULL);
+    REQUIRE(name != NULL, NULL);
+    struct map_projection *node =
+            container_of(astnode, struct map_projection, _astnode);
+    const struct cp_key_index *index = cp_key_index_get(&(node->index),
+            node->nselectors, selector_key, node->selectors);
+    int i = cp_key_index_find(index, node->nselectors, selector_key,
+            node->selectors, name, n);
+    return (i < 0)? NULL : node->selectors[i];
+}
+
+
+const char *selector_key(const void *selectors, unsigned int i,
+        size_t *length)
+{
+    const cypher_astnode_t *selector =
+            ((const cypher_astnode_t * const *)selectors)[i];
+    const cypher_astnode_t *name;
+    if (cypher_astnode_instanceof(selector,
+                CYPHER_AST_MAP_PROJECTION_LITERAL))
+    {
+        name = cypher_ast_map_projection_literal_get_prop_name(selector);
+    }
+    else if (cypher_astnode_instanceof(selector,
+                CYPHER_AST_MAP_PROJECTION_PROPERTY))
+    {
+        name = cypher_ast_map_projection_property_get_prop_name(selector);
+    }
+    else if (cypher_astnode_instanceof(selector,
+                CYPHER_AST_MAP_PROJECTION_IDENTIFIER))
+    {
+        const cypher_astnode_t *identifier =
+                cypher_ast_map_projection_identifier_get_identifier(selector);
+        *length = cypher_ast_identifier_get_name_len(identifier);
+        return cypher_ast_identifier_get_name(identifier);
+    }
+    else
+    {
+        return NULL;
+    }
+    *length = cypher_ast_prop_name_get_value_len(name);
+    return cypher_ast_prop_name_get_value(name);
+}
+
+
 ssize_t detailstr(const cypher_astnode_t *self, char *str, size_t size)
 {
     REQUIRE_TYPE(self, CYPHER_AST_MAP_PROJECTION, -1);
@@ -48,7 +48,7 @@ cypher_astnode_t *cypher_ast_map_projection_all_properties(
         struct cypher_input_range range)
 {
     struct map_projection_all_properties *node =
-            calloc(1, sizeof(struct map_projection_all_properties));
+            cp_astnode_calloc(sizeof(struct map_projection_all_properties));
     if (node == NULL)
     {
         return NULL;
@@ -57,7 +57,7 @@ cypher_astnode_t *cypher_ast_map_projection_all_properties(
             CYPHER_AST_MAP_PROJECTION_ALL_PROPERTIES,
             children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     return &(node->_astnode);
@@ -52,7 +52,7 @@ cypher_astnode_t *cypher_ast_map_projection_identifier(
     REQUIRE_CHILD(children, nchildren, identifier, CYPHER_AST_IDENTIFIER, NULL);
 
     struct map_projection_identifier *node =
-            calloc(1, sizeof(struct map_projection_identifier));
+            cp_astnode_calloc(sizeof(struct map_projection_identifier));
     if (node == NULL)
     {
         return NULL;
@@ -60,7 +60,7 @@ cypher_astnode_t *cypher_ast_map_projection_identifier(
     if (cypher_astnode_init(&(node->_astnode),
             CYPHER_AST_MAP_PROJECTION_IDENTIFIER, children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->identifier = identifier;
@@ -54,7 +54,7 @@ cypher_astnode_t *cypher_ast_map_projection_literal(
     REQUIRE_CHILD(children, nchildren, expression, CYPHER_AST_EXPRESSION, NULL);
 
     struct map_projection_literal *node =
-            calloc(1, sizeof(struct map_projection_literal));
+            cp_astnode_calloc(sizeof(struct map_projection_literal));
     if (node == NULL)
     {
         return NULL;
@@ -62,7 +62,7 @@ cypher_astnode_t *cypher_ast_map_projection_literal(
     if (cypher_astnode_init(&(node->_astnode),
             CYPHER_AST_MAP_PROJECTION_LITERAL, children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->prop_name = prop_name;
@@ -52,7 +52,7 @@ cypher_astnode_t *cypher_ast_map_projection_property(
     REQUIRE_CHILD(children, nchildren, prop_name, CYPHER_AST_PROP_NAME, NULL);
 
     struct map_projection_property *node =
-            calloc(1, sizeof(struct map_projection_property));
+            cp_astnode_calloc(sizeof(struct map_projection_property));
     if (node == NULL)
     {
         return NULL;
@@ -60,7 +60,7 @@ cypher_astnode_t *cypher_ast_map_projection_property(
     if (cypher_astnode_init(&(node->_astnode),
             CYPHER_AST_MAP_PROJECTION_PROPERTY, children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->prop_name = prop_name;
@@ -60,7 +60,7 @@ cypher_astnode_t *cypher_ast_match(bool optional,
     REQUIRE_CHILD_OPTIONAL(children, nchildren, predicate,
             CYPHER_AST_EXPRESSION, NULL);
 
-    struct match *node = calloc(1, sizeof(struct match) +
+    struct match *node = cp_astnode_calloc(sizeof(struct match) +
             nhints * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
@@ -81,7 +81,7 @@ cypher_astnode_t *cypher_ast_match(bool optional,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
@@ -55,7 +55,7 @@ cypher_astnode_t *cypher_ast_merge(const cypher_astnode_t *path,
     REQUIRE_CHILD_ALL(children, nchildren, actions, nactions,
             CYPHER_AST_MERGE_ACTION, NULL);
 
-    struct merge *node = calloc(1, sizeof(struct merge) +
+    struct merge *node = cp_astnode_calloc(sizeof(struct merge) +
             nactions * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
@@ -74,7 +74,7 @@ cypher_astnode_t *cypher_ast_merge(const cypher_astnode_t *path,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
@@ -53,7 +53,8 @@ cypher_astnode_t *cypher_ast_merge_properties(
     REQUIRE_CHILD(children, nchildren, identifier, CYPHER_AST_IDENTIFIER, NULL);
     REQUIRE_CHILD(children, nchildren, expression, CYPHER_AST_EXPRESSION, NULL);
 
-    struct merge_properties *node = calloc(1, sizeof(struct merge_properties));
+    struct merge_properties *node =
+            cp_astnode_calloc(sizeof(struct merge_properties));
     if (node == NULL)
     {
         return NULL;
@@ -61,7 +62,7 @@ cypher_astnode_t *cypher_ast_merge_properties(
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_MERGE_PROPERTIES,
             children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->identifier = identifier;
@@ -59,7 +59,7 @@ cypher_astnode_t *cypher_ast_named_path(const cypher_astnode_t *identifier,
     REQUIRE_CHILD(children, nchildren, identifier, CYPHER_AST_IDENTIFIER, NULL);
     REQUIRE_CHILD(children, nchildren, path, CYPHER_AST_PATTERN_PATH, NULL);
 
-    struct named_path *node = calloc(1, sizeof(struct named_path));
+    struct named_path *node = cp_astnode_calloc(sizeof(struct named_path));
     if (node == NULL)
     {
         return NULL;
@@ -67,7 +67,7 @@ cypher_astnode_t *cypher_ast_named_path(const cypher_astnode_t *identifier,
     if (cypher_pattern_path_astnode_init(&(node->_pattern_path_astnode),
                 CYPHER_AST_NAMED_PATH, &pp_vt, children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->identifier = identifier;
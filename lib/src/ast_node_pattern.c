@@ -55,7 +55,7 @@ cypher_astnode_t *cypher_ast_node_pattern(const cypher_astnode_t *identifier,
             cypher_astnode_instanceof(properties, CYPHER_AST_PARAMETER), NULL);
     REQUIRE_CONTAINS_OPTIONAL(children, nchildren, properties, NULL);
 
-    struct node_pattern *node = calloc(1, sizeof(struct node_pattern) +
+    struct node_pattern *node = cp_astnode_calloc(sizeof(struct node_pattern) +
             nlabels * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
@@ -75,7 +75,7 @@ cypher_astnode_t *cypher_ast_node_pattern(const cypher_astnode_t *identifier,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
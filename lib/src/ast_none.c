@@ -70,7 +70,7 @@ cypher_astnode_t *cypher_ast_none(const cypher_astnode_t *identifier,
     REQUIRE_CHILD(children, nchildren, expression, CYPHER_AST_EXPRESSION, NULL);
     REQUIRE_CHILD_OPTIONAL(children, nchildren, predicate, CYPHER_AST_EXPRESSION, NULL);
 
-    struct none *node = calloc(1, sizeof(struct none));
+    struct none *node = cp_astnode_calloc(sizeof(struct none));
     if (node == NULL)
     {
         return NULL;
@@ -78,7 +78,7 @@ cypher_astnode_t *cypher_ast_none(const cypher_astnode_t *identifier,
     if (cypher_list_comprehension_astnode_init(&(node->_list_comprehension_astnode),
             CYPHER_AST_NONE, &lc_vt, children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->identifier = identifier;
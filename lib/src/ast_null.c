@@ -46,7 +46,7 @@ const struct cypher_astnode_vt cypher_null_astnode_vt =
 
 cypher_astnode_t *cypher_ast_null(struct cypher_input_range range)
 {
-    struct null_literal *node = calloc(1, sizeof(struct null_literal));
+    struct null_literal *node = cp_astnode_calloc(sizeof(struct null_literal));
     if (node == NULL)
     {
         return NULL;
@@ -54,7 +54,7 @@ cypher_astnode_t *cypher_ast_null(struct cypher_input_range range)
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_NULL,
             NULL, 0, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     return &(node->_astnode);
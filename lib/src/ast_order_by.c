@@ -48,7 +48,7 @@ cypher_astnode_t *cypher_ast_order_by(cypher_astnode_t * const *items,
     REQUIRE_CHILD_ALL(children, nchildren, items, nitems,
             CYPHER_AST_SORT_ITEM, NULL);
 
-    struct order_by *node = calloc(1, sizeof(struct order_by) +
+    struct order_by *node = cp_astnode_calloc(sizeof(struct order_by) +
             nitems * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
@@ -66,7 +66,7 @@ cypher_astnode_t *cypher_ast_order_by(cypher_astnode_t * const *items,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
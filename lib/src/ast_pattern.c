@@ -48,7 +48,7 @@ cypher_astnode_t *cypher_ast_pattern(cypher_astnode_t * const *paths,
     REQUIRE_CHILD_ALL(children, nchildren, paths, npaths,
             CYPHER_AST_PATTERN_PATH, NULL);
 
-    struct pattern *node = calloc(1, sizeof(struct pattern) +
+    struct pattern *node = cp_astnode_calloc(sizeof(struct pattern) +
             npaths * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
@@ -66,7 +66,7 @@ cypher_astnode_t *cypher_ast_pattern(cypher_astnode_t * const *paths,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
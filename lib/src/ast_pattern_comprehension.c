@@ -61,7 +61,7 @@ cypher_astnode_t *cypher_ast_pattern_comprehension(
     REQUIRE_CHILD(children, nchildren, eval, CYPHER_AST_EXPRESSION, NULL);
 
     struct pattern_comprehension *node =
-            calloc(1, sizeof(struct pattern_comprehension));
+            cp_astnode_calloc(sizeof(struct pattern_comprehension));
     if (node == NULL)
     {
         return NULL;
@@ -69,7 +69,7 @@ cypher_astnode_t *cypher_ast_pattern_comprehension(
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_PATTERN_COMPREHENSION,
                 children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
 
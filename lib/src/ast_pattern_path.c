@@ -81,7 +81,7 @@ cypher_astnode_t *cypher_ast_pattern_path(cypher_astnode_t * const *elements,
                 NULL);
     }
 
-    struct pattern_path *node = calloc(1, sizeof(struct pattern_path) +
+    struct pattern_path *node = cp_astnode_calloc(sizeof(struct pattern_path) +
             nelements * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
@@ -99,7 +99,7 @@ cypher_astnode_t *cypher_ast_pattern_path(cypher_astnode_t * const *elements,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
@@ -23,6 +23,9 @@
 struct proc_name
 {
     cypher_astnode_t _astnode;
+    int id;
+    uint_fast32_t flags;
+    size_t n;
     char p[];
 };
 
@@ -42,17 +45,28 @@ const struct cypher_astnode_vt cypher_proc_name_astnode_vt =
 cypher_astnode_t *cypher_ast_proc_name(const char *s, size_t n,
         struct cypher_input_range range)
 {
-    struct proc_name *node = calloc(1, sizeof(struct proc_name) + n+1);
+    return cp_ast_proc_name(s, n, -1, 0, range);
+}
+
+
+cypher_astnode_t *cp_ast_proc_name(const char *s, size_t n, int id,
+        uint_fast32_t flags, struct cypher_input_range range)
+{
+    struct proc_name *node =
+            cp_astnode_calloc(sizeof(struct proc_name) + n+1);
     if (node == NULL)
     {
         return NULL;
     }
-    if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_PROC_NAME, NULL, 0,
-                range))
+    if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_PROC_NAME,
+                NULL, 0, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
+    node->id = id;
+    node->flags = flags;
+    node->n = n;
     memcpy(node->p, s, n);
     node->p[n] = '\0';
     return &(node->_astnode);
@@ -63,22 +77,53 @@ cypher_astnode_t *clone(const cypher_astnode_t *self,
         cypher_astnode_t **children)
 {
     REQUIRE_TYPE(self, CYPHER_AST_PROC_NAME, NULL);
-    struct proc_name *node = container_of(self, struct proc_name, _astnode);
-    return cypher_ast_proc_name(node->p, strlen(node->p), self->range);
+    struct proc_name *node =
+            container_of(self, struct proc_name, _astnode);
+    return cp_ast_proc_name(node->p, node->n, node->id,
+            node->flags, self->range);
 }
 
 
 const char *cypher_ast_proc_name_get_value(const cypher_astnode_t *astnode)
 {
     REQUIRE_TYPE(astnode, CYPHER_AST_PROC_NAME, NULL);
-    struct proc_name *node = container_of(astnode, struct proc_name, _astnode);
+    struct proc_name *node =
+            container_of(astnode, struct proc_name, _astnode);
     return node->p;
 }
 
 
+size_t cypher_ast_proc_name_get_value_len(const cypher_astnode_t *astnode)
+{
+    REQUIRE_TYPE(astnode, CYPHER_AST_PROC_NAME, 0);
+    struct proc_name *node =
+            container_of(astnode, struct proc_name, _astnode);
+    return node->n;
+}
+
+
+int cypher_ast_proc_name_get_id(const cypher_astnode_t *astnode)
+{
+    REQUIRE_TYPE(astnode, CYPHER_AST_PROC_NAME, -1);
+    struct proc_name *node =
+            container_of(astnode, struct proc_name, _astnode);
+    return node->id;
+}
+
+
+uint_fast32_t cypher_ast_proc_name_get_flags(const cypher_astnode_t *astnode)
+{
+    REQUIRE_TYPE(astnode, CYPHER_AST_PROC_NAME, 0);
+    struct proc_name *node =
+            container_of(astnode, struct proc_name, _astnode);
+    return node->flags;
+}
+
+
 ssize_t detailstr(const cypher_astnode_t *self, char *str, size_t size)
 {
     REQUIRE_TYPE(self, CYPHER_AST_PROC_NAME, -1);
-    struct proc_name *node = container_of(self, struct proc_name, _astnode);
+    struct proc_name *node =
+            container_of(self, struct proc_name, _astnode);
     return snprintf(str, size, "`%s`", node->p);
 }
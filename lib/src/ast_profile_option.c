@@ -46,7 +46,8 @@ const struct cypher_astnode_vt cypher_profile_option_astnode_vt =
 
 cypher_astnode_t *cypher_ast_profile_option(struct cypher_input_range range)
 {
-    struct profile_option *node = calloc(1, sizeof(struct profile_option));
+    struct profile_option *node =
+            cp_astnode_calloc(sizeof(struct profile_option));
     if (node == NULL)
     {
         return NULL;
@@ -54,7 +55,7 @@ cypher_astnode_t *cypher_ast_profile_option(struct cypher_input_range range)
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_PROFILE_OPTION,
             NULL, 0, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     return &(node->_astnode);
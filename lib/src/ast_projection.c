@@ -25,6 +25,7 @@ struct projection
     cypher_astnode_t _astnode;
     const cypher_astnode_t *expression;
     const cypher_astnode_t *alias;
+    bool aggregate;
 };
 
 
@@ -48,7 +49,7 @@ cypher_astnode_t *cypher_ast_projection(const cypher_astnode_t *expression,
     REQUIRE_CHILD_OPTIONAL(children, nchildren, alias,
             CYPHER_AST_IDENTIFIER, NULL);
 
-    struct projection *node = calloc(1, sizeof(struct projection));
+    struct projection *node = cp_astnode_calloc(sizeof(struct projection));
     if (node == NULL)
     {
         return NULL;
@@ -56,11 +57,13 @@ cypher_astnode_t *cypher_ast_projection(const cypher_astnode_t *expression,
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_PROJECTION,
             children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->expression = expression;
     node->alias = alias;
+    node->aggregate = (cypher_astnode_attributes(expression) &
+            CYPHER_AST_HAS_AGGREGATE) != 0;
     return &(node->_astnode);
 }
 
@@ -98,6 +101,14 @@ const cypher_astnode_t *cypher_ast_projection_get_alias(
 }
 
 
+bool cypher_ast_projection_has_aggregate(const cypher_astnode_t *astnode)
+{
+    REQUIRE_TYPE(astnode, CYPHER_AST_PROJECTION, false);
+    struct projection *node = container_of(astnode, struct projection, _astnode);
+    return node->aggregate;
+}
+
+
 ssize_t detailstr(const cypher_astnode_t *self, char *str, size_t size)
 {
     REQUIRE_TYPE(self, CYPHER_AST_PROJECTION, -1);
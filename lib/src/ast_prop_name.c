@@ -23,6 +23,7 @@
 struct prop_name
 {
     cypher_astnode_t _astnode;
+    size_t n;
     char p[];
 };
 
@@ -42,7 +43,7 @@ const struct cypher_astnode_vt cypher_prop_name_astnode_vt =
 cypher_astnode_t *cypher_ast_prop_name(const char *s, size_t n,
         struct cypher_input_range range)
 {
-    struct prop_name *node = calloc(1, sizeof(struct prop_name) + n+1);
+    struct prop_name *node = cp_astnode_calloc(sizeof(struct prop_name) + n+1);
     if (node == NULL)
     {
         return NULL;
@@ -50,9 +51,10 @@ cypher_astnode_t *cypher_ast_prop_name(const char *s, size_t n,
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_PROP_NAME, NULL, 0,
                 range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
+    node->n = n;
     memcpy(node->p, s, n);
     node->p[n] = '\0';
     return &(node->_astnode);
@@ -64,7 +66,7 @@ cypher_astnode_t *clone(const cypher_astnode_t *self,
 {
     REQUIRE_TYPE(self, CYPHER_AST_PROP_NAME, NULL);
     struct prop_name *node = container_of(self, struct prop_name, _astnode);
-    return cypher_ast_prop_name(node->p, strlen(node->p), self->range);
+    return cypher_ast_prop_name(node->p, node->n, self->range);
 }
 
 
@@ -76,6 +78,14 @@ const char *cypher_ast_prop_name_get_value(const cypher_astnode_t *astnode)
 }
 
 
+size_t cypher_ast_prop_name_get_value_len(const cypher_astnode_t *astnode)
+{
+    REQUIRE_TYPE(astnode, CYPHER_AST_PROP_NAME, 0);
+    struct prop_name *node = container_of(astnode, struct prop_name, _astnode);
+    return node->n;
+}
+
+
 ssize_t detailstr(const cypher_astnode_t *self, char *str, size_t size)
 {
     REQUIRE_TYPE(self, CYPHER_AST_PROP_NAME, -1);
@@ -55,7 +55,7 @@ cypher_astnode_t *cypher_ast_property_operator(
     REQUIRE_CHILD(children, nchildren, prop_name, CYPHER_AST_PROP_NAME, NULL);
 
     struct property_operator *node =
-            calloc(1, sizeof(struct property_operator));
+            cp_astnode_calloc(sizeof(struct property_operator));
     if (node == NULL)
     {
         return NULL;
@@ -63,7 +63,7 @@ cypher_astnode_t *cypher_ast_property_operator(
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_PROPERTY_OPERATOR,
                 children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->expression = expression;
@@ -54,7 +54,7 @@ cypher_astnode_t *cypher_ast_query(cypher_astnode_t * const *options,
     REQUIRE_CHILD_ALL(children, nchildren, clauses, nclauses,
             CYPHER_AST_QUERY_CLAUSE, NULL);
 
-    struct query *node = calloc(1, sizeof(struct query) +
+    struct query *node = cp_astnode_calloc(sizeof(struct query) +
             nclauses * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
@@ -67,7 +67,8 @@ cypher_astnode_t *cypher_ast_query(cypher_astnode_t * const *options,
     }
     if (noptions > 0)
     {
-        node->options = mdup(options, noptions * sizeof(cypher_astnode_t *));
+        node->options = cp_astnode_mdup(options,
+                noptions * sizeof(cypher_astnode_t *));
         if (node->options == NULL)
         {
             goto cleanup;
@@ -81,7 +82,7 @@ cypher_astnode_t *cypher_ast_query(cypher_astnode_t * const *options,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
@@ -127,7 +128,7 @@ cypher_astnode_t *clone(const cypher_astnode_t *self,
 void query_release(cypher_astnode_t *self)
 {
     struct query *node = container_of(self, struct query, _astnode);
-    free(node->options);
+    cp_astnode_free(node->options);
     cypher_astnode_release(self);
 }
 
@@ -48,7 +48,7 @@ cypher_astnode_t *cypher_ast_range(const cypher_astnode_t *start,
     REQUIRE_CHILD_OPTIONAL(children, nchildren, start, CYPHER_AST_INTEGER, NULL);
     REQUIRE_CHILD_OPTIONAL(children, nchildren, end, CYPHER_AST_INTEGER, NULL);
 
-    struct range *node = calloc(1, sizeof(struct range));
+    struct range *node = cp_astnode_calloc(sizeof(struct range));
     if (node == NULL)
     {
         return NULL;
@@ -56,7 +56,7 @@ cypher_astnode_t *cypher_ast_range(const cypher_astnode_t *start,
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_RANGE,
             children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->start = start;
@@ -61,7 +61,7 @@ cypher_astnode_t *cypher_ast_reduce(const cypher_astnode_t *accumulator,
     REQUIRE_CHILD(children, nchildren, expression, CYPHER_AST_EXPRESSION, NULL);
     REQUIRE_CHILD_OPTIONAL(children, nchildren, eval, CYPHER_AST_EXPRESSION, NULL);
 
-    struct reduce *node = calloc(1, sizeof(struct reduce));
+    struct reduce *node = cp_astnode_calloc(sizeof(struct reduce));
     if (node == NULL)
     {
         return NULL;
@@ -69,7 +69,7 @@ cypher_astnode_t *cypher_ast_reduce(const cypher_astnode_t *accumulator,
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_REDUCE,
             children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->accumulator = accumulator;
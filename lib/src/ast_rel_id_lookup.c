@@ -55,8 +55,9 @@ cypher_astnode_t *cypher_ast_rel_id_lookup(const cypher_astnode_t *identifier,
     REQUIRE(nids > 0, NULL);
     REQUIRE_CHILD_ALL(children, nchildren, ids, nids, CYPHER_AST_INTEGER, NULL);
 
-    struct rel_id_lookup *node = calloc(1, sizeof(struct rel_id_lookup) +
-            nids * sizeof(cypher_astnode_t *));
+    struct rel_id_lookup *node =
+            cp_astnode_calloc(sizeof(struct rel_id_lookup) +
+                nids * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
         return NULL;
@@ -74,7 +75,7 @@ cypher_astnode_t *cypher_ast_rel_id_lookup(const cypher_astnode_t *identifier,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
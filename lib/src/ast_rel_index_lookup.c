@@ -60,7 +60,8 @@ cypher_astnode_t *cypher_ast_rel_index_lookup(
             cypher_astnode_instanceof(lookup, CYPHER_AST_PARAMETER), NULL);
     REQUIRE_CONTAINS(children, nchildren, lookup, NULL);
 
-    struct rel_index_lookup *node = calloc(1, sizeof(struct rel_index_lookup));
+    struct rel_index_lookup *node =
+            cp_astnode_calloc(sizeof(struct rel_index_lookup));
     if (node == NULL)
     {
         return NULL;
@@ -68,7 +69,7 @@ cypher_astnode_t *cypher_ast_rel_index_lookup(
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_REL_INDEX_LOOKUP,
             children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->identifier = identifier;
@@ -57,7 +57,8 @@ cypher_astnode_t *cypher_ast_rel_index_query(
             cypher_astnode_instanceof(query, CYPHER_AST_PARAMETER), NULL);
     REQUIRE_CONTAINS(children, nchildren, query, NULL);
 
-    struct rel_index_query *node = calloc(1, sizeof(struct rel_index_query));
+    struct rel_index_query *node =
+            cp_astnode_calloc(sizeof(struct rel_index_query));
     if (node == NULL)
     {
         return NULL;
@@ -65,7 +66,7 @@ cypher_astnode_t *cypher_ast_rel_index_query(
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_REL_INDEX_QUERY,
             children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->identifier = identifier;
@@ -61,7 +61,7 @@ cypher_astnode_t *cypher_ast_rel_pattern(enum cypher_rel_direction direction,
     REQUIRE_CHILD_OPTIONAL(children, nchildren, varlength,
             CYPHER_AST_RANGE, NULL);
 
-    struct rel_pattern *node = calloc(1, sizeof(struct rel_pattern) +
+    struct rel_pattern *node = cp_astnode_calloc(sizeof(struct rel_pattern) +
             nreltypes * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
@@ -83,7 +83,7 @@ cypher_astnode_t *cypher_ast_rel_pattern(enum cypher_rel_direction direction,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
@@ -23,6 +23,7 @@
 struct reltype
 {
     cypher_astnode_t _astnode;
+    size_t n;
     char p[];
 };
 
@@ -42,7 +43,7 @@ const struct cypher_astnode_vt cypher_reltype_astnode_vt =
 cypher_astnode_t *cypher_ast_reltype(const char *s, size_t n,
         struct cypher_input_range range)
 {
-    struct reltype *node = calloc(1, sizeof(struct reltype) + n+1);
+    struct reltype *node = cp_astnode_calloc(sizeof(struct reltype) + n+1);
     if (node == NULL)
     {
         return NULL;
@@ -50,9 +51,10 @@ cypher_astnode_t *cypher_ast_reltype(const char *s, size_t n,
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_RELTYPE, NULL, 0,
                 range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
+    node->n = n;
     memcpy(node->p, s, n);
     node->p[n] = '\0';
     return &(node->_astnode);
@@ -64,7 +66,7 @@ cypher_astnode_t *clone(const cypher_astnode_t *self,
 {
     REQUIRE_TYPE(self, CYPHER_AST_RELTYPE, NULL);
     struct reltype *node = container_of(self, struct reltype, _astnode);
-    return cypher_ast_reltype(node->p, strlen(node->p), self->range);
+    return cypher_ast_reltype(node->p, node->n, self->range);
 }
 
 
@@ -76,6 +78,14 @@ const char *cypher_ast_reltype_get_name(const cypher_astnode_t *astnode)
 }
 
 
+size_t cypher_ast_reltype_get_name_len(const cypher_astnode_t *astnode)
+{
+    REQUIRE_TYPE(astnode, CYPHER_AST_RELTYPE, 0);
+    struct reltype *node = container_of(astnode, struct reltype, _astnode);
+    return node->n;
+}
+
+
 ssize_t detailstr(const cypher_astnode_t *self, char *str, size_t size)
 {
     REQUIRE_TYPE(self, CYPHER_AST_RELTYPE, -1);
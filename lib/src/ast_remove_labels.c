@@ -56,8 +56,9 @@ cypher_astnode_t *cypher_ast_remove_labels(const cypher_astnode_t *identifier,
     REQUIRE_CHILD_ALL(children, nchildren, labels, nlabels,
             CYPHER_AST_LABEL, NULL);
 
-    struct remove_labels *node = calloc(1, sizeof(struct remove_labels) +
-            nlabels * sizeof(cypher_astnode_t *));
+    struct remove_labels *node =
+            cp_astnode_calloc(sizeof(struct remove_labels) +
+                nlabels * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
         return NULL;
@@ -75,7 +76,7 @@ cypher_astnode_t *cypher_ast_remove_labels(const cypher_astnode_t *identifier,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
@@ -66,8 +66,9 @@ cypher_astnode_t *cypher_ast_return(bool distinct, bool include_existing,
     REQUIRE_CHILD_OPTIONAL(children, nchildren, limit,
             CYPHER_AST_EXPRESSION, NULL);
 
-    struct return_clause *node = calloc(1, sizeof(struct return_clause) +
-            nprojections * sizeof(cypher_astnode_t *));
+    struct return_clause *node =
+            cp_astnode_calloc(sizeof(struct return_clause) +
+                nprojections * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
         return NULL;
@@ -90,7 +91,7 @@ cypher_astnode_t *cypher_ast_return(bool distinct, bool include_existing,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
@@ -53,7 +53,7 @@ cypher_astnode_t *cypher_ast_set(cypher_astnode_t * const *items,
     REQUIRE_CHILD_ALL(children, nchildren, items, nitems,
             CYPHER_AST_SET_ITEM, NULL);
 
-    struct set *node = calloc(1, sizeof(struct set) +
+    struct set *node = cp_astnode_calloc(sizeof(struct set) +
             nitems * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
@@ -71,7 +71,7 @@ cypher_astnode_t *cypher_ast_set(cypher_astnode_t * const *items,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
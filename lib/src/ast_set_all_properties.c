@@ -54,7 +54,7 @@ cypher_astnode_t *cypher_ast_set_all_properties(
     REQUIRE_CHILD(children, nchildren, expression, CYPHER_AST_EXPRESSION, NULL);
 
     struct set_all_properties *node =
-            calloc(1, sizeof(struct set_all_properties));
+            cp_astnode_calloc(sizeof(struct set_all_properties));
     if (node == NULL)
     {
         return NULL;
@@ -62,7 +62,7 @@ cypher_astnode_t *cypher_ast_set_all_properties(
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_SET_ALL_PROPERTIES,
             children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->identifier = identifier;
@@ -56,7 +56,7 @@ cypher_astnode_t *cypher_ast_set_labels(const cypher_astnode_t *identifier,
     REQUIRE_CHILD_ALL(children, nchildren, labels, nlabels,
             CYPHER_AST_LABEL, NULL);
 
-    struct set_labels *node = calloc(1, sizeof(struct set_labels) +
+    struct set_labels *node = cp_astnode_calloc(sizeof(struct set_labels) +
             nlabels * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
@@ -75,7 +75,7 @@ cypher_astnode_t *cypher_ast_set_labels(const cypher_astnode_t *identifier,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
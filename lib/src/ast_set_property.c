@@ -53,7 +53,7 @@ cypher_astnode_t *cypher_ast_set_property(const cypher_astnode_t *property,
             CYPHER_AST_PROPERTY_OPERATOR, NULL);
     REQUIRE_CHILD(children, nchildren, expression, CYPHER_AST_EXPRESSION, NULL);
 
-    struct set_property *node = calloc(1, sizeof(struct set_property));
+    struct set_property *node = cp_astnode_calloc(sizeof(struct set_property));
     if (node == NULL)
     {
         return NULL;
@@ -61,7 +61,7 @@ cypher_astnode_t *cypher_ast_set_property(const cypher_astnode_t *property,
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_SET_PROPERTY,
             children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->property = property;
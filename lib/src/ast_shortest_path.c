@@ -58,7 +58,8 @@ cypher_astnode_t *cypher_ast_shortest_path(bool single,
 {
     REQUIRE_CHILD(children, nchildren, path, CYPHER_AST_PATTERN_PATH, NULL);
 
-    struct shortest_path *node = calloc(1, sizeof(struct shortest_path));
+    struct shortest_path *node =
+            cp_astnode_calloc(sizeof(struct shortest_path));
     if (node == NULL)
     {
         return NULL;
@@ -66,7 +67,7 @@ cypher_astnode_t *cypher_ast_shortest_path(bool single,
     if (cypher_pattern_path_astnode_init(&(node->_pattern_path_astnode),
                 CYPHER_AST_SHORTEST_PATH, &pp_vt, children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->single = single;
@@ -58,7 +58,8 @@ cypher_astnode_t *cypher_ast_slice_operator(const cypher_astnode_t *expression,
     REQUIRE_CHILD_OPTIONAL(children, nchildren, end,
             CYPHER_AST_EXPRESSION, NULL);
 
-    struct slice_operator *node = calloc(1, sizeof(struct slice_operator));
+    struct slice_operator *node =
+            cp_astnode_calloc(sizeof(struct slice_operator));
     if (node == NULL)
     {
         return NULL;
@@ -66,7 +67,7 @@ cypher_astnode_t *cypher_ast_slice_operator(const cypher_astnode_t *expression,
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_SLICE_OPERATOR,
             children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->expression = expression;
@@ -57,7 +57,7 @@ cypher_astnode_t *cypher_ast_start(cypher_astnode_t * const *points,
     REQUIRE_CHILD_OPTIONAL(children, nchildren, predicate,
             CYPHER_AST_EXPRESSION, NULL);
 
-    struct start *node = calloc(1, sizeof(struct start) +
+    struct start *node = cp_astnode_calloc(sizeof(struct start) +
             npoints * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
@@ -76,7 +76,7 @@ cypher_astnode_t *cypher_ast_start(cypher_astnode_t * const *points,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
@@ -24,6 +24,8 @@ struct statement
     cypher_astnode_t _astnode;
     const cypher_astnode_t *body;
     unsigned int noptions;
+    const cypher_astnode_t **params;
+    unsigned int nparams;
     const cypher_astnode_t *options[];
 };
 
@@ -52,8 +54,19 @@ cypher_astnode_t *cypher_ast_statement(cypher_astnode_t * const *options,
             cypher_astnode_instanceof(body, CYPHER_AST_STRING), NULL);
     REQUIRE_CONTAINS(children, nchildren, body, NULL);
 
-    struct statement *node = calloc(1, sizeof(struct statement) +
-            noptions * sizeof(cypher_astnode_t *));
+    // the parameters of every CYPHER option are gathered into the same
+    // allocation, following the options
+    unsigned int nparams = 0;
+    for (unsigned int i = 0; i < noptions; ++i)
+    {
+        if (cypher_astnode_instanceof(options[i], CYPHER_AST_CYPHER_OPTION))
+        {
+            nparams += cypher_ast_cypher_option_nparams(options[i]);
+        }
+    }
+
+    struct statement *node = cp_astnode_calloc(sizeof(struct statement) +
+            (noptions + nparams) * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
         return NULL;
@@ -65,13 +78,27 @@ cypher_astnode_t *cypher_ast_statement(cypher_astnode_t * const *options,
     }
     memcpy(node->options, options, noptions * sizeof(cypher_astnode_t *));
     node->noptions = noptions;
+    node->params = node->options + noptions;
+    for (unsigned int i = 0; i < noptions; ++i)
+    {
+        if (!cypher_astnode_instanceof(options[i], CYPHER_AST_CYPHER_OPTION))
+        {
+            continue;
+        }
+        unsigned int n = cypher_ast_cypher_option_nparams(options[i]);
+        for (unsigned int j = 0; j < n; ++j)
+        {
+            node->params[node->nparams++] =
+                    cypher_ast_cypher_option_get_param(options[i], j);
+        }
+    }
     node->body = body;
     return &(node->_astnode);
 
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
@@ -125,6 +152,27 @@ const cypher_astnode_t *cypher_ast_statement_get_option(
 }
 
 
+unsigned int cypher_ast_statement_nparams(const cypher_astnode_t *astnode)
+{
+    REQUIRE_TYPE(astnode, CYPHER_AST_STATEMENT, 0);
+    struct statement *node = container_of(astnode, struct statement, _astnode);
+    return node->nparams;
+}
+
+
+const cypher_astnode_t *cypher_ast_statement_get_param(
+        const cypher_astnode_t *astnode, unsigned int index)
+{
+    REQUIRE_TYPE(astnode, CYPHER_AST_STATEMENT, NULL);
+    struct statement *node = container_of(astnode, struct statement, _astnode);
+    if (index >= node->nparams)
+    {
+        return NULL;
+    }
+    return node->params[index];
+}
+
+
 const cypher_astnode_t *cypher_ast_statement_get_body(
         const cypher_astnode_t *astnode)
 {
@@ -55,7 +55,7 @@ cypher_astnode_t *cypher_ast_subscript_operator(
     REQUIRE_CHILD(children, nchildren, subscript, CYPHER_AST_EXPRESSION, NULL);
 
     struct subscript_operator *node =
-            calloc(1, sizeof(struct subscript_operator));
+            cp_astnode_calloc(sizeof(struct subscript_operator));
     if (node == NULL)
     {
         return NULL;
@@ -63,7 +63,7 @@ cypher_astnode_t *cypher_ast_subscript_operator(
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_SUBSCRIPT_OPERATOR,
             children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->expression = expression;
@@ -46,7 +46,7 @@ const struct cypher_astnode_vt cypher_true_astnode_vt =
 
 cypher_astnode_t *cypher_ast_true(struct cypher_input_range range)
 {
-    struct true_literal *node = calloc(1, sizeof(struct true_literal));
+    struct true_literal *node = cp_astnode_calloc(sizeof(struct true_literal));
     if (node == NULL)
     {
         return NULL;
@@ -54,7 +54,7 @@ cypher_astnode_t *cypher_ast_true(struct cypher_input_range range)
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_TRUE,
             NULL, 0, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     return &(node->_astnode);
@@ -53,7 +53,8 @@ cypher_astnode_t *cypher_ast_unary_operator(const cypher_operator_t *op,
     REQUIRE(op != NULL, NULL);
     REQUIRE_CHILD(children, nchildren, arg, CYPHER_AST_EXPRESSION, NULL);
 
-    struct unary_operator *node = calloc(1, sizeof(struct unary_operator));
+    struct unary_operator *node =
+            cp_astnode_calloc(sizeof(struct unary_operator));
     if (node == NULL)
     {
         return NULL;
@@ -61,7 +62,7 @@ cypher_astnode_t *cypher_ast_unary_operator(const cypher_operator_t *op,
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_UNARY_OPERATOR,
             children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->op = op;
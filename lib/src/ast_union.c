@@ -47,7 +47,7 @@ const struct cypher_astnode_vt cypher_union_astnode_vt =
 cypher_astnode_t *cypher_ast_union(bool all, cypher_astnode_t **children,
         unsigned int nchildren, struct cypher_input_range range)
 {
-    struct union_clause *node = calloc(1, sizeof(struct union_clause));
+    struct union_clause *node = cp_astnode_calloc(sizeof(struct union_clause));
     if (node == NULL)
     {
         return NULL;
@@ -55,7 +55,7 @@ cypher_astnode_t *cypher_ast_union(bool all, cypher_astnode_t **children,
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_UNION,
             children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->all = all;
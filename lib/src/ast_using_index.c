@@ -56,7 +56,7 @@ cypher_astnode_t *cypher_ast_using_index(const cypher_astnode_t *identifier,
     REQUIRE_CHILD(children, nchildren, label, CYPHER_AST_LABEL, NULL);
     REQUIRE_CHILD(children, nchildren, prop_name, CYPHER_AST_PROP_NAME, NULL);
 
-    struct using_index *node = calloc(1, sizeof(struct using_index));
+    struct using_index *node = cp_astnode_calloc(sizeof(struct using_index));
     if (node == NULL)
     {
         return NULL;
@@ -64,7 +64,7 @@ cypher_astnode_t *cypher_ast_using_index(const cypher_astnode_t *identifier,
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_USING_INDEX,
             children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->identifier = identifier;
@@ -55,7 +55,7 @@ cypher_astnode_t *cypher_ast_using_join(
     REQUIRE_CHILD_ALL(children, nchildren, identifiers, nidentifiers,
             CYPHER_AST_IDENTIFIER, NULL);
 
-    struct using_join *node = calloc(1, sizeof(struct using_join) +
+    struct using_join *node = cp_astnode_calloc(sizeof(struct using_join) +
             nidentifiers * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
@@ -74,7 +74,7 @@ cypher_astnode_t *cypher_ast_using_join(
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
@@ -52,7 +52,7 @@ cypher_astnode_t *cypher_ast_using_periodic_commit(
     REQUIRE_CHILD_OPTIONAL(children, nchildren, limit, CYPHER_AST_INTEGER, NULL);
 
     struct using_periodic_commit *node =
-            calloc(1, sizeof(struct using_periodic_commit));
+            cp_astnode_calloc(sizeof(struct using_periodic_commit));
     if (node == NULL)
     {
         return NULL;
@@ -60,7 +60,7 @@ cypher_astnode_t *cypher_ast_using_periodic_commit(
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_USING_PERIODIC_COMMIT,
             children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->limit = limit;
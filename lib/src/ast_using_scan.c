@@ -53,7 +53,7 @@ cypher_astnode_t *cypher_ast_using_scan(const cypher_astnode_t *identifier,
     REQUIRE_CHILD(children, nchildren, identifier, CYPHER_AST_IDENTIFIER, NULL);
     REQUIRE_CHILD(children, nchildren, label, CYPHER_AST_LABEL, NULL);
 
-    struct using_scan *node = calloc(1, sizeof(struct using_scan));
+    struct using_scan *node = cp_astnode_calloc(sizeof(struct using_scan));
     if (node == NULL)
     {
         return NULL;
@@ -61,7 +61,7 @@ cypher_astnode_t *cypher_ast_using_scan(const cypher_astnode_t *identifier,
     if (cypher_astnode_init(&(node->_astnode), CYPHER_AST_USING_SCAN,
             children, nchildren, range))
     {
-        free(node);
+        cp_astnode_free(node);
         return NULL;
     }
     node->identifier = identifier;
@@ -68,7 +68,7 @@ cypher_astnode_t *cypher_ast_with(bool distinct, bool include_existing,
     REQUIRE_CHILD_OPTIONAL(children, nchildren, limit,
             CYPHER_AST_EXPRESSION, NULL);
 
-    struct with_clause *node = calloc(1, sizeof(struct with_clause) +
+    struct with_clause *node = cp_astnode_calloc(sizeof(struct with_clause) +
             nprojections * sizeof(cypher_astnode_t *));
     if (node == NULL)
     {
@@ -93,7 +93,7 @@ cypher_astnode_t *cypher_ast_with(bool distinct, bool include_existing,
     int errsv;
 cleanup:
     errsv = errno;
-    free(node);
+    cp_astnode_free(node);
     errno = errsv;
     return NULL;
 }
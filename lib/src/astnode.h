@@ -45,6 +45,10 @@ struct cypher_astnode
     struct cypher_input_range range;
     unsigned int ordinal;
     struct cypher_astnode_annotation *annotations;
+    // synthesized from the children during cypher_astnode_init
+    unsigned int size;
+    unsigned int depth;
+    uint_fast32_t attributes;
 };
 
 
@@ -54,6 +58,12 @@ int cypher_astnode_init(cypher_astnode_t *node, cypher_astnode_type_t type,
 
 void cypher_astnode_release(cypher_astnode_t *node);
 
+void *cp_astnode_calloc(size_t size);
+
+void *cp_astnode_mdup(const void *src, size_t n);
+
+void cp_astnode_free(void *ptr);
+
 ssize_t cypher_astnode_detailstr(const cypher_astnode_t *node, char *str,
         size_t size);
 
@@ -127,7 +137,9 @@ static inline int child_index(const cypher_astnode_t *node,
 {
     unsigned int i = 0;
     while (i < node->nchildren && node->children[i] != child)
-        ;
+    {
+        ++i;
+    }
     assert(i < node->nchildren);
     return i;
 }
@@ -0,0 +1,49 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CYPHER_PARSER_ATOMICS_H
+#define CYPHER_PARSER_ATOMICS_H
+
+#include "../../config.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef HAVE_STDATOMIC_H
+#include <stdatomic.h>
+#elif defined(__ATOMIC_RELAXED)
+// without C11 atomics, use the equivalent GCC/clang builtins
+typedef uint64_t atomic_uint_fast64_t;
+typedef unsigned int atomic_uint;
+typedef uintptr_t atomic_uintptr_t;
+typedef bool atomic_bool;
+#define memory_order_relaxed __ATOMIC_RELAXED
+#define memory_order_acquire __ATOMIC_ACQUIRE
+#define memory_order_release __ATOMIC_RELEASE
+#define memory_order_acq_rel __ATOMIC_ACQ_REL
+#define memory_order_seq_cst __ATOMIC_SEQ_CST
+#define atomic_init(p, v) __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+#define atomic_load_explicit(p, o) __atomic_load_n((p), (o))
+#define atomic_store_explicit(p, v, o) __atomic_store_n((p), (v), (o))
+#define atomic_fetch_add_explicit(p, v, o) __atomic_fetch_add((p), (v), (o))
+#define atomic_fetch_sub_explicit(p, v, o) __atomic_fetch_sub((p), (v), (o))
+#define atomic_compare_exchange_strong_explicit(p, e, v, s, f) \
+        __atomic_compare_exchange_n((p), (e), (v), false, (s), (f))
+#define atomic_thread_fence(o) __atomic_thread_fence(o)
+#else
+#error "C11 atomics or the __atomic compiler builtins are required"
+#endif
+
+#endif/*CYPHER_PARSER_ATOMICS_H*/
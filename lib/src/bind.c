@@ -0,0 +1,378 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "ast.h"
+#include "astnode.h"
+#include "util.h"
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+
+struct cypher_bound_ast
+{
+    const cypher_astnode_t *original;
+    cypher_astnode_t *root;
+    unsigned int nbound;
+};
+
+
+struct binding
+{
+    cypher_ast_parameter_lookup_t lookup;
+    void *userdata;
+    unsigned int nbound;
+};
+
+
+static cypher_astnode_t *bind(const cypher_astnode_t *node,
+        struct binding *binding);
+static cypher_astnode_t *bind_parameter(const cypher_astnode_t *node,
+        struct binding *binding);
+static cypher_astnode_t *value_literal(const cypher_value_t *value,
+        struct cypher_input_range range);
+static cypher_astnode_t *number_literal(const cypher_value_t *value,
+        struct cypher_input_range range);
+static cypher_astnode_t *list_literal(const cypher_value_t *value,
+        struct cypher_input_range range);
+static cypher_astnode_t *map_literal(const cypher_value_t *value,
+        struct cypher_input_range range);
+static void release(cypher_astnode_t *node, const cypher_astnode_t *original);
+
+
+cypher_bound_ast_t *cypher_ast_bind_parameters(const cypher_astnode_t *ast,
+        cypher_ast_parameter_lookup_t lookup, void *userdata)
+{
+    REQUIRE(ast != NULL, NULL);
+    REQUIRE(lookup != NULL, NULL);
+
+    cypher_bound_ast_t *bound = malloc(sizeof(cypher_bound_ast_t));
+    if (bound == NULL)
+    {
+        return NULL;
+    }
+
+    struct binding binding =
+            { .lookup = lookup, .userdata = userdata, .nbound = 0 };
+    bound->root = bind(ast, &binding);
+    if (bound->root == NULL)
+    {
+        int errsv = errno;
+        free(bound);
+        errno = errsv;
+        return NULL;
+    }
+    bound->original = ast;
+    bound->nbound = binding.nbound;
+    return bound;
+}
+
+
+const cypher_astnode_t *cypher_bound_ast_get_root(
+        const cypher_bound_ast_t *bound)
+{
+    REQUIRE(bound != NULL, NULL);
+    return bound->root;
+}
+
+
+unsigned int cypher_bound_ast_nbound(const cypher_bound_ast_t *bound)
+{
+    REQUIRE(bound != NULL, 0);
+    return bound->nbound;
+}
+
+
+void cypher_bound_ast_free(cypher_bound_ast_t *bound)
+{
+    if (bound == NULL)
+    {
+        return;
+    }
+    release(bound->root, bound->original);
+    free(bound);
+}
+
+
+/*
+ * Returns the node itself when nothing beneath it was bound, or a copy
+ * whose children are either copies (on the path to a bound parameter) or
+ * the original children.
+ */
+cypher_astnode_t *bind(const cypher_astnode_t *node, struct binding *binding)
+{
+    if (node->type == CYPHER_AST_PARAMETER)
+    {
+        return bind_parameter(node, binding);
+    }
+    if (!(node->attributes & CYPHER_AST_HAS_PARAMETER))
+    {
+        return (cypher_astnode_t *)(uintptr_t)node;
+    }
+
+    assert(node->nchildren > 0);
+    cypher_astnode_t **children =
+            malloc(node->nchildren * sizeof(cypher_astnode_t *));
+    if (children == NULL)
+    {
+        return NULL;
+    }
+
+    bool changed = false;
+    unsigned int i = 0;
+    for (; i < node->nchildren; ++i)
+    {
+        children[i] = bind(node->children[i], binding);
+        if (children[i] == NULL)
+        {
+            goto failure;
+        }
+        changed |= (children[i] != node->children[i]);
+    }
+
+    cypher_astnode_t *copy = (cypher_astnode_t *)(uintptr_t)node;
+    if (changed && (copy = cp_astnode_clone(node, children)) == NULL)
+    {
+        goto failure;
+    }
+    free(children);
+    return copy;
+
+    int errsv;
+failure:
+    errsv = errno;
+    while (i-- > 0)
+    {
+        release(children[i], node->children[i]);
+    }
+    free(children);
+    errno = errsv;
+    return NULL;
+}
+
+
+cypher_astnode_t *bind_parameter(const cypher_astnode_t *node,
+        struct binding *binding)
+{
+    const char *name = cypher_ast_parameter_get_name(node);
+    size_t n = cypher_ast_parameter_get_name_len(node);
+    const cypher_value_t *value = binding->lookup(binding->userdata, name, n);
+    if (value == NULL)
+    {
+        return (cypher_astnode_t *)(uintptr_t)node;
+    }
+    cypher_astnode_t *literal = value_literal(value, node->range);
+    if (literal == NULL)
+    {
+        return NULL;
+    }
+    binding->nbound++;
+    return literal;
+}
+
+
+cypher_astnode_t *value_literal(const cypher_value_t *value,
+        struct cypher_input_range range)
+{
+    switch (value->type)
+    {
+    case CYPHER_VALUE_NULL:
+        return cypher_ast_null(range);
+    case CYPHER_VALUE_BOOLEAN:
+        return value->u.boolean? cypher_ast_true(range) :
+                cypher_ast_false(range);
+    case CYPHER_VALUE_INTEGER:
+    case CYPHER_VALUE_FLOAT:
+        return number_literal(value, range);
+    case CYPHER_VALUE_STRING:
+        return cypher_ast_string(value->u.string.s, value->u.string.length,
+                range);
+    case CYPHER_VALUE_LIST:
+        return list_literal(value, range);
+    case CYPHER_VALUE_MAP:
+        return map_literal(value, range);
+    }
+    errno = EINVAL;
+    return NULL;
+}
+
+
+cypher_astnode_t *number_literal(const cypher_value_t *value,
+        struct cypher_input_range range)
+{
+    // number literals are unsigned, and a negative number is parsed as a
+    // unary minus applied to its magnitude, so bind it the same way
+    char buf[32];
+    int n;
+    bool negative;
+    cypher_astnode_t *literal;
+    if (value->type == CYPHER_VALUE_INTEGER)
+    {
+        negative = (value->u.integer < 0);
+        // negate as unsigned, so the magnitude of INT64_MIN is representable
+        uint64_t magnitude = negative? -(uint64_t)value->u.integer :
+                (uint64_t)value->u.integer;
+        n = snprintf(buf, sizeof(buf), "%" PRIu64, magnitude);
+        assert(n > 0 && (size_t)n < sizeof(buf));
+        literal = cypher_ast_integer(buf, n, range);
+    }
+    else
+    {
+        // there is no literal for infinities or NaN
+        REQUIRE(isfinite(value->u.real), NULL);
+        negative = signbit(value->u.real);
+        n = snprintf(buf, sizeof(buf) - 2, "%.17g", fabs(value->u.real));
+        assert(n > 0 && (size_t)n < sizeof(buf) - 2);
+        if (strpbrk(buf, ".e") == NULL)
+        {
+            buf[n++] = '.';
+            buf[n++] = '0';
+            buf[n] = '\0';
+        }
+        literal = cypher_ast_float(buf, n, range);
+    }
+    if (literal == NULL || !negative)
+    {
+        return literal;
+    }
+
+    cypher_astnode_t *node = cypher_ast_unary_operator(CYPHER_OP_UNARY_MINUS,
+            literal, &literal, 1, range);
+    if (node == NULL)
+    {
+        int errsv = errno;
+        cypher_ast_free(literal);
+        errno = errsv;
+    }
+    return node;
+}
+
+
+cypher_astnode_t *list_literal(const cypher_value_t *value,
+        struct cypher_input_range range)
+{
+    unsigned int n = value->u.list.n;
+    cypher_astnode_t **elements = NULL;
+    if (n > 0)
+    {
+        elements = malloc(n * sizeof(cypher_astnode_t *));
+        if (elements == NULL)
+        {
+            return NULL;
+        }
+    }
+
+    cypher_astnode_t *node = NULL;
+    unsigned int i = 0;
+    for (; i < n; ++i)
+    {
+        elements[i] = value_literal(&(value->u.list.elements[i]), range);
+        if (elements[i] == NULL)
+        {
+            goto cleanup;
+        }
+    }
+
+    node = cypher_ast_collection(elements, n, elements, n, range);
+
+    int errsv;
+cleanup:
+    errsv = errno;
+    if (node == NULL)
+    {
+        cypher_ast_vfree(elements, i);
+    }
+    free(elements);
+    errno = errsv;
+    return node;
+}
+
+
+cypher_astnode_t *map_literal(const cypher_value_t *value,
+        struct cypher_input_range range)
+{
+    unsigned int n = value->u.map.n;
+    cypher_astnode_t **pairs = NULL;
+    if (n > 0)
+    {
+        pairs = malloc(2 * n * sizeof(cypher_astnode_t *));
+        if (pairs == NULL)
+        {
+            return NULL;
+        }
+    }
+
+    cypher_astnode_t *node = NULL;
+    unsigned int npairs = 0;
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        const struct cypher_value_map_entry *entry =
+                &(value->u.map.entries[i]);
+        pairs[npairs] = cypher_ast_prop_name(entry->key, entry->key_length,
+                range);
+        if (pairs[npairs] == NULL)
+        {
+            goto cleanup;
+        }
+        ++npairs;
+        pairs[npairs] = value_literal(&(entry->value), range);
+        if (pairs[npairs] == NULL)
+        {
+            goto cleanup;
+        }
+        ++npairs;
+    }
+
+    node = cypher_ast_pair_map(pairs, n, pairs, npairs, range);
+
+    int errsv;
+cleanup:
+    errsv = errno;
+    if (node == NULL)
+    {
+        cypher_ast_vfree(pairs, npairs);
+    }
+    free(pairs);
+    errno = errsv;
+    return node;
+}
+
+
+/*
+ * Release the nodes of a bound tree that are not shared with the original.
+ */
+void release(cypher_astnode_t *node, const cypher_astnode_t *original)
+{
+    if (node == original)
+    {
+        return;
+    }
+    if (original->type == CYPHER_AST_PARAMETER)
+    {
+        cypher_ast_free(node);
+        return;
+    }
+    assert(node->nchildren == original->nchildren);
+    for (unsigned int i = 0; i < node->nchildren; ++i)
+    {
+        release(node->children[i], original->children[i]);
+    }
+    cypher_astnode_free(node);
+}
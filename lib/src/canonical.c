@@ -0,0 +1,452 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "ast.h"
+#include "astnode.h"
+#include "util.h"
+#include <assert.h>
+#include <errno.h>
+
+
+#define FNV_OFFSET_BASIS 0xcbf29ce484222325ULL
+#define FNV_PRIME 0x100000001b3ULL
+
+
+struct detail_buffer
+{
+    char *buf;
+    size_t bufcap;
+};
+
+
+static uint64_t canonical_hash(const cypher_astnode_t *node,
+        struct detail_buffer *detail, int *err);
+static cypher_astnode_t *canonicalize(const cypher_astnode_t *node,
+        struct detail_buffer *detail, uint64_t *hash);
+static int canonical_order(const cypher_astnode_t *node,
+        const uint64_t *hashes, unsigned int *order);
+static bool is_commutative(const cypher_astnode_t *node,
+        const cypher_astnode_t **arg1, const cypher_astnode_t **arg2);
+static void order_pair(const cypher_astnode_t *node,
+        const cypher_astnode_t *arg1, const cypher_astnode_t *arg2,
+        const uint64_t *hashes, unsigned int *order);
+static void order_group(const unsigned int *positions,
+        const unsigned int *paired, unsigned int n, const uint64_t *hashes,
+        unsigned int *order, unsigned int *sorted);
+static int node_hash(const cypher_astnode_t *node,
+        struct detail_buffer *detail, const uint64_t *hashes,
+        const unsigned int *order, uint64_t *hash);
+static uint64_t fnv1a(uint64_t h, const void *data, size_t n);
+static uint64_t finalize(uint64_t h);
+
+
+int cypher_ast_canonical_hash(const cypher_astnode_t *ast, uint64_t *hash)
+{
+    REQUIRE(ast != NULL, -1);
+    REQUIRE(hash != NULL, -1);
+
+    struct detail_buffer detail = { .buf = NULL, .bufcap = 0 };
+    int err = 0;
+    *hash = canonical_hash(ast, &detail, &err);
+    free(detail.buf);
+    return err;
+}
+
+
+cypher_astnode_t *cypher_ast_canonicalize(const cypher_astnode_t *ast)
+{
+    REQUIRE(ast != NULL, NULL);
+
+    struct detail_buffer detail = { .buf = NULL, .bufcap = 0 };
+    uint64_t hash;
+    cypher_astnode_t *result = canonicalize(ast, &detail, &hash);
+    int errsv = errno;
+    free(detail.buf);
+    errno = errsv;
+    return result;
+}
+
+
+uint64_t canonical_hash(const cypher_astnode_t *node,
+        struct detail_buffer *detail, int *err)
+{
+    unsigned int n = node->nchildren;
+    uint64_t *hashes = NULL;
+    unsigned int *order = NULL;
+    uint64_t hash = 0;
+
+    if (n > 0)
+    {
+        hashes = calloc(n, sizeof(uint64_t));
+        order = calloc(n, sizeof(unsigned int));
+        if (hashes == NULL || order == NULL)
+        {
+            goto failure;
+        }
+    }
+
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        hashes[i] = canonical_hash(node->children[i], detail, err);
+        if (*err)
+        {
+            goto cleanup;
+        }
+    }
+
+    if (canonical_order(node, hashes, order) ||
+            node_hash(node, detail, hashes, order, &hash))
+    {
+        goto failure;
+    }
+    goto cleanup;
+
+failure:
+    *err = -1;
+cleanup:
+    {
+        int errsv = errno;
+        free(hashes);
+        free(order);
+        errno = errsv;
+    }
+    return hash;
+}
+
+
+cypher_astnode_t *canonicalize(const cypher_astnode_t *node,
+        struct detail_buffer *detail, uint64_t *hash)
+{
+    unsigned int n = node->nchildren;
+    cypher_astnode_t **children = NULL;
+    cypher_astnode_t **reordered = NULL;
+    uint64_t *hashes = NULL;
+    unsigned int *order = NULL;
+    cypher_astnode_t *clone = NULL;
+    unsigned int i = 0;
+
+    if (n > 0)
+    {
+        children = calloc(n, sizeof(cypher_astnode_t *));
+        reordered = calloc(n, sizeof(cypher_astnode_t *));
+        hashes = calloc(n, sizeof(uint64_t));
+        order = calloc(n, sizeof(unsigned int));
+        if (children == NULL || reordered == NULL || hashes == NULL ||
+                order == NULL)
+        {
+            goto cleanup;
+        }
+    }
+
+    for (; i < n; ++i)
+    {
+        children[i] = canonicalize(node->children[i], detail, &(hashes[i]));
+        if (children[i] == NULL)
+        {
+            goto cleanup;
+        }
+    }
+
+    if (canonical_order(node, hashes, order) ||
+            node_hash(node, detail, hashes, order, hash))
+    {
+        goto cleanup;
+    }
+    for (unsigned int j = 0; j < n; ++j)
+    {
+        reordered[j] = children[order[j]];
+    }
+
+    clone = cp_astnode_clone(node, reordered);
+
+    int errsv;
+cleanup:
+    errsv = errno;
+    if (clone == NULL)
+    {
+        cypher_ast_vfree(children, i);
+    }
+    free(children);
+    free(reordered);
+    free(hashes);
+    free(order);
+    errno = errsv;
+    return clone;
+}
+
+
+/*
+ * Determine the canonical order of the children of a node, such that the
+ * child at position `i` in the canonical form is the child at position
+ * `order[i]` in the original. Only the positions of operands that may be
+ * exchanged without changing semantics are permuted, and these are sorted
+ * by their canonical hash. Sorting is stable, so equal operands (and any
+ * duplicate map keys) retain their relative order.
+ */
+int canonical_order(const cypher_astnode_t *node, const uint64_t *hashes,
+        unsigned int *order)
+{
+    for (unsigned int i = 0; i < node->nchildren; ++i)
+    {
+        order[i] = i;
+    }
+
+    const cypher_astnode_t *arg1;
+    const cypher_astnode_t *arg2;
+    if (is_commutative(node, &arg1, &arg2))
+    {
+        order_pair(node, arg1, arg2, hashes, order);
+        return 0;
+    }
+
+    cypher_astnode_type_t type = cypher_astnode_type(node);
+    unsigned int n;
+    if (type == CYPHER_AST_MAP)
+    {
+        n = cypher_ast_map_nentries(node);
+    }
+    else if (type == CYPHER_AST_NODE_PATTERN)
+    {
+        n = cypher_ast_node_pattern_nlabels(node);
+    }
+    else if (type == CYPHER_AST_REL_PATTERN)
+    {
+        n = cypher_ast_rel_pattern_nreltypes(node);
+    }
+    else
+    {
+        return 0;
+    }
+    if (n < 2)
+    {
+        return 0;
+    }
+
+    unsigned int *positions = calloc(3 * n, sizeof(unsigned int));
+    if (positions == NULL)
+    {
+        return -1;
+    }
+    unsigned int *paired = NULL;
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        const cypher_astnode_t *child;
+        if (type == CYPHER_AST_MAP)
+        {
+            child = cypher_ast_map_get_key(node, i);
+            paired = positions + n;
+            paired[i] = child_index(node, cypher_ast_map_get_value(node, i));
+        }
+        else if (type == CYPHER_AST_NODE_PATTERN)
+        {
+            child = cypher_ast_node_pattern_get_label(node, i);
+        }
+        else
+        {
+            child = cypher_ast_rel_pattern_get_reltype(node, i);
+        }
+        positions[i] = child_index(node, child);
+    }
+
+    order_group(positions, paired, n, hashes, order, positions + 2 * n);
+    free(positions);
+    return 0;
+}
+
+
+/*
+ * Boolean connectives and equality are commutative for all operands.
+ * Addition is only commutative for numbers, as `+` also concatenates
+ * strings and lists, so it is only reordered when both operands are
+ * numeric literals.
+ */
+bool is_commutative(const cypher_astnode_t *node,
+        const cypher_astnode_t **arg1, const cypher_astnode_t **arg2)
+{
+    const cypher_operator_t *op;
+    cypher_astnode_type_t type = cypher_astnode_type(node);
+    if (type == CYPHER_AST_BINARY_OPERATOR)
+    {
+        op = cypher_ast_binary_operator_get_operator(node);
+        *arg1 = cypher_ast_binary_operator_get_argument1(node);
+        *arg2 = cypher_ast_binary_operator_get_argument2(node);
+    }
+    else if (type == CYPHER_AST_COMPARISON &&
+            cypher_ast_comparison_get_length(node) == 1)
+    {
+        op = cypher_ast_comparison_get_operator(node, 0);
+        *arg1 = cypher_ast_comparison_get_argument(node, 0);
+        *arg2 = cypher_ast_comparison_get_argument(node, 1);
+    }
+    else
+    {
+        return false;
+    }
+
+    if (op == CYPHER_OP_AND || op == CYPHER_OP_OR || op == CYPHER_OP_XOR ||
+            op == CYPHER_OP_EQUAL || op == CYPHER_OP_NEQUAL)
+    {
+        return true;
+    }
+    return op == CYPHER_OP_PLUS &&
+        (cypher_astnode_instanceof(*arg1, CYPHER_AST_INTEGER) ||
+         cypher_astnode_instanceof(*arg1, CYPHER_AST_FLOAT)) &&
+        (cypher_astnode_instanceof(*arg2, CYPHER_AST_INTEGER) ||
+         cypher_astnode_instanceof(*arg2, CYPHER_AST_FLOAT));
+}
+
+
+void order_pair(const cypher_astnode_t *node, const cypher_astnode_t *arg1,
+        const cypher_astnode_t *arg2, const uint64_t *hashes,
+        unsigned int *order)
+{
+    unsigned int p1 = child_index(node, arg1);
+    unsigned int p2 = child_index(node, arg2);
+    if (hashes[p2] < hashes[p1])
+    {
+        order[p1] = p2;
+        order[p2] = p1;
+    }
+}
+
+
+/*
+ * Sort a group of children, occupying the given positions, by hash. If
+ * `paired` is not NULL, each child has a paired child (e.g. the value of a
+ * map key) that is moved with it.
+ */
+void order_group(const unsigned int *positions, const unsigned int *paired,
+        unsigned int n, const uint64_t *hashes, unsigned int *order,
+        unsigned int *sorted)
+{
+    // insertion sort of indexes into the group, which is stable
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        unsigned int j = i;
+        for (; j > 0 && hashes[positions[sorted[j-1]]] >
+                hashes[positions[i]]; --j)
+        {
+            sorted[j] = sorted[j-1];
+        }
+        sorted[j] = i;
+    }
+
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        order[positions[i]] = positions[sorted[i]];
+        if (paired != NULL)
+        {
+            order[paired[i]] = paired[sorted[i]];
+        }
+    }
+}
+
+
+/*
+ * The hash of a node combines its type, its detail string and the hashes of
+ * its children in canonical order. The detail string of a node with
+ * children refers to them by ordinal (e.g. `@3 AND @4`), which depends on
+ * their position in the input, so the ordinals are omitted.
+ */
+int node_hash(const cypher_astnode_t *node, struct detail_buffer *detail,
+        const uint64_t *hashes, const unsigned int *order, uint64_t *hash)
+{
+    ssize_t len = cypher_astnode_detailstr(node, detail->buf, detail->bufcap);
+    if (len < 0)
+    {
+        return -1;
+    }
+    if ((size_t)len >= detail->bufcap)
+    {
+        size_t cap = (size_t)len + 1;
+        char *buf = realloc(detail->buf, cap);
+        if (buf == NULL)
+        {
+            return -1;
+        }
+        detail->buf = buf;
+        detail->bufcap = cap;
+        len = cypher_astnode_detailstr(node, detail->buf, detail->bufcap);
+        if (len < 0)
+        {
+            return -1;
+        }
+    }
+
+    cypher_astnode_type_t type = cypher_astnode_type(node);
+    uint64_t h = fnv1a(FNV_OFFSET_BASIS, &type, sizeof(type));
+
+    const char *s = detail->buf;
+    const char *end = s + len;
+    if (node->nchildren == 0)
+    {
+        h = fnv1a(h, s, len);
+    }
+    else
+    {
+        while (s < end)
+        {
+            const char *ref = memchr(s, '@', end - s);
+            if (ref == NULL)
+            {
+                ref = end;
+            }
+            h = fnv1a(h, s, ref - s);
+            if (ref == end)
+            {
+                break;
+            }
+            // retain the '@', but skip the ordinal following it
+            h = fnv1a(h, ref, 1);
+            for (s = ref + 1; s < end && *s >= '0' && *s <= '9'; ++s)
+                ;
+        }
+    }
+
+    for (unsigned int i = 0; i < node->nchildren; ++i)
+    {
+        uint64_t child = hashes[order[i]];
+        h = fnv1a(h, &child, sizeof(child));
+    }
+
+    *hash = finalize(h);
+    return 0;
+}
+
+
+uint64_t fnv1a(uint64_t h, const void *data, size_t n)
+{
+    const unsigned char *p = data;
+    for (size_t i = 0; i < n; ++i)
+    {
+        h ^= p[i];
+        h *= FNV_PRIME;
+    }
+    return h;
+}
+
+
+// the splitmix64 finalizer, to spread the bits of the FNV hash
+uint64_t finalize(uint64_t h)
+{
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return h;
+}
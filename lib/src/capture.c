@@ -0,0 +1,320 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "atomics.h"
+#include "capture.h"
+#include "slowlog.h"
+#include "util.h"
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#ifdef HAVE_PTHREADS
+#include <pthread.h>
+#endif
+
+
+struct cypher_capture
+{
+    FILE *stream;
+    double sample_rate;
+    uint64_t max_size;
+    uint64_t start_time;
+    atomic_uint_fast64_t nseen;
+    atomic_uint_fast64_t ndropped;
+    uint64_t nrecorded;
+    uint64_t size;
+#ifdef HAVE_PTHREADS
+    pthread_mutex_t mutex;
+#endif
+};
+
+
+static cypher_capture_t *quick_parser_capture = NULL;
+
+
+static int check_magic(FILE *stream);
+static bool sampled(cypher_capture_t *capture);
+static int write_record(cypher_capture_t *capture,
+        const struct cypher_capture_record *record, const char *s);
+static int discard_partial_record(cypher_capture_t *capture);
+
+
+cypher_capture_t *cypher_capture_open(const char *path, double sample_rate,
+        uint64_t max_size)
+{
+    REQUIRE(path != NULL, NULL);
+    REQUIRE(sample_rate > 0 && sample_rate <= 1, NULL);
+
+    cypher_capture_t *capture = calloc(1, sizeof(cypher_capture_t));
+    if (capture == NULL)
+    {
+        return NULL;
+    }
+
+    capture->stream = fopen(path, "a+b");
+    if (capture->stream == NULL)
+    {
+        goto failure;
+    }
+    if (fseek(capture->stream, 0, SEEK_END))
+    {
+        goto failure;
+    }
+    long size = ftell(capture->stream);
+    if (size < 0)
+    {
+        goto failure;
+    }
+    if (size > 0 && check_magic(capture->stream))
+    {
+        goto failure;
+    }
+    if (size == 0 && fwrite(CYPHER_CAPTURE_MAGIC, 1,
+                CYPHER_CAPTURE_MAGIC_LENGTH, capture->stream) <
+            CYPHER_CAPTURE_MAGIC_LENGTH)
+    {
+        goto failure;
+    }
+
+#ifdef HAVE_PTHREADS
+    int err = pthread_mutex_init(&(capture->mutex), NULL);
+    if (err != 0)
+    {
+        errno = err;
+        goto failure;
+    }
+#endif
+
+    capture->sample_rate = sample_rate;
+    capture->max_size = (max_size > 0)? max_size : UINT64_MAX;
+    capture->start_time = cp_slowlog_now();
+    capture->size = (size > 0)? (uint64_t)size : CYPHER_CAPTURE_MAGIC_LENGTH;
+    atomic_init(&(capture->nseen), 0);
+    atomic_init(&(capture->ndropped), 0);
+    return capture;
+
+    int errsv;
+failure:
+    errsv = errno;
+    if (capture->stream != NULL)
+    {
+        fclose(capture->stream);
+    }
+    free(capture);
+    errno = errsv;
+    return NULL;
+}
+
+
+int cypher_capture_close(cypher_capture_t *capture)
+{
+    if (capture == NULL)
+    {
+        return 0;
+    }
+    int result = (capture->stream != NULL)? fclose(capture->stream) : 0;
+    int errsv = errno;
+#ifdef HAVE_PTHREADS
+    pthread_mutex_destroy(&(capture->mutex));
+#endif
+    free(capture);
+    errno = errsv;
+    return (result == 0)? 0 : -1;
+}
+
+
+uint64_t cypher_capture_nrecorded(const cypher_capture_t *capture)
+{
+    REQUIRE(capture != NULL, 0);
+    cypher_capture_t *c = (cypher_capture_t *)(uintptr_t)capture;
+#ifdef HAVE_PTHREADS
+    pthread_mutex_lock(&(c->mutex));
+    uint64_t n = c->nrecorded;
+    pthread_mutex_unlock(&(c->mutex));
+    return n;
+#else
+    return c->nrecorded;
+#endif
+}
+
+
+uint64_t cypher_capture_ndropped(const cypher_capture_t *capture)
+{
+    REQUIRE(capture != NULL, 0);
+    cypher_capture_t *c = (cypher_capture_t *)(uintptr_t)capture;
+    return atomic_load_explicit(&(c->ndropped), memory_order_relaxed);
+}
+
+
+void cypher_quick_parser_set_capture(cypher_capture_t *capture)
+{
+    quick_parser_capture = capture;
+}
+
+
+cypher_capture_t *cp_quick_parser_capture(void)
+{
+    return quick_parser_capture;
+}
+
+
+void cp_capture_record(cypher_capture_t *capture, uint32_t kind,
+        uint_fast32_t flags, const char *s, size_t n)
+{
+    assert(capture != NULL);
+    if (!sampled(capture))
+    {
+        return;
+    }
+    if (n > UINT32_MAX)
+    {
+        atomic_fetch_add_explicit(&(capture->ndropped), 1,
+                memory_order_relaxed);
+        return;
+    }
+
+    struct cypher_capture_record record;
+    memset(&record, 0, sizeof(record));
+    record.time = cp_slowlog_now() - capture->start_time;
+    record.length = (uint32_t)n;
+    record.kind = kind;
+    record.flags = flags;
+
+    int errsv = errno;
+#ifdef HAVE_PTHREADS
+    pthread_mutex_lock(&(capture->mutex));
+#endif
+    int err = write_record(capture, &record, s);
+#ifdef HAVE_PTHREADS
+    pthread_mutex_unlock(&(capture->mutex));
+#endif
+    if (err)
+    {
+        atomic_fetch_add_explicit(&(capture->ndropped), 1,
+                memory_order_relaxed);
+    }
+    errno = errsv;
+}
+
+
+/*
+ * Check that an existing file starts with the capture magic, so records
+ * are never appended to an unrelated file. The stream is left positioned
+ * at its end.
+ */
+int check_magic(FILE *stream)
+{
+    char magic[CYPHER_CAPTURE_MAGIC_LENGTH];
+    if (fseek(stream, 0, SEEK_SET))
+    {
+        return -1;
+    }
+    size_t n = fread(magic, 1, CYPHER_CAPTURE_MAGIC_LENGTH, stream);
+    if (ferror(stream) || fseek(stream, 0, SEEK_END))
+    {
+        return -1;
+    }
+    if (n < CYPHER_CAPTURE_MAGIC_LENGTH ||
+            memcmp(magic, CYPHER_CAPTURE_MAGIC, CYPHER_CAPTURE_MAGIC_LENGTH))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    return 0;
+}
+
+
+/*
+ * Inputs are sampled at evenly spaced intervals, recording the nth input
+ * seen whenever n * rate crosses an integer.
+ */
+bool sampled(cypher_capture_t *capture)
+{
+    if (capture->sample_rate >= 1)
+    {
+        return true;
+    }
+    uint64_t n = atomic_fetch_add_explicit(&(capture->nseen), 1,
+            memory_order_relaxed);
+    return (uint64_t)((double)(n + 1) * capture->sample_rate) >
+        (uint64_t)((double)n * capture->sample_rate);
+}
+
+
+int write_record(cypher_capture_t *capture,
+        const struct cypher_capture_record *record, const char *s)
+{
+    uint64_t size = sizeof(struct cypher_capture_record) + record->length;
+    if (capture->size + size > capture->max_size)
+    {
+        return -1;
+    }
+    // each record is flushed, so a failure can only leave part of this
+    // record in the file, rather than of any recorded before it
+    if (fwrite(record, sizeof(struct cypher_capture_record), 1,
+                capture->stream) < 1 ||
+        (record->length > 0 &&
+            fwrite(s, record->length, 1, capture->stream) < 1) ||
+        fflush(capture->stream))
+    {
+        if (discard_partial_record(capture))
+        {
+            // the capture may now end in a partial record, which would
+            // corrupt anything recorded after it, so stop recording
+            capture->max_size = 0;
+        }
+        return -1;
+    }
+    capture->size += size;
+    ++(capture->nrecorded);
+    return 0;
+}
+
+
+/*
+ * Remove any part of a record that failed to be written. The stream is
+ * closed, so that none of the record remains buffered, and the file is
+ * then truncated to the end of the last complete record and reopened.
+ */
+int discard_partial_record(cypher_capture_t *capture)
+{
+    int fd = dup(fileno(capture->stream));
+    fclose(capture->stream);
+    capture->stream = NULL;
+    if (fd < 0)
+    {
+        return -1;
+    }
+    if (ftruncate(fd, (off_t)capture->size))
+    {
+        goto failure;
+    }
+    capture->stream = fdopen(fd, "ab");
+    if (capture->stream == NULL)
+    {
+        goto failure;
+    }
+    return 0;
+
+    int errsv;
+failure:
+    errsv = errno;
+    close(fd);
+    errno = errsv;
+    return -1;
+}
@@ -0,0 +1,37 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CYPHER_PARSER_CAPTURE_H
+#define CYPHER_PARSER_CAPTURE_H
+
+#include "cypher-parser.h"
+
+
+/*
+ * Append an input to a capture, if it is sampled and fits within the size
+ * limit. Failures to write are counted as dropped records, and never
+ * reported to the caller.
+ */
+void cp_capture_record(cypher_capture_t *capture, uint32_t kind,
+        uint_fast32_t flags, const char *s, size_t n);
+
+/*
+ * Get the capture set for the quick parser, or NULL.
+ */
+cypher_capture_t *cp_quick_parser_capture(void);
+
+
+#endif/*CYPHER_PARSER_CAPTURE_H*/
@@ -0,0 +1,722 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "catalog.h"
+#include "atomics.h"
+#include "util.h"
+#include <assert.h>
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#ifdef HAVE_PTHREADS
+#include <pthread.h>
+#endif
+
+
+#define CATALOG_MAX_SEEDS 4096
+
+/*
+ * A perfect hash over the names in a catalog section ("hash and displace"):
+ * each name is first hashed to a bucket, and each bucket has a seed that
+ * places all of its names into distinct slots. Lookup is then a single slot
+ * probe and one name comparison.
+ */
+struct perfect_hash
+{
+    unsigned int nbuckets;
+    unsigned int mask;
+    unsigned int *seeds;
+    int *slots;
+};
+
+struct catalog_section
+{
+    struct cypher_catalog_entry *entries;
+    unsigned int nentries;
+    unsigned int capacity;
+    bool fold_case;
+    // the hash covers the first `nhashed` entries, and is rebuilt on the
+    // first lookup after entries are added
+    struct perfect_hash hash;
+    atomic_uint nhashed;
+#ifdef HAVE_PTHREADS
+    pthread_mutex_t mutex;
+#endif
+};
+
+struct cypher_catalog
+{
+    struct catalog_section functions;
+    struct catalog_section procedures;
+};
+
+
+static const struct cypher_catalog_entry builtin_functions[] =
+{
+    [CYPHER_FUNCTION_ABS] = { "abs", 1, 1, 0 },
+    [CYPHER_FUNCTION_ACOS] = { "acos", 1, 1, 0 },
+    [CYPHER_FUNCTION_ASIN] = { "asin", 1, 1, 0 },
+    [CYPHER_FUNCTION_ATAN] = { "atan", 1, 1, 0 },
+    [CYPHER_FUNCTION_ATAN2] = { "atan2", 2, 2, 0 },
+    [CYPHER_FUNCTION_AVG] = { "avg", 1, 1, CYPHER_CATALOG_AGGREGATE },
+    [CYPHER_FUNCTION_CEIL] = { "ceil", 1, 1, 0 },
+    [CYPHER_FUNCTION_COALESCE] =
+        { "coalesce", 1, CYPHER_CATALOG_UNBOUNDED, 0 },
+    [CYPHER_FUNCTION_COLLECT] = { "collect", 1, 1, CYPHER_CATALOG_AGGREGATE },
+    [CYPHER_FUNCTION_COS] = { "cos", 1, 1, 0 },
+    [CYPHER_FUNCTION_COT] = { "cot", 1, 1, 0 },
+    [CYPHER_FUNCTION_COUNT] = { "count", 0, 1, CYPHER_CATALOG_AGGREGATE },
+    [CYPHER_FUNCTION_DATE] = { "date", 0, 1, 0 },
+    [CYPHER_FUNCTION_DATETIME] = { "datetime", 0, 1, 0 },
+    [CYPHER_FUNCTION_DEGREES] = { "degrees", 1, 1, 0 },
+    [CYPHER_FUNCTION_DISTANCE] = { "distance", 2, 2, 0 },
+    [CYPHER_FUNCTION_DURATION] = { "duration", 1, 1, 0 },
+    [CYPHER_FUNCTION_E] = { "e", 0, 0, 0 },
+    [CYPHER_FUNCTION_END_NODE] = { "endNode", 1, 1, 0 },
+    [CYPHER_FUNCTION_EXISTS] = { "exists", 1, 1, 0 },
+    [CYPHER_FUNCTION_EXP] = { "exp", 1, 1, 0 },
+    [CYPHER_FUNCTION_FLOOR] = { "floor", 1, 1, 0 },
+    [CYPHER_FUNCTION_HAVERSIN] = { "haversin", 1, 1, 0 },
+    [CYPHER_FUNCTION_HEAD] = { "head", 1, 1, 0 },
+    [CYPHER_FUNCTION_ID] = { "id", 1, 1, 0 },
+    [CYPHER_FUNCTION_KEYS] = { "keys", 1, 1, 0 },
+    [CYPHER_FUNCTION_LABELS] = { "labels", 1, 1, 0 },
+    [CYPHER_FUNCTION_LAST] = { "last", 1, 1, 0 },
+    [CYPHER_FUNCTION_LEFT] = { "left", 2, 2, 0 },
+    [CYPHER_FUNCTION_LENGTH] = { "length", 1, 1, 0 },
+    [CYPHER_FUNCTION_LOCALDATETIME] = { "localdatetime", 0, 1, 0 },
+    [CYPHER_FUNCTION_LOCALTIME] = { "localtime", 0, 1, 0 },
+    [CYPHER_FUNCTION_LOG] = { "log", 1, 1, 0 },
+    [CYPHER_FUNCTION_LOG10] = { "log10", 1, 1, 0 },
+    [CYPHER_FUNCTION_LTRIM] = { "lTrim", 1, 1, 0 },
+    [CYPHER_FUNCTION_MAX] = { "max", 1, 1, CYPHER_CATALOG_AGGREGATE },
+    [CYPHER_FUNCTION_MIN] = { "min", 1, 1, CYPHER_CATALOG_AGGREGATE },
+    [CYPHER_FUNCTION_NODES] = { "nodes", 1, 1, 0 },
+    [CYPHER_FUNCTION_PERCENTILE_CONT] =
+        { "percentileCont", 2, 2, CYPHER_CATALOG_AGGREGATE },
+    [CYPHER_FUNCTION_PERCENTILE_DISC] =
+        { "percentileDisc", 2, 2, CYPHER_CATALOG_AGGREGATE },
+    [CYPHER_FUNCTION_PI] = { "pi", 0, 0, 0 },
+    [CYPHER_FUNCTION_POINT] = { "point", 1, 1, 0 },
+    [CYPHER_FUNCTION_PROPERTIES] = { "properties", 1, 1, 0 },
+    [CYPHER_FUNCTION_RADIANS] = { "radians", 1, 1, 0 },
+    [CYPHER_FUNCTION_RAND] = { "rand", 0, 0, CYPHER_CATALOG_NONDETERMINISTIC },
+    [CYPHER_FUNCTION_RANGE] = { "range", 2, 3, 0 },
+    [CYPHER_FUNCTION_RELATIONSHIPS] = { "relationships", 1, 1, 0 },
+    [CYPHER_FUNCTION_REPLACE] = { "replace", 3, 3, 0 },
+    [CYPHER_FUNCTION_REVERSE] = { "reverse", 1, 1, 0 },
+    [CYPHER_FUNCTION_RIGHT] = { "right", 2, 2, 0 },
+    [CYPHER_FUNCTION_ROUND] = { "round", 1, 1, 0 },
+    [CYPHER_FUNCTION_RTRIM] = { "rTrim", 1, 1, 0 },
+    [CYPHER_FUNCTION_SIGN] = { "sign", 1, 1, 0 },
+    [CYPHER_FUNCTION_SIN] = { "sin", 1, 1, 0 },
+    [CYPHER_FUNCTION_SIZE] = { "size", 1, 1, 0 },
+    [CYPHER_FUNCTION_SPLIT] = { "split", 2, 2, 0 },
+    [CYPHER_FUNCTION_SQRT] = { "sqrt", 1, 1, 0 },
+    [CYPHER_FUNCTION_START_NODE] = { "startNode", 1, 1, 0 },
+    [CYPHER_FUNCTION_STDEV] = { "stDev", 1, 1, CYPHER_CATALOG_AGGREGATE },
+    [CYPHER_FUNCTION_STDEVP] = { "stDevP", 1, 1, CYPHER_CATALOG_AGGREGATE },
+    [CYPHER_FUNCTION_SUBSTRING] = { "substring", 2, 3, 0 },
+    [CYPHER_FUNCTION_SUM] = { "sum", 1, 1, CYPHER_CATALOG_AGGREGATE },
+    [CYPHER_FUNCTION_TAIL] = { "tail", 1, 1, 0 },
+    [CYPHER_FUNCTION_TAN] = { "tan", 1, 1, 0 },
+    [CYPHER_FUNCTION_TIME] = { "time", 0, 1, 0 },
+    [CYPHER_FUNCTION_TIMESTAMP] =
+        { "timestamp", 0, 0, CYPHER_CATALOG_NONDETERMINISTIC },
+    [CYPHER_FUNCTION_TO_BOOLEAN] = { "toBoolean", 1, 1, 0 },
+    [CYPHER_FUNCTION_TO_FLOAT] = { "toFloat", 1, 1, 0 },
+    [CYPHER_FUNCTION_TO_INTEGER] = { "toInteger", 1, 1, 0 },
+    [CYPHER_FUNCTION_TO_LOWER] = { "toLower", 1, 1, 0 },
+    [CYPHER_FUNCTION_TO_STRING] = { "toString", 1, 1, 0 },
+    [CYPHER_FUNCTION_TO_UPPER] = { "toUpper", 1, 1, 0 },
+    [CYPHER_FUNCTION_TRIM] = { "trim", 1, 1, 0 },
+    [CYPHER_FUNCTION_TYPE] = { "type", 1, 1, 0 },
+};
+
+static const struct cypher_catalog_entry builtin_procedures[] =
+{
+    [CYPHER_PROCEDURE_DB_LABELS] = { "db.labels", 0, 0, 0 },
+    [CYPHER_PROCEDURE_DB_RELATIONSHIP_TYPES] =
+        { "db.relationshipTypes", 0, 0, 0 },
+    [CYPHER_PROCEDURE_DB_PROPERTY_KEYS] = { "db.propertyKeys", 0, 0, 0 },
+    [CYPHER_PROCEDURE_DB_INDEXES] = { "db.indexes", 0, 0, 0 },
+    [CYPHER_PROCEDURE_DB_CONSTRAINTS] = { "db.constraints", 0, 0, 0 },
+    [CYPHER_PROCEDURE_DBMS_PROCEDURES] = { "dbms.procedures", 0, 0, 0 },
+    [CYPHER_PROCEDURE_DBMS_FUNCTIONS] = { "dbms.functions", 0, 0, 0 },
+};
+
+static_assert(sizeof(builtin_functions) / sizeof(builtin_functions[0]) ==
+        CYPHER_NBUILTIN_FUNCTIONS,
+        "builtin_functions must have an entry for each builtin function id");
+static_assert(sizeof(builtin_procedures) / sizeof(builtin_procedures[0]) ==
+        CYPHER_NBUILTIN_PROCEDURES,
+        "builtin_procedures must have an entry for each builtin procedure id");
+
+
+static int section_init(struct catalog_section *section, bool fold_case);
+static int section_add(struct catalog_section *section, const char *name,
+        unsigned int min_args, unsigned int max_args, uint_fast32_t flags);
+static int section_append(struct catalog_section *section, const char *name,
+        unsigned int min_args, unsigned int max_args, uint_fast32_t flags);
+static int section_find(const struct catalog_section *section,
+        const char *name, size_t n);
+static int hash_find(const struct catalog_section *section,
+        const char *name, size_t n);
+static int scan_find(const struct catalog_section *section,
+        unsigned int from, const char *name, size_t n);
+static int refresh_hash(struct catalog_section *section);
+static void section_cleanup(struct catalog_section *section);
+static int build_hash(struct catalog_section *section);
+static uint32_t hash_name(const char *s, size_t n, bool fold_case,
+        uint32_t seed);
+static bool name_equals(const char *a, const char *b, size_t n,
+        bool fold_case);
+
+
+cypher_catalog_t *cypher_catalog_new(bool builtins)
+{
+    cypher_catalog_t *catalog = calloc(1, sizeof(cypher_catalog_t));
+    if (catalog == NULL)
+    {
+        return NULL;
+    }
+    // function names are case insensitive, procedure names are not
+    if (section_init(&(catalog->functions), true))
+    {
+        free(catalog);
+        return NULL;
+    }
+    if (section_init(&(catalog->procedures), false))
+    {
+        section_cleanup(&(catalog->functions));
+        free(catalog);
+        return NULL;
+    }
+
+    if (!builtins)
+    {
+        return catalog;
+    }
+
+    // the builtin names are distinct, so they are appended without checking
+    for (unsigned int i = 0; i < CYPHER_NBUILTIN_FUNCTIONS; ++i)
+    {
+        const struct cypher_catalog_entry *e = &(builtin_functions[i]);
+        assert(e->name != NULL);
+        if (section_append(&(catalog->functions), e->name, e->min_args,
+                    e->max_args, e->flags) < 0)
+        {
+            goto failure;
+        }
+    }
+    for (unsigned int i = 0; i < CYPHER_NBUILTIN_PROCEDURES; ++i)
+    {
+        const struct cypher_catalog_entry *e = &(builtin_procedures[i]);
+        assert(e->name != NULL);
+        if (section_append(&(catalog->procedures), e->name, e->min_args,
+                    e->max_args, e->flags) < 0)
+        {
+            goto failure;
+        }
+    }
+    return catalog;
+
+    int errsv;
+failure:
+    errsv = errno;
+    cypher_catalog_free(catalog);
+    errno = errsv;
+    return NULL;
+}
+
+
+void cypher_catalog_free(cypher_catalog_t *catalog)
+{
+    if (catalog == NULL)
+    {
+        return;
+    }
+    section_cleanup(&(catalog->functions));
+    section_cleanup(&(catalog->procedures));
+    free(catalog);
+}
+
+
+int cypher_catalog_add_function(cypher_catalog_t *catalog, const char *name,
+        unsigned int min_args, unsigned int max_args, uint_fast32_t flags)
+{
+    REQUIRE(catalog != NULL, -1);
+    REQUIRE(name != NULL, -1);
+    REQUIRE(min_args <= max_args, -1);
+    return section_add(&(catalog->functions), name, min_args, max_args,
+            flags);
+}
+
+
+int cypher_catalog_add_procedure(cypher_catalog_t *catalog, const char *name,
+        unsigned int min_args, unsigned int max_args, uint_fast32_t flags)
+{
+    REQUIRE(catalog != NULL, -1);
+    REQUIRE(name != NULL, -1);
+    REQUIRE(min_args <= max_args, -1);
+    return section_add(&(catalog->procedures), name, min_args, max_args,
+            flags);
+}
+
+
+int cypher_catalog_find_function(const cypher_catalog_t *catalog,
+        const char *name, size_t n)
+{
+    REQUIRE(catalog != NULL, -1);
+    REQUIRE(name != NULL, -1);
+    return section_find(&(catalog->functions), name, n);
+}
+
+
+int cypher_catalog_find_procedure(const cypher_catalog_t *catalog,
+        const char *name, size_t n)
+{
+    REQUIRE(catalog != NULL, -1);
+    REQUIRE(name != NULL, -1);
+    return section_find(&(catalog->procedures), name, n);
+}
+
+
+const struct cypher_catalog_entry *cypher_catalog_get_function(
+        const cypher_catalog_t *catalog, int id)
+{
+    REQUIRE(catalog != NULL, NULL);
+    if (id < 0 || (unsigned int)id >= catalog->functions.nentries)
+    {
+        return NULL;
+    }
+    return &(catalog->functions.entries[id]);
+}
+
+
+const struct cypher_catalog_entry *cypher_catalog_get_procedure(
+        const cypher_catalog_t *catalog, int id)
+{
+    REQUIRE(catalog != NULL, NULL);
+    if (id < 0 || (unsigned int)id >= catalog->procedures.nentries)
+    {
+        return NULL;
+    }
+    return &(catalog->procedures.entries[id]);
+}
+
+
+int cp_catalog_resolve_function(const cypher_catalog_t *catalog,
+        const char *name, size_t n, uint_fast32_t *flags)
+{
+    int id = section_find(&(catalog->functions), name, n);
+    *flags = (id < 0)? 0 : catalog->functions.entries[id].flags;
+    return id;
+}
+
+
+int cp_catalog_resolve_procedure(const cypher_catalog_t *catalog,
+        const char *name, size_t n, uint_fast32_t *flags)
+{
+    int id = section_find(&(catalog->procedures), name, n);
+    *flags = (id < 0)? 0 : catalog->procedures.entries[id].flags;
+    return id;
+}
+
+
+uint_fast32_t cp_catalog_builtin_function_flags(const char *name, size_t n)
+{
+    for (unsigned int i = 0; i < CYPHER_NBUILTIN_FUNCTIONS; ++i)
+    {
+        const struct cypher_catalog_entry *e = &(builtin_functions[i]);
+        if (strlen(e->name) == n && name_equals(e->name, name, n, true))
+        {
+            return e->flags;
+        }
+    }
+    return 0;
+}
+
+
+int section_init(struct catalog_section *section, bool fold_case)
+{
+    memset(section, 0, sizeof(struct catalog_section));
+    section->fold_case = fold_case;
+    atomic_init(&(section->nhashed), 0);
+#ifdef HAVE_PTHREADS
+    int err = pthread_mutex_init(&(section->mutex), NULL);
+    if (err != 0)
+    {
+        errno = err;
+        return -1;
+    }
+#endif
+    return 0;
+}
+
+
+int section_add(struct catalog_section *section, const char *name,
+        unsigned int min_args, unsigned int max_args, uint_fast32_t flags)
+{
+    // the hash is not rebuilt for each addition, so names added since it
+    // was last built are scanned
+    size_t n = strlen(name);
+    if (hash_find(section, name, n) >= 0 ||
+            scan_find(section, atomic_load_explicit(&(section->nhashed),
+                    memory_order_relaxed), name, n) >= 0)
+    {
+        errno = EEXIST;
+        return -1;
+    }
+    return section_append(section, name, min_args, max_args, flags);
+}
+
+
+int section_append(struct catalog_section *section, const char *name,
+        unsigned int min_args, unsigned int max_args, uint_fast32_t flags)
+{
+    if (section->nentries >= INT_MAX)
+    {
+        errno = ENOSPC;
+        return -1;
+    }
+
+    if (section->nentries >= section->capacity)
+    {
+        unsigned int newcap = (section->capacity == 0)?
+                16 : section->capacity * 2;
+        void *entries = realloc(section->entries,
+                newcap * sizeof(struct cypher_catalog_entry));
+        if (entries == NULL)
+        {
+            return -1;
+        }
+        section->entries = entries;
+        section->capacity = newcap;
+    }
+
+    char *dup = strdup(name);
+    if (dup == NULL)
+    {
+        return -1;
+    }
+    unsigned int id = section->nentries;
+    struct cypher_catalog_entry *e = &(section->entries[id]);
+    e->name = dup;
+    e->min_args = min_args;
+    e->max_args = max_args;
+    e->flags = flags;
+    ++(section->nentries);
+    return (int)id;
+}
+
+
+int section_find(const struct catalog_section *section, const char *name,
+        size_t n)
+{
+    // a catalog is not modified whilst in use, but a shared catalog may be
+    // searched concurrently, so the hash is rebuilt under the lock
+    struct catalog_section *s = (struct catalog_section *)(uintptr_t)section;
+    if (atomic_load_explicit(&(s->nhashed), memory_order_acquire) !=
+            s->nentries && refresh_hash(s))
+    {
+        return scan_find(section, 0, name, n);
+    }
+    return hash_find(section, name, n);
+}
+
+
+int hash_find(const struct catalog_section *section, const char *name,
+        size_t n)
+{
+    const struct perfect_hash *hash = &(section->hash);
+    if (hash->slots == NULL)
+    {
+        return -1;
+    }
+    uint32_t h = hash_name(name, n, section->fold_case, 0);
+    uint32_t seed = hash->seeds[h % hash->nbuckets];
+    int id = hash->slots[hash_name(name, n, section->fold_case, seed) &
+            hash->mask];
+    if (id < 0)
+    {
+        return -1;
+    }
+    const char *candidate = section->entries[id].name;
+    if (strlen(candidate) != n ||
+            !name_equals(candidate, name, n, section->fold_case))
+    {
+        return -1;
+    }
+    return id;
+}
+
+
+int scan_find(const struct catalog_section *section, unsigned int from,
+        const char *name, size_t n)
+{
+    for (unsigned int i = from; i < section->nentries; ++i)
+    {
+        const char *candidate = section->entries[i].name;
+        if (strlen(candidate) == n &&
+                name_equals(candidate, name, n, section->fold_case))
+        {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+
+int refresh_hash(struct catalog_section *section)
+{
+    int result = 0;
+#ifdef HAVE_PTHREADS
+    pthread_mutex_lock(&(section->mutex));
+#endif
+    if (atomic_load_explicit(&(section->nhashed), memory_order_relaxed) !=
+            section->nentries)
+    {
+        result = build_hash(section);
+        if (result == 0)
+        {
+            atomic_store_explicit(&(section->nhashed), section->nentries,
+                    memory_order_release);
+        }
+    }
+#ifdef HAVE_PTHREADS
+    pthread_mutex_unlock(&(section->mutex));
+#endif
+    return result;
+}
+
+
+void section_cleanup(struct catalog_section *section)
+{
+    for (unsigned int i = 0; i < section->nentries; ++i)
+    {
+        free((char *)(uintptr_t)section->entries[i].name);
+    }
+    free(section->entries);
+    free(section->hash.seeds);
+    free(section->hash.slots);
+#ifdef HAVE_PTHREADS
+    pthread_mutex_destroy(&(section->mutex));
+#endif
+    memset(section, 0, sizeof(struct catalog_section));
+}
+
+
+int build_hash(struct catalog_section *section)
+{
+    unsigned int n = section->nentries;
+    unsigned int nbuckets = (n / 4) + 1;
+    unsigned int nslots = 8;
+    while (nslots < n * 2)
+    {
+        nslots *= 2;
+    }
+
+    unsigned int *seeds = calloc(nbuckets, sizeof(unsigned int));
+    unsigned int *bucket_of = calloc(n, sizeof(unsigned int));
+    unsigned int *start = calloc(nbuckets + 1, sizeof(unsigned int));
+    unsigned int *members = calloc(n, sizeof(unsigned int));
+    unsigned int *buckets = calloc(nbuckets, sizeof(unsigned int));
+    unsigned int *by_size = calloc(n + 2, sizeof(unsigned int));
+    uint32_t *candidate = calloc(n, sizeof(uint32_t));
+    int *slots = NULL;
+    if (seeds == NULL || bucket_of == NULL || start == NULL ||
+            members == NULL || buckets == NULL || by_size == NULL ||
+            candidate == NULL)
+    {
+        goto failure;
+    }
+
+    // group the entries by bucket
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        const char *name = section->entries[i].name;
+        bucket_of[i] = hash_name(name, strlen(name), section->fold_case, 0) %
+                nbuckets;
+        ++(start[bucket_of[i] + 1]);
+    }
+    for (unsigned int b = 0; b < nbuckets; ++b)
+    {
+        unsigned int size = start[b + 1];
+        ++(by_size[n - size + 1]);
+        start[b + 1] += start[b];
+    }
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        members[start[bucket_of[i]]++] = i;
+    }
+    for (unsigned int b = nbuckets; b > 0; --b)
+    {
+        start[b] = start[b - 1];
+    }
+    start[0] = 0;
+
+    // order the buckets by descending size, so the largest are placed first
+    for (unsigned int k = 1; k < n + 2; ++k)
+    {
+        by_size[k] += by_size[k - 1];
+    }
+    for (unsigned int b = 0; b < nbuckets; ++b)
+    {
+        unsigned int size = start[b + 1] - start[b];
+        buckets[by_size[n - size]++] = b;
+    }
+
+retry:
+    free(slots);
+    slots = malloc(nslots * sizeof(int));
+    if (slots == NULL)
+    {
+        goto failure;
+    }
+    for (unsigned int s = 0; s < nslots; ++s)
+    {
+        slots[s] = -1;
+    }
+
+    for (unsigned int bi = 0; bi < nbuckets; ++bi)
+    {
+        unsigned int b = buckets[bi];
+        const unsigned int *bmembers = members + start[b];
+        unsigned int nmembers = start[b + 1] - start[b];
+        if (nmembers == 0)
+        {
+            break;
+        }
+
+        uint32_t seed = 1;
+        for (; seed < CATALOG_MAX_SEEDS; ++seed)
+        {
+            unsigned int placed = 0;
+            for (; placed < nmembers; ++placed)
+            {
+                const char *name = section->entries[bmembers[placed]].name;
+                candidate[placed] = hash_name(name, strlen(name),
+                        section->fold_case, seed) & (nslots - 1);
+                if (slots[candidate[placed]] >= 0)
+                {
+                    break;
+                }
+                unsigned int k = 0;
+                for (; k < placed && candidate[k] != candidate[placed]; ++k)
+                    ;
+                if (k < placed)
+                {
+                    break;
+                }
+            }
+            if (placed == nmembers)
+            {
+                break;
+            }
+        }
+        if (seed >= CATALOG_MAX_SEEDS)
+        {
+            nslots *= 2;
+            goto retry;
+        }
+
+        seeds[b] = seed;
+        for (unsigned int k = 0; k < nmembers; ++k)
+        {
+            slots[candidate[k]] = (int)bmembers[k];
+        }
+    }
+
+    free(section->hash.seeds);
+    free(section->hash.slots);
+    section->hash.nbuckets = nbuckets;
+    section->hash.mask = nslots - 1;
+    section->hash.seeds = seeds;
+    section->hash.slots = slots;
+    free(bucket_of);
+    free(start);
+    free(members);
+    free(buckets);
+    free(by_size);
+    free(candidate);
+    return 0;
+
+    int errsv;
+failure:
+    errsv = errno;
+    free(seeds);
+    free(bucket_of);
+    free(start);
+    free(members);
+    free(buckets);
+    free(by_size);
+    free(candidate);
+    free(slots);
+    errno = errsv;
+    return -1;
+}
+
+
+uint32_t hash_name(const char *s, size_t n, bool fold_case, uint32_t seed)
+{
+    // FNV-1a, seeded, with a final avalanche
+    uint32_t h = 2166136261u ^ (seed * 0x9e3779b9u);
+    for (size_t i = 0; i < n; ++i)
+    {
+        unsigned char c = (unsigned char)s[i];
+        if (fold_case && c >= 'A' && c <= 'Z')
+        {
+            c += 'a' - 'A';
+        }
+        h ^= c;
+        h *= 16777619u;
+    }
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+
+bool name_equals(const char *a, const char *b, size_t n, bool fold_case)
+{
+    if (!fold_case)
+    {
+        return memcmp(a, b, n) == 0;
+    }
+    for (size_t i = 0; i < n; ++i)
+    {
+        unsigned char ca = (unsigned char)a[i];
+        unsigned char cb = (unsigned char)b[i];
+        if (ca >= 'A' && ca <= 'Z')
+        {
+            ca += 'a' - 'A';
+        }
+        if (cb >= 'A' && cb <= 'Z')
+        {
+            cb += 'a' - 'A';
+        }
+        if (ca != cb)
+        {
+            return false;
+        }
+    }
+    return true;
+}
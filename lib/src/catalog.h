@@ -0,0 +1,44 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CYPHER_PARSER_CATALOG_H
+#define CYPHER_PARSER_CATALOG_H
+
+#include "cypher-parser.h"
+
+
+/*
+ * Resolve a function name, returning its id (or -1 if it is not in the
+ * catalog) and setting *flags.
+ */
+int cp_catalog_resolve_function(const cypher_catalog_t *catalog,
+        const char *name, size_t n, uint_fast32_t *flags);
+
+/*
+ * Resolve a procedure name, returning its id (or -1 if it is not in the
+ * catalog) and setting *flags.
+ */
+int cp_catalog_resolve_procedure(const cypher_catalog_t *catalog,
+        const char *name, size_t n, uint_fast32_t *flags);
+
+/*
+ * Get the flags of a builtin function, or 0 if there is no builtin function
+ * with the name (which is matched without regard to case).
+ */
+uint_fast32_t cp_catalog_builtin_function_flags(const char *name, size_t n);
+
+
+#endif/*CYPHER_PARSER_CATALOG_H*/
@@ -0,0 +1,478 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CYPHER_PARSER_HPP
+#define CYPHER_PARSER_HPP
+
+/*
+ * An optional, header-only C++17 layer over libcypher-parser.
+ *
+ * This provides `std::string_view` accessors for the string bearing AST
+ * nodes, RAII handles for parse results and parser configurations, and a
+ * visitor base class that dispatches on the node type without virtual
+ * calls. Everything is inline and adds no state beyond the underlying C
+ * objects.
+ */
+
+#if !defined(__cplusplus) || __cplusplus < 201703L
+#error "cypher-parser.hpp requires C++17"
+#endif
+
+#include "cypher-parser.h"
+#include <array>
+#include <cerrno>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace cypher {
+
+
+/**
+ * Get the string of a `CYPHER_AST_IDENTIFIER` node as a view.
+ */
+inline std::string_view identifier_get_name(const cypher_astnode_t *node) noexcept
+{
+    return std::string_view(cypher_ast_identifier_get_name(node),
+            cypher_ast_identifier_get_name_len(node));
+}
+
+/**
+ * Get the string of a `CYPHER_AST_PARAMETER` node as a view.
+ */
+inline std::string_view parameter_get_name(const cypher_astnode_t *node) noexcept
+{
+    return std::string_view(cypher_ast_parameter_get_name(node),
+            cypher_ast_parameter_get_name_len(node));
+}
+
+/**
+ * Get the string of a `CYPHER_AST_STRING` node as a view.
+ */
+inline std::string_view string_get_value(const cypher_astnode_t *node) noexcept
+{
+    return std::string_view(cypher_ast_string_get_value(node),
+            cypher_ast_string_get_value_len(node));
+}
+
+/**
+ * Get the string of a `CYPHER_AST_INTEGER` node as a view.
+ */
+inline std::string_view integer_get_valuestr(const cypher_astnode_t *node) noexcept
+{
+    return std::string_view(cypher_ast_integer_get_valuestr(node),
+            cypher_ast_integer_get_valuestr_len(node));
+}
+
+/**
+ * Get the string of a `CYPHER_AST_FLOAT` node as a view.
+ */
+inline std::string_view float_get_valuestr(const cypher_astnode_t *node) noexcept
+{
+    return std::string_view(cypher_ast_float_get_valuestr(node),
+            cypher_ast_float_get_valuestr_len(node));
+}
+
+/**
+ * Get the string of a `CYPHER_AST_LABEL` node as a view.
+ */
+inline std::string_view label_get_name(const cypher_astnode_t *node) noexcept
+{
+    return std::string_view(cypher_ast_label_get_name(node),
+            cypher_ast_label_get_name_len(node));
+}
+
+/**
+ * Get the string of a `CYPHER_AST_RELTYPE` node as a view.
+ */
+inline std::string_view reltype_get_name(const cypher_astnode_t *node) noexcept
+{
+    return std::string_view(cypher_ast_reltype_get_name(node),
+            cypher_ast_reltype_get_name_len(node));
+}
+
+/**
+ * Get the string of a `CYPHER_AST_PROP_NAME` node as a view.
+ */
+inline std::string_view prop_name_get_value(const cypher_astnode_t *node) noexcept
+{
+    return std::string_view(cypher_ast_prop_name_get_value(node),
+            cypher_ast_prop_name_get_value_len(node));
+}
+
+/**
+ * Get the string of a `CYPHER_AST_FUNCTION_NAME` node as a view.
+ */
+inline std::string_view function_name_get_value(const cypher_astnode_t *node) noexcept
+{
+    return std::string_view(cypher_ast_function_name_get_value(node),
+            cypher_ast_function_name_get_value_len(node));
+}
+
+/**
+ * Get the string of a `CYPHER_AST_INDEX_NAME` node as a view.
+ */
+inline std::string_view index_name_get_value(const cypher_astnode_t *node) noexcept
+{
+    return std::string_view(cypher_ast_index_name_get_value(node),
+            cypher_ast_index_name_get_value_len(node));
+}
+
+/**
+ * Get the string of a `CYPHER_AST_PROC_NAME` node as a view.
+ */
+inline std::string_view proc_name_get_value(const cypher_astnode_t *node) noexcept
+{
+    return std::string_view(cypher_ast_proc_name_get_value(node),
+            cypher_ast_proc_name_get_value_len(node));
+}
+
+/**
+ * Get the string of a `CYPHER_AST_LINE_COMMENT` node as a view.
+ */
+inline std::string_view line_comment_get_value(const cypher_astnode_t *node) noexcept
+{
+    return std::string_view(cypher_ast_line_comment_get_value(node),
+            cypher_ast_line_comment_get_value_len(node));
+}
+
+/**
+ * Get the string of a `CYPHER_AST_BLOCK_COMMENT` node as a view.
+ */
+inline std::string_view block_comment_get_value(const cypher_astnode_t *node) noexcept
+{
+    return std::string_view(cypher_ast_block_comment_get_value(node),
+            cypher_ast_block_comment_get_value_len(node));
+}
+
+/**
+ * Get the string of a `CYPHER_AST_ERROR` node as a view.
+ */
+inline std::string_view error_get_value(const cypher_astnode_t *node) noexcept
+{
+    return std::string_view(cypher_ast_error_get_value(node),
+            cypher_ast_error_get_value_len(node));
+}
+
+
+/**
+ * An owning handle for a `cypher_parse_result_t`.
+ *
+ * The handle is movable but not copyable, and releases the result when
+ * destroyed.
+ */
+class parse_result
+{
+public:
+    parse_result() noexcept = default;
+    explicit parse_result(cypher_parse_result_t *result) noexcept
+        : _result(result) {}
+    parse_result(const parse_result &) = delete;
+    parse_result &operator=(const parse_result &) = delete;
+    parse_result(parse_result &&other) noexcept
+        : _result(std::exchange(other._result, nullptr)) {}
+    parse_result &operator=(parse_result &&other) noexcept
+    {
+        if (this != &other)
+        {
+            cypher_parse_result_free(_result);
+            _result = std::exchange(other._result, nullptr);
+        }
+        return *this;
+    }
+    ~parse_result() { cypher_parse_result_free(_result); }
+
+    /**
+     * Parse a string.
+     *
+     * @throws std::system_error If the parse fails (e.g. due to memory
+     *         allocation failure). Syntax errors do not throw, but are
+     *         available via `error(...)`.
+     */
+    static parse_result parse(std::string_view s,
+            cypher_parser_config_t *config = nullptr,
+            uint_fast32_t flags = 0)
+    {
+        cypher_parse_result_t *result =
+                cypher_uparse(s.data(), s.size(), nullptr, config, flags);
+        if (result == nullptr)
+        {
+            throw std::system_error(errno, std::generic_category());
+        }
+        return parse_result(result);
+    }
+
+    cypher_parse_result_t *get() const noexcept { return _result; }
+    cypher_parse_result_t *release() noexcept
+    {
+        return std::exchange(_result, nullptr);
+    }
+    explicit operator bool() const noexcept { return _result != nullptr; }
+
+    unsigned int nroots() const noexcept
+    {
+        return cypher_parse_result_nroots(_result);
+    }
+    const cypher_astnode_t *root(unsigned int index) const noexcept
+    {
+        return cypher_parse_result_get_root(_result, index);
+    }
+    unsigned int ndirectives() const noexcept
+    {
+        return cypher_parse_result_ndirectives(_result);
+    }
+    const cypher_astnode_t *directive(unsigned int index) const noexcept
+    {
+        return cypher_parse_result_get_directive(_result, index);
+    }
+    unsigned int nerrors() const noexcept
+    {
+        return cypher_parse_result_nerrors(_result);
+    }
+    const cypher_parse_error_t *error(unsigned int index) const noexcept
+    {
+        return cypher_parse_result_get_error(_result, index);
+    }
+    bool eof() const noexcept { return cypher_parse_result_eof(_result); }
+
+private:
+    cypher_parse_result_t *_result = nullptr;
+};
+
+
+/**
+ * An owning handle for a `cypher_parser_config_t`.
+ */
+class parser_config
+{
+public:
+    /**
+     * @throws std::system_error If the configuration cannot be allocated.
+     */
+    parser_config() : _config(cypher_parser_new_config())
+    {
+        if (_config == nullptr)
+        {
+            throw std::system_error(errno, std::generic_category());
+        }
+    }
+    parser_config(const parser_config &) = delete;
+    parser_config &operator=(const parser_config &) = delete;
+    parser_config(parser_config &&other) noexcept
+        : _config(std::exchange(other._config, nullptr)) {}
+    parser_config &operator=(parser_config &&other) noexcept
+    {
+        if (this != &other)
+        {
+            cypher_parser_config_free(_config);
+            _config = std::exchange(other._config, nullptr);
+        }
+        return *this;
+    }
+    ~parser_config() { cypher_parser_config_free(_config); }
+
+    cypher_parser_config_t *get() const noexcept { return _config; }
+    operator cypher_parser_config_t *() const noexcept { return _config; }
+
+private:
+    cypher_parser_config_t *_config;
+};
+
+
+#define CYPHER_PARSER_HPP_NODE_TYPES(X) \
+    X(statement, CYPHER_AST_STATEMENT) \
+    X(cypher_option, CYPHER_AST_CYPHER_OPTION) \
+    X(cypher_option_param, CYPHER_AST_CYPHER_OPTION_PARAM) \
+    X(explain_option, CYPHER_AST_EXPLAIN_OPTION) \
+    X(profile_option, CYPHER_AST_PROFILE_OPTION) \
+    X(create_node_props_index, CYPHER_AST_CREATE_NODE_PROPS_INDEX) \
+    X(drop_node_props_index, CYPHER_AST_DROP_NODE_PROPS_INDEX) \
+    X(create_node_prop_constraint, CYPHER_AST_CREATE_NODE_PROP_CONSTRAINT) \
+    X(drop_node_prop_constraint, CYPHER_AST_DROP_NODE_PROP_CONSTRAINT) \
+    X(create_rel_prop_constraint, CYPHER_AST_CREATE_REL_PROP_CONSTRAINT) \
+    X(drop_rel_prop_constraint, CYPHER_AST_DROP_REL_PROP_CONSTRAINT) \
+    X(query, CYPHER_AST_QUERY) \
+    X(using_periodic_commit, CYPHER_AST_USING_PERIODIC_COMMIT) \
+    X(load_csv, CYPHER_AST_LOAD_CSV) \
+    X(start, CYPHER_AST_START) \
+    X(node_index_lookup, CYPHER_AST_NODE_INDEX_LOOKUP) \
+    X(node_index_query, CYPHER_AST_NODE_INDEX_QUERY) \
+    X(node_id_lookup, CYPHER_AST_NODE_ID_LOOKUP) \
+    X(all_nodes_scan, CYPHER_AST_ALL_NODES_SCAN) \
+    X(rel_index_lookup, CYPHER_AST_REL_INDEX_LOOKUP) \
+    X(rel_index_query, CYPHER_AST_REL_INDEX_QUERY) \
+    X(rel_id_lookup, CYPHER_AST_REL_ID_LOOKUP) \
+    X(all_rels_scan, CYPHER_AST_ALL_RELS_SCAN) \
+    X(match, CYPHER_AST_MATCH) \
+    X(using_index, CYPHER_AST_USING_INDEX) \
+    X(using_join, CYPHER_AST_USING_JOIN) \
+    X(using_scan, CYPHER_AST_USING_SCAN) \
+    X(merge, CYPHER_AST_MERGE) \
+    X(on_match, CYPHER_AST_ON_MATCH) \
+    X(on_create, CYPHER_AST_ON_CREATE) \
+    X(create, CYPHER_AST_CREATE) \
+    X(set, CYPHER_AST_SET) \
+    X(set_property, CYPHER_AST_SET_PROPERTY) \
+    X(set_all_properties, CYPHER_AST_SET_ALL_PROPERTIES) \
+    X(merge_properties, CYPHER_AST_MERGE_PROPERTIES) \
+    X(set_labels, CYPHER_AST_SET_LABELS) \
+    X(delete, CYPHER_AST_DELETE) \
+    X(remove, CYPHER_AST_REMOVE) \
+    X(remove_labels, CYPHER_AST_REMOVE_LABELS) \
+    X(remove_property, CYPHER_AST_REMOVE_PROPERTY) \
+    X(foreach, CYPHER_AST_FOREACH) \
+    X(with, CYPHER_AST_WITH) \
+    X(unwind, CYPHER_AST_UNWIND) \
+    X(call, CYPHER_AST_CALL) \
+    X(return, CYPHER_AST_RETURN) \
+    X(projection, CYPHER_AST_PROJECTION) \
+    X(order_by, CYPHER_AST_ORDER_BY) \
+    X(sort_item, CYPHER_AST_SORT_ITEM) \
+    X(union, CYPHER_AST_UNION) \
+    X(unary_operator, CYPHER_AST_UNARY_OPERATOR) \
+    X(binary_operator, CYPHER_AST_BINARY_OPERATOR) \
+    X(comparison, CYPHER_AST_COMPARISON) \
+    X(apply_operator, CYPHER_AST_APPLY_OPERATOR) \
+    X(apply_all_operator, CYPHER_AST_APPLY_ALL_OPERATOR) \
+    X(property_operator, CYPHER_AST_PROPERTY_OPERATOR) \
+    X(subscript_operator, CYPHER_AST_SUBSCRIPT_OPERATOR) \
+    X(slice_operator, CYPHER_AST_SLICE_OPERATOR) \
+    X(map_projection, CYPHER_AST_MAP_PROJECTION) \
+    X(map_projection_literal, CYPHER_AST_MAP_PROJECTION_LITERAL) \
+    X(map_projection_property, CYPHER_AST_MAP_PROJECTION_PROPERTY) \
+    X(map_projection_identifier, CYPHER_AST_MAP_PROJECTION_IDENTIFIER) \
+    X(map_projection_all_properties, CYPHER_AST_MAP_PROJECTION_ALL_PROPERTIES) \
+    X(labels_operator, CYPHER_AST_LABELS_OPERATOR) \
+    X(list_comprehension, CYPHER_AST_LIST_COMPREHENSION) \
+    X(pattern_comprehension, CYPHER_AST_PATTERN_COMPREHENSION) \
+    X(case, CYPHER_AST_CASE) \
+    X(filter, CYPHER_AST_FILTER) \
+    X(extract, CYPHER_AST_EXTRACT) \
+    X(reduce, CYPHER_AST_REDUCE) \
+    X(all, CYPHER_AST_ALL) \
+    X(any, CYPHER_AST_ANY) \
+    X(single, CYPHER_AST_SINGLE) \
+    X(none, CYPHER_AST_NONE) \
+    X(collection, CYPHER_AST_COLLECTION) \
+    X(map, CYPHER_AST_MAP) \
+    X(identifier, CYPHER_AST_IDENTIFIER) \
+    X(parameter, CYPHER_AST_PARAMETER) \
+    X(string, CYPHER_AST_STRING) \
+    X(integer, CYPHER_AST_INTEGER) \
+    X(float, CYPHER_AST_FLOAT) \
+    X(true, CYPHER_AST_TRUE) \
+    X(false, CYPHER_AST_FALSE) \
+    X(null, CYPHER_AST_NULL) \
+    X(label, CYPHER_AST_LABEL) \
+    X(reltype, CYPHER_AST_RELTYPE) \
+    X(prop_name, CYPHER_AST_PROP_NAME) \
+    X(function_name, CYPHER_AST_FUNCTION_NAME) \
+    X(index_name, CYPHER_AST_INDEX_NAME) \
+    X(proc_name, CYPHER_AST_PROC_NAME) \
+    X(pattern, CYPHER_AST_PATTERN) \
+    X(named_path, CYPHER_AST_NAMED_PATH) \
+    X(shortest_path, CYPHER_AST_SHORTEST_PATH) \
+    X(pattern_path, CYPHER_AST_PATTERN_PATH) \
+    X(node_pattern, CYPHER_AST_NODE_PATTERN) \
+    X(rel_pattern, CYPHER_AST_REL_PATTERN) \
+    X(range, CYPHER_AST_RANGE) \
+    X(command, CYPHER_AST_COMMAND) \
+    X(line_comment, CYPHER_AST_LINE_COMMENT) \
+    X(block_comment, CYPHER_AST_BLOCK_COMMENT) \
+    X(error, CYPHER_AST_ERROR)
+
+
+/**
+ * A visitor over AST nodes, using the curiously recurring template pattern.
+ *
+ * A derived class defines `visit_<type>(const cypher_astnode_t *)` for the
+ * node types it handles (e.g. `visit_identifier` or `visit_match`), and may
+ * define `visit_default` for all other types. `visit(node)` calls the method
+ * for the node's type via a table indexed by `cypher_astnode_type_t`, which
+ * is built once per derived class; the methods themselves are resolved at
+ * compile time, so no virtual calls are involved.
+ *
+ * @tparam Derived The derived visitor class.
+ * @tparam R The return type of the visit methods.
+ */
+template <typename Derived, typename R = void>
+class visitor
+{
+public:
+    R visit(const cypher_astnode_t *node)
+    {
+        return (derived().*(table()[cypher_astnode_type(node)]))(node);
+    }
+
+    /**
+     * Visit each child of a node, in order. The results of the visits to
+     * the children are discarded.
+     */
+    void visit_children(const cypher_astnode_t *node)
+    {
+        unsigned int n = cypher_astnode_nchildren(node);
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            visit(cypher_astnode_get_child(node, i));
+        }
+    }
+
+    R visit_default(const cypher_astnode_t *node)
+    {
+        if constexpr (std::is_void_v<R>)
+        {
+            derived().visit_children(node);
+        }
+        else
+        {
+            return R();
+        }
+    }
+
+#define CYPHER_PARSER_HPP_VISIT(name, type) \
+    R visit_##name(const cypher_astnode_t *node) \
+    { \
+        return derived().visit_default(node); \
+    }
+    CYPHER_PARSER_HPP_NODE_TYPES(CYPHER_PARSER_HPP_VISIT)
+#undef CYPHER_PARSER_HPP_VISIT
+
+private:
+    typedef R (Derived::*method_t)(const cypher_astnode_t *);
+
+    Derived &derived() noexcept { return static_cast<Derived &>(*this); }
+
+    static const std::array<method_t, 256> &table()
+    {
+        static const std::array<method_t, 256> methods = []()
+        {
+            std::array<method_t, 256> m;
+            m.fill(&Derived::visit_default);
+#define CYPHER_PARSER_HPP_ENTRY(name, type) \
+            m[type] = &Derived::visit_##name;
+            CYPHER_PARSER_HPP_NODE_TYPES(CYPHER_PARSER_HPP_ENTRY)
+#undef CYPHER_PARSER_HPP_ENTRY
+            return m;
+        }();
+        return methods;
+    }
+};
+
+
+} // namespace cypher
+
+#endif/*CYPHER_PARSER_HPP*/
@@ -18,6 +18,8 @@
 #include "errors.h"
 #include "util.h"
 #include <assert.h>
+#include <stdarg.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -25,6 +27,7 @@
 #define CYPHER_ERROR_LABELS_BLOCK_SIZE 8
 #define CYPHER_PARSER_ERRORS_BLOCK_SIZE 8
 
+static int reserve_error(cp_error_tracking_t *et);
 static char *chardesc(char *buf, size_t size, char c);
 static char *error_report(cp_error_tracking_t *et, char **buffer, size_t *cap,
         const char *prefix_format, ...) __cypherlang_format(4, 5);
@@ -134,21 +137,10 @@ int cp_et_reify_potentials(cp_error_tracking_t *et)
         return 0;
     }
 
-    assert(et->nerrors <= et->errors_capacity);
-    if (et->nerrors >= et->errors_capacity)
+    if (reserve_error(et))
     {
-        unsigned int newcap = (et->errors_capacity == 0)?
-            CYPHER_PARSER_ERRORS_BLOCK_SIZE : et->errors_capacity * 2;
-        void *errors = realloc(et->errors,
-                newcap * sizeof(cypher_parse_error_t));
-        if (errors == NULL)
-        {
-            return -1;
-        }
-        et->errors_capacity = newcap;
-        et->errors = errors;
+        return -1;
     }
-    assert(et->nerrors < et->errors_capacity);
 
     char buf[4];
     char *msg = error_report(et, NULL, NULL,
@@ -177,6 +169,66 @@ int cp_et_reify_potentials(cp_error_tracking_t *et)
 }
 
 
+int cp_et_add_error(cp_error_tracking_t *et,
+        struct cypher_input_position position, const char *format, ...)
+{
+    if (reserve_error(et))
+    {
+        return -1;
+    }
+
+    va_list ap;
+    va_start(ap, format);
+    int len = vsnprintf(NULL, 0, format, ap);
+    va_end(ap);
+    if (len < 0)
+    {
+        return -1;
+    }
+    char *msg = malloc(len + 1);
+    if (msg == NULL)
+    {
+        return -1;
+    }
+    va_start(ap, format);
+    vsnprintf(msg, len + 1, format, ap);
+    va_end(ap);
+
+    // keep errors ordered by position
+    unsigned int i = et->nerrors;
+    for (; i > 0 && et->errors[i-1].position.offset > position.offset; --i)
+        ;
+    memmove(et->errors + i + 1, et->errors + i,
+            (et->nerrors - i) * sizeof(cypher_parse_error_t));
+    memset(&(et->errors[i]), 0, sizeof(cypher_parse_error_t));
+    et->errors[i].position = position;
+    et->errors[i].msg = msg;
+    ++(et->nerrors);
+    return 0;
+}
+
+
+int reserve_error(cp_error_tracking_t *et)
+{
+    assert(et->nerrors <= et->errors_capacity);
+    if (et->nerrors >= et->errors_capacity)
+    {
+        unsigned int newcap = (et->errors_capacity == 0)?
+            CYPHER_PARSER_ERRORS_BLOCK_SIZE : et->errors_capacity * 2;
+        void *errors = realloc(et->errors,
+                newcap * sizeof(cypher_parse_error_t));
+        if (errors == NULL)
+        {
+            return -1;
+        }
+        et->errors_capacity = newcap;
+        et->errors = errors;
+    }
+    assert(et->nerrors < et->errors_capacity);
+    return 0;
+}
+
+
 char *chardesc(char *buf, size_t size, char c)
 {
     assert(size >= 4);
@@ -58,6 +58,10 @@ int cp_et_note_potential_error(cp_error_tracking_t *et,
 
 int cp_et_reify_potentials(cp_error_tracking_t *et);
 
+int cp_et_add_error(cp_error_tracking_t *et,
+        struct cypher_input_position position, const char *format, ...)
+        __cypherlang_format(3, 4);
+
 static inline void cp_et_clear_potentials(cp_error_tracking_t *et)
 {
     et->nlabels = 0;
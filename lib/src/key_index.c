@@ -0,0 +1,248 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "key_index.h"
+#include "ast.h"
+#include "astnode.h"
+#include <assert.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+// Stored in place of an index for entries that are never indexed
+#define UNINDEXED ((uintptr_t)1)
+
+
+static inline uint32_t hash_key(const char *s, size_t n)
+{
+    // FNV-1a
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < n; ++i)
+    {
+        h ^= (unsigned char)s[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+
+static inline bool key_equals(const char *a, size_t alen, const char *b,
+        size_t blen)
+{
+    return alen == blen && memcmp(a, b, alen) == 0;
+}
+
+
+static int check_duplicates(unsigned int n, cp_key_index_key_t key,
+        const void *entries, cp_key_index_duplicate_t duplicate,
+        void *userdata)
+{
+    for (unsigned int i = 1; i < n; ++i)
+    {
+        size_t ilen;
+        const char *ikey = key(entries, i, &ilen);
+        if (ikey == NULL)
+        {
+            continue;
+        }
+        for (unsigned int j = i; j-- > 0; )
+        {
+            size_t jlen;
+            const char *jkey = key(entries, j, &jlen);
+            if (jkey != NULL && key_equals(ikey, ilen, jkey, jlen))
+            {
+                if (duplicate(userdata, j, i))
+                {
+                    return -1;
+                }
+                break;
+            }
+        }
+    }
+    return 0;
+}
+
+
+static size_t index_size(unsigned int n)
+{
+    // at most half full
+    unsigned int nslots = CP_KEY_INDEX_MIN_ENTRIES * 2;
+    while (nslots < n * 2)
+    {
+        nslots *= 2;
+    }
+    return sizeof(struct cp_key_index) + nslots * sizeof(unsigned int);
+}
+
+
+static int build(struct cp_key_index *idx, size_t size, unsigned int n,
+        cp_key_index_key_t key, const void *entries,
+        cp_key_index_duplicate_t duplicate, void *userdata)
+{
+    idx->mask = (size - sizeof(struct cp_key_index)) / sizeof(unsigned int)
+        - 1;
+
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        size_t ilen;
+        const char *ikey = key(entries, i, &ilen);
+        if (ikey == NULL)
+        {
+            continue;
+        }
+        unsigned int s = hash_key(ikey, ilen) & idx->mask;
+        for (; idx->slots[s] != 0; s = (s + 1) & idx->mask)
+        {
+            unsigned int j = idx->slots[s] - 1;
+            size_t jlen;
+            const char *jkey = key(entries, j, &jlen);
+            if (key_equals(ikey, ilen, jkey, jlen))
+            {
+                break;
+            }
+        }
+        if (idx->slots[s] != 0 && duplicate != NULL)
+        {
+            if (duplicate(userdata, idx->slots[s] - 1, i))
+            {
+                return -1;
+            }
+        }
+        idx->slots[s] = i + 1;
+    }
+    return 0;
+}
+
+
+int cp_key_index_init(atomic_uintptr_t *index, unsigned int n,
+        cp_key_index_key_t key, const void *entries,
+        cp_key_index_duplicate_t duplicate, void *userdata)
+{
+    atomic_init(index, 0);
+    if (n < CP_KEY_INDEX_MIN_ENTRIES)
+    {
+        return (duplicate == NULL)? 0 :
+            check_duplicates(n, key, entries, duplicate, userdata);
+    }
+
+    if (duplicate == NULL)
+    {
+        // nodes in a scratch area are never released individually, so
+        // must not hold an index allocated later
+        if (cp_ast_scratch_active())
+        {
+            atomic_init(index, UNINDEXED);
+        }
+        return 0;
+    }
+
+    // the duplicate check builds the index, so it is kept
+    size_t size = index_size(n);
+    struct cp_key_index *idx = cp_astnode_calloc(size);
+    if (idx == NULL)
+    {
+        return -1;
+    }
+    if (build(idx, size, n, key, entries, duplicate, userdata))
+    {
+        int errsv = errno;
+        cp_astnode_free(idx);
+        errno = errsv;
+        return -1;
+    }
+    atomic_init(index, (uintptr_t)idx);
+    return 0;
+}
+
+
+const struct cp_key_index *cp_key_index_get(atomic_uintptr_t *index,
+        unsigned int n, cp_key_index_key_t key, const void *entries)
+{
+    uintptr_t current = atomic_load_explicit(index, memory_order_acquire);
+    if (current != 0 || n < CP_KEY_INDEX_MIN_ENTRIES)
+    {
+        return (current == UNINDEXED)? NULL :
+            (const struct cp_key_index *)current;
+    }
+
+    // built outside of any arena, as the lookup may be long after the
+    // node was constructed
+    size_t size = index_size(n);
+    int errsv = errno;
+    struct cp_key_index *idx = calloc(1, size);
+    if (idx == NULL)
+    {
+        errno = errsv;
+        return NULL;
+    }
+    build(idx, size, n, key, entries, NULL, NULL);
+
+    if (!atomic_compare_exchange_strong_explicit(index, &current,
+                (uintptr_t)idx, memory_order_acq_rel, memory_order_acquire))
+    {
+        // another thread built the index first
+        free(idx);
+        return (current == UNINDEXED)? NULL :
+            (const struct cp_key_index *)current;
+    }
+    return idx;
+}
+
+
+int cp_key_index_find(const struct cp_key_index *index, unsigned int n,
+        cp_key_index_key_t key, const void *entries, const char *name,
+        size_t length)
+{
+    if (index == NULL)
+    {
+        for (unsigned int i = n; i-- > 0; )
+        {
+            size_t ilen;
+            const char *ikey = key(entries, i, &ilen);
+            if (ikey != NULL && key_equals(ikey, ilen, name, length))
+            {
+                return (int)i;
+            }
+        }
+        return -1;
+    }
+
+    unsigned int s = hash_key(name, length) & index->mask;
+    for (; index->slots[s] != 0; s = (s + 1) & index->mask)
+    {
+        unsigned int i = index->slots[s] - 1;
+        size_t ilen;
+        const char *ikey = key(entries, i, &ilen);
+        if (key_equals(ikey, ilen, name, length))
+        {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+
+void cp_key_index_free(atomic_uintptr_t *index)
+{
+    uintptr_t current = atomic_load_explicit(index, memory_order_acquire);
+    if (current != 0 && current != UNINDEXED)
+    {
+        cp_astnode_free((void *)current);
+    }
+}
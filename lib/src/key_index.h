@@ -0,0 +1,86 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CYPHER_PARSER_KEY_INDEX_H
+#define CYPHER_PARSER_KEY_INDEX_H
+
+#include "atomics.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+
+// Maps with fewer entries than this are searched linearly
+#define CP_KEY_INDEX_MIN_ENTRIES 8
+
+/*
+ * Get the key of entry i, or NULL if the entry has no key.
+ */
+typedef const char *(*cp_key_index_key_t)(const void *entries, unsigned int i,
+        size_t *length);
+
+/*
+ * Invoked for an entry (later) that repeats the key of an earlier entry.
+ * Returns 0, or -1 (with errno set) to abandon building the index.
+ */
+typedef int (*cp_key_index_duplicate_t)(void *userdata, unsigned int earlier,
+        unsigned int later);
+
+/*
+ * An open addressed hash index over the keys of a set of entries. Where
+ * a key is repeated, the index refers to the last entry with that key.
+ */
+struct cp_key_index
+{
+    unsigned int mask;
+    unsigned int slots[]; // entry index + 1, or 0 if the slot is empty
+};
+
+
+/*
+ * Initialize the index of the entries' keys, when constructing the node
+ * that holds them. The index itself is built on first use (see
+ * cp_key_index_get), unless duplicate is not NULL, in which case it is
+ * invoked for each repeated key and the index built to find them is kept
+ * (allocated as an AST node allocation, see cp_astnode_calloc).
+ *
+ * Returns 0 on success, or -1 on failure (errno will be set).
+ */
+int cp_key_index_init(atomic_uintptr_t *index, unsigned int n,
+        cp_key_index_key_t key, const void *entries,
+        cp_key_index_duplicate_t duplicate, void *userdata);
+
+/*
+ * Get the index of the entries' keys, building it if this is the first
+ * use. It is safe to call concurrently: if several threads build the index,
+ * one is kept and the others discarded. Returns NULL for fewer than
+ * CP_KEY_INDEX_MIN_ENTRIES, or if the index cannot be built.
+ */
+const struct cp_key_index *cp_key_index_get(atomic_uintptr_t *index,
+        unsigned int n, cp_key_index_key_t key, const void *entries);
+
+/*
+ * Find the entry with the specified key, using the index when it is not
+ * NULL or otherwise by searching. Returns the index of the last entry with
+ * the key, or -1 if there is none.
+ */
+int cp_key_index_find(const struct cp_key_index *index, unsigned int n,
+        cp_key_index_key_t key, const void *entries, const char *name,
+        size_t length);
+
+void cp_key_index_free(atomic_uintptr_t *index);
+
+
+#endif/*CYPHER_PARSER_KEY_INDEX_H*/
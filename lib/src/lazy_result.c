@@ -0,0 +1,367 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "lazy_result.h"
+#include "ast.h"
+#include "result.h"
+#include "segment.h"
+#include "util.h"
+#include <assert.h>
+#include <errno.h>
+#include <limits.h>
+
+#define NO_SEGMENT UINT_MAX
+
+
+static cypher_parse_segment_t *materialize(struct cp_lazy_result *lazy,
+        unsigned int index);
+static void lru_remove(struct cp_lazy_result *lazy, unsigned int index);
+static void lru_push(struct cp_lazy_result *lazy, unsigned int index);
+static inline void lazy_lock(struct cp_lazy_result *lazy);
+static inline void lazy_unlock(struct cp_lazy_result *lazy);
+
+
+cypher_parse_result_t *cp_lazy_result(unsigned int initial_ordinal,
+        unsigned int max_cached, cp_segment_loader_t loader,
+        void *loader_data, void (*loader_data_free)(void *data))
+{
+    assert(max_cached > 0);
+    assert(loader != NULL);
+    cypher_parse_result_t *result = calloc(1, sizeof(cypher_parse_result_t));
+    if (result == NULL)
+    {
+        return NULL;
+    }
+    struct cp_lazy_result *lazy = calloc(1, sizeof(struct cp_lazy_result));
+    if (lazy == NULL)
+    {
+        free(result);
+        return NULL;
+    }
+#ifdef HAVE_PTHREADS
+    int err = pthread_mutex_init(&(lazy->mutex), NULL);
+    if (err != 0)
+    {
+        free(lazy);
+        free(result);
+        errno = err;
+        return NULL;
+    }
+#endif
+    lazy->next_ordinal = initial_ordinal;
+    lazy->max_cached = max_cached;
+    lazy->lru_head = NO_SEGMENT;
+    lazy->lru_tail = NO_SEGMENT;
+    lazy->loader = loader;
+    lazy->loader_data = loader_data;
+    lazy->loader_data_free = loader_data_free;
+    result->lazy = lazy;
+    return result;
+}
+
+
+int cp_lazy_result_add_segment(cypher_parse_result_t *result,
+        cypher_parse_segment_t *segment)
+{
+    struct cp_lazy_result *lazy = result->lazy;
+    assert(lazy != NULL);
+
+    if (cp_result_merge_segment_errors(result, segment))
+    {
+        return -1;
+    }
+
+    if (lazy->nsegments >= lazy->segments_cap)
+    {
+        unsigned int n = (lazy->segments_cap == 0)?
+                8 : lazy->segments_cap * 2;
+        struct cp_lazy_segment *segments = realloc(lazy->segments,
+                n * sizeof(struct cp_lazy_segment));
+        if (segments == NULL)
+        {
+            return -1;
+        }
+        lazy->segments = segments;
+        lazy->segments_cap = n;
+    }
+
+    bool has_directive = (segment->directive != NULL);
+    if (has_directive && lazy->ndirectives >= lazy->directives_cap)
+    {
+        unsigned int n = (lazy->directives_cap == 0)?
+                8 : lazy->directives_cap * 2;
+        unsigned int *directives = realloc(lazy->directives,
+                n * sizeof(unsigned int));
+        if (directives == NULL)
+        {
+            return -1;
+        }
+        lazy->directives = directives;
+        lazy->directives_cap = n;
+    }
+
+    struct cp_lazy_segment *s = &(lazy->segments[lazy->nsegments]);
+    memset(s, 0, sizeof(struct cp_lazy_segment));
+    s->range = segment->range;
+    s->ordinal = lazy->next_ordinal;
+    s->nnodes = segment->nnodes;
+    s->first_root = lazy->nroots;
+    s->nroots = segment->nroots;
+    s->has_directive = has_directive;
+    s->lru_prev = NO_SEGMENT;
+    s->lru_next = NO_SEGMENT;
+
+    if (has_directive)
+    {
+        lazy->directives[(lazy->ndirectives)++] = lazy->nsegments;
+    }
+    ++(lazy->nsegments);
+    cp_ast_vfield_widths(segment->roots, segment->nroots, &(lazy->widths));
+    lazy->nroots += segment->nroots;
+    lazy->next_ordinal += segment->nnodes;
+    result->nnodes += segment->nnodes;
+    return 0;
+}
+
+
+void cp_lazy_result_free(struct cp_lazy_result *lazy)
+{
+    if (lazy == NULL)
+    {
+        return;
+    }
+    for (unsigned int i = lazy->lru_head; i != NO_SEGMENT; )
+    {
+        struct cp_lazy_segment *s = &(lazy->segments[i]);
+        i = s->lru_next;
+        cypher_parse_segment_release(s->segment);
+    }
+    free(lazy->segments);
+    free(lazy->directives);
+    if (lazy->loader_data_free != NULL)
+    {
+        lazy->loader_data_free(lazy->loader_data);
+    }
+#ifdef HAVE_PTHREADS
+    pthread_mutex_destroy(&(lazy->mutex));
+#endif
+    free(lazy);
+}
+
+
+void cp_lazy_result_release_deferred(struct cp_lazy_result *lazy)
+{
+    lazy_lock(lazy);
+    for (unsigned int i = lazy->lru_head; i != NO_SEGMENT; )
+    {
+        struct cp_lazy_segment *s = &(lazy->segments[i]);
+        i = s->lru_next;
+        cypher_parse_segment_release_deferred(s->segment);
+        s->segment = NULL;
+        s->lru_prev = NO_SEGMENT;
+        s->lru_next = NO_SEGMENT;
+    }
+    lazy->lru_head = NO_SEGMENT;
+    lazy->lru_tail = NO_SEGMENT;
+    lazy->ncached = 0;
+    lazy_unlock(lazy);
+}
+
+
+const cypher_astnode_t *cp_lazy_result_get_root(struct cp_lazy_result *lazy,
+        unsigned int index)
+{
+    if (index >= lazy->nroots)
+    {
+        return NULL;
+    }
+
+    // find the last segment starting at or before the root
+    unsigned int lo = 0, hi = lazy->nsegments;
+    while (hi - lo > 1)
+    {
+        unsigned int mid = lo + (hi - lo) / 2;
+        if (lazy->segments[mid].first_root <= index)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    assert(index - lazy->segments[lo].first_root < lazy->segments[lo].nroots);
+
+    lazy_lock(lazy);
+    const cypher_astnode_t *root = NULL;
+    cypher_parse_segment_t *segment = materialize(lazy, lo);
+    if (segment != NULL)
+    {
+        root = segment->roots[index - lazy->segments[lo].first_root];
+    }
+    lazy_unlock(lazy);
+    return root;
+}
+
+
+const cypher_astnode_t *cp_lazy_result_get_directive(
+        struct cp_lazy_result *lazy, unsigned int index)
+{
+    if (index >= lazy->ndirectives)
+    {
+        return NULL;
+    }
+    lazy_lock(lazy);
+    const cypher_astnode_t *directive = NULL;
+    cypher_parse_segment_t *segment =
+            materialize(lazy, lazy->directives[index]);
+    if (segment != NULL)
+    {
+        directive = segment->directive;
+    }
+    lazy_unlock(lazy);
+    return directive;
+}
+
+
+int cp_lazy_result_fprint_ast(struct cp_lazy_result *lazy, FILE *stream,
+        unsigned int width,
+        const struct cypher_parser_colorization *colorization,
+        uint_fast32_t flags)
+{
+    // field widths were computed over all roots as segments were added, so
+    // that the output matches that of a fully materialized result
+    int result = 0;
+    lazy_lock(lazy);
+    for (unsigned int i = 0; i < lazy->nsegments; ++i)
+    {
+        if (lazy->segments[i].nroots == 0)
+        {
+            continue;
+        }
+        cypher_parse_segment_t *segment = materialize(lazy, i);
+        if (segment == NULL ||
+                cp_ast_vfprint_widths(segment->roots, segment->nroots,
+                    stream, width, colorization, &(lazy->widths)))
+        {
+            result = -1;
+            break;
+        }
+    }
+    lazy_unlock(lazy);
+    return result;
+}
+
+
+cypher_parse_segment_t *materialize(struct cp_lazy_result *lazy,
+        unsigned int index)
+{
+    assert(index < lazy->nsegments);
+    struct cp_lazy_segment *s = &(lazy->segments[index]);
+    if (s->segment != NULL)
+    {
+        lru_remove(lazy, index);
+        lru_push(lazy, index);
+        return s->segment;
+    }
+
+    cypher_parse_segment_t *segment = lazy->loader(lazy->loader_data, s);
+    if (segment == NULL)
+    {
+        return NULL;
+    }
+    if (segment->nnodes != s->nnodes || segment->nroots != s->nroots ||
+            (segment->directive != NULL) != s->has_directive)
+    {
+        // the input has changed since it was first parsed
+        cypher_parse_segment_release(segment);
+        errno = EIO;
+        return NULL;
+    }
+
+    while (lazy->ncached >= lazy->max_cached)
+    {
+        unsigned int evict = lazy->lru_tail;
+        assert(evict != NO_SEGMENT);
+        lru_remove(lazy, evict);
+        cypher_parse_segment_release(lazy->segments[evict].segment);
+        lazy->segments[evict].segment = NULL;
+        --(lazy->ncached);
+    }
+
+    s->segment = segment;
+    lru_push(lazy, index);
+    ++(lazy->ncached);
+    return segment;
+}
+
+
+void lru_remove(struct cp_lazy_result *lazy, unsigned int index)
+{
+    struct cp_lazy_segment *s = &(lazy->segments[index]);
+    if (s->lru_prev != NO_SEGMENT)
+    {
+        lazy->segments[s->lru_prev].lru_next = s->lru_next;
+    }
+    else
+    {
+        lazy->lru_head = s->lru_next;
+    }
+    if (s->lru_next != NO_SEGMENT)
+    {
+        lazy->segments[s->lru_next].lru_prev = s->lru_prev;
+    }
+    else
+    {
+        lazy->lru_tail = s->lru_prev;
+    }
+    s->lru_prev = NO_SEGMENT;
+    s->lru_next = NO_SEGMENT;
+}
+
+
+void lru_push(struct cp_lazy_result *lazy, unsigned int index)
+{
+    struct cp_lazy_segment *s = &(lazy->segments[index]);
+    s->lru_prev = NO_SEGMENT;
+    s->lru_next = lazy->lru_head;
+    if (lazy->lru_head != NO_SEGMENT)
+    {
+        lazy->segments[lazy->lru_head].lru_prev = index;
+    }
+    else
+    {
+        lazy->lru_tail = index;
+    }
+    lazy->lru_head = index;
+}
+
+
+void lazy_lock(struct cp_lazy_result *lazy)
+{
+#ifdef HAVE_PTHREADS
+    pthread_mutex_lock(&(lazy->mutex));
+#endif
+}
+
+
+void lazy_unlock(struct cp_lazy_result *lazy)
+{
+#ifdef HAVE_PTHREADS
+    pthread_mutex_unlock(&(lazy->mutex));
+#endif
+}
@@ -0,0 +1,110 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CYPHER_PARSER_LAZY_RESULT_H
+#define CYPHER_PARSER_LAZY_RESULT_H
+
+#include "cypher-parser.h"
+#include "ast.h"
+#ifdef HAVE_PTHREADS
+#include <pthread.h>
+#endif
+
+
+struct cp_lazy_segment
+{
+    struct cypher_input_range range;
+    unsigned int ordinal;
+    unsigned int nnodes;
+    unsigned int first_root;
+    unsigned int nroots;
+    bool has_directive;
+
+    // when materialized, the segment and its position in the LRU list
+    cypher_parse_segment_t *segment;
+    unsigned int lru_prev;
+    unsigned int lru_next;
+};
+
+
+/*
+ * Reparse a previously recorded segment, returning a new segment with the
+ * same range, ordinals and roots (or NULL, with errno set, on failure).
+ */
+typedef cypher_parse_segment_t *(*cp_segment_loader_t)(void *data,
+        const struct cp_lazy_segment *segment);
+
+
+struct cp_lazy_result
+{
+    struct cp_lazy_segment *segments;
+    unsigned int nsegments;
+    unsigned int segments_cap;
+
+    unsigned int *directives;
+    unsigned int ndirectives;
+    unsigned int directives_cap;
+
+    unsigned int nroots;
+    unsigned int next_ordinal;
+
+    // field widths over all roots, recorded as segments are added so that
+    // printing need not materialize every segment beforehand
+    struct cp_ast_field_widths widths;
+
+#ifdef HAVE_PTHREADS
+    // accessors take a const result, so concurrent readers share the cache
+    pthread_mutex_t mutex;
+#endif
+    unsigned int max_cached;
+    unsigned int ncached;
+    unsigned int lru_head;
+    unsigned int lru_tail;
+
+    cp_segment_loader_t loader;
+    void *loader_data;
+    void (*loader_data_free)(void *data);
+};
+
+
+cypher_parse_result_t *cp_lazy_result(unsigned int initial_ordinal,
+        unsigned int max_cached, cp_segment_loader_t loader,
+        void *loader_data, void (*loader_data_free)(void *data));
+
+int cp_lazy_result_add_segment(cypher_parse_result_t *result,
+        cypher_parse_segment_t *segment);
+
+void cp_lazy_result_free(struct cp_lazy_result *lazy);
+
+/*
+ * Release all materialized segments through the deferred reclaimer, leaving
+ * none cached.
+ */
+void cp_lazy_result_release_deferred(struct cp_lazy_result *lazy);
+
+const cypher_astnode_t *cp_lazy_result_get_root(struct cp_lazy_result *lazy,
+        unsigned int index);
+
+const cypher_astnode_t *cp_lazy_result_get_directive(
+        struct cp_lazy_result *lazy, unsigned int index);
+
+int cp_lazy_result_fprint_ast(struct cp_lazy_result *lazy, FILE *stream,
+        unsigned int width,
+        const struct cypher_parser_colorization *colorization,
+        uint_fast32_t flags);
+
+
+#endif/*CYPHER_PARSER_LAZY_RESULT_H*/
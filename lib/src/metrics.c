@@ -0,0 +1,302 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "atomics.h"
+#include "metrics.h"
+#include "util.h"
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+
+
+#define NSHARDS 16
+#define CACHE_LINE_SIZE 64
+
+// latency bucket n has an upper bound of 2^n microseconds
+#define LATENCY_NBUCKETS 21
+// size bucket n has an upper bound of 2^(n+4) bytes
+#define SIZE_MIN_LOG2 4
+#define SIZE_NBUCKETS 17
+
+
+/*
+ * Counters are sharded, with each thread updating a single shard, so that
+ * concurrent parsers rarely contend on the same cache line. Histogram
+ * buckets hold non-cumulative counts, with a final bucket for values
+ * exceeding all bounds.
+ */
+struct counters
+{
+    atomic_uint_fast64_t parses;
+    atomic_uint_fast64_t segments;
+    atomic_uint_fast64_t bytes;
+    atomic_uint_fast64_t errors;
+    atomic_uint_fast64_t nodes;
+    atomic_uint_fast64_t quick_segments;
+    atomic_uint_fast64_t latency[LATENCY_NBUCKETS + 1];
+    atomic_uint_fast64_t latency_sum;
+    atomic_uint_fast64_t size[SIZE_NBUCKETS + 1];
+    atomic_uint_fast64_t size_sum;
+};
+
+union shard
+{
+    struct counters c;
+    char padding[(sizeof(struct counters) + CACHE_LINE_SIZE - 1) /
+            CACHE_LINE_SIZE * CACHE_LINE_SIZE];
+};
+
+static union shard shards[NSHARDS];
+static atomic_bool enabled;
+static atomic_uint next_shard;
+// the shard used by this thread, plus one (or 0 if not yet assigned)
+static THREAD_LOCAL unsigned int thread_shard = 0;
+
+
+static struct counters *thread_counters(void);
+static unsigned int ceil_log2(uint64_t v);
+static void add(atomic_uint_fast64_t *counter, uint64_t v);
+static uint64_t sum(size_t offset);
+static int write_counter(FILE *stream, const char *name, const char *help,
+        uint64_t value);
+static int write_histogram(FILE *stream, const char *name, const char *help,
+        size_t buckets_offset, unsigned int nbuckets, size_t sum_offset,
+        double (*bound)(unsigned int), unsigned int sum_decimals);
+static double latency_bound(unsigned int bucket);
+static double size_bound(unsigned int bucket);
+
+
+void cypher_parser_metrics_enable(void)
+{
+    atomic_store_explicit(&enabled, true, memory_order_relaxed);
+}
+
+
+void cypher_parser_metrics_disable(void)
+{
+    atomic_store_explicit(&enabled, false, memory_order_relaxed);
+}
+
+
+void cypher_parser_metrics_reset(void)
+{
+    for (unsigned int i = 0; i < NSHARDS; ++i)
+    {
+        atomic_uint_fast64_t *counters =
+                (atomic_uint_fast64_t *)&(shards[i].c);
+        size_t n = sizeof(struct counters) / sizeof(atomic_uint_fast64_t);
+        for (size_t j = 0; j < n; ++j)
+        {
+            atomic_store_explicit(&(counters[j]), 0, memory_order_relaxed);
+        }
+    }
+}
+
+
+bool cp_metrics_enabled(void)
+{
+    return atomic_load_explicit(&enabled, memory_order_relaxed);
+}
+
+
+void cp_metrics_parse(void)
+{
+    add(&(thread_counters()->parses), 1);
+}
+
+
+void cp_metrics_segment(uint64_t duration, size_t nbytes,
+        unsigned int nerrors, unsigned int nnodes)
+{
+    struct counters *c = thread_counters();
+    add(&(c->segments), 1);
+    add(&(c->bytes), nbytes);
+    add(&(c->errors), nerrors);
+    add(&(c->nodes), nnodes);
+
+    unsigned int bucket = ceil_log2((duration + 999) / 1000);
+    add(&(c->latency[minu(bucket, LATENCY_NBUCKETS)]), 1);
+    add(&(c->latency_sum), duration);
+
+    bucket = ceil_log2(nbytes);
+    bucket = (bucket > SIZE_MIN_LOG2)? bucket - SIZE_MIN_LOG2 : 0;
+    add(&(c->size[minu(bucket, SIZE_NBUCKETS)]), 1);
+    add(&(c->size_sum), nbytes);
+}
+
+
+void cp_metrics_quick_segment(void)
+{
+    add(&(thread_counters()->quick_segments), 1);
+}
+
+
+struct counters *thread_counters(void)
+{
+    if (thread_shard == 0)
+    {
+        thread_shard = (atomic_fetch_add_explicit(&next_shard, 1,
+                    memory_order_relaxed) % NSHARDS) + 1;
+    }
+    return &(shards[thread_shard - 1].c);
+}
+
+
+// the smallest n such that v <= 2^n
+unsigned int ceil_log2(uint64_t v)
+{
+    if (v <= 1)
+    {
+        return 0;
+    }
+#ifdef __GNUC__
+    return 64 - __builtin_clzll(v - 1);
+#else
+    unsigned int n = 0;
+    for (--v; v > 0; v >>= 1)
+    {
+        ++n;
+    }
+    return n;
+#endif
+}
+
+
+void add(atomic_uint_fast64_t *counter, uint64_t v)
+{
+    atomic_fetch_add_explicit(counter, v, memory_order_relaxed);
+}
+
+
+uint64_t sum(size_t offset)
+{
+    uint64_t total = 0;
+    for (unsigned int i = 0; i < NSHARDS; ++i)
+    {
+        atomic_uint_fast64_t *counter = (atomic_uint_fast64_t *)
+                ((char *)&(shards[i].c) + offset);
+        total += atomic_load_explicit(counter, memory_order_relaxed);
+    }
+    return total;
+}
+
+
+int cypher_parser_metrics_write(FILE *stream)
+{
+    REQUIRE(stream != NULL, -1);
+
+    if (write_counter(stream, "cypher_parser_parses_total",
+                "Number of calls to parse input.",
+                sum(offsetof(struct counters, parses))) ||
+        write_counter(stream, "cypher_parser_segments_total",
+                "Number of segments parsed.",
+                sum(offsetof(struct counters, segments))) ||
+        write_counter(stream, "cypher_parser_bytes_total",
+                "Number of bytes of input parsed.",
+                sum(offsetof(struct counters, bytes))) ||
+        write_counter(stream, "cypher_parser_errors_total",
+                "Number of parse errors.",
+                sum(offsetof(struct counters, errors))) ||
+        write_counter(stream, "cypher_parser_ast_nodes_total",
+                "Number of AST nodes produced.",
+                sum(offsetof(struct counters, nodes))) ||
+        write_counter(stream, "cypher_parser_quick_segments_total",
+                "Number of segments emitted by the quick parser.",
+                sum(offsetof(struct counters, quick_segments))) ||
+        write_histogram(stream, "cypher_parser_parse_duration_seconds",
+                "Time taken to parse each segment.",
+                offsetof(struct counters, latency), LATENCY_NBUCKETS,
+                offsetof(struct counters, latency_sum), latency_bound, 9) ||
+        write_histogram(stream, "cypher_parser_statement_size_bytes",
+                "Size of the input of each segment.",
+                offsetof(struct counters, size), SIZE_NBUCKETS,
+                offsetof(struct counters, size_sum), size_bound, 0))
+    {
+        return -1;
+    }
+    return 0;
+}
+
+
+int write_counter(FILE *stream, const char *name, const char *help,
+        uint64_t value)
+{
+    if (fprintf(stream, "# HELP %s %s\n# TYPE %s counter\n%s %" PRIu64 "\n",
+                name, help, name, name, value) < 0)
+    {
+        return -1;
+    }
+    return 0;
+}
+
+
+int write_histogram(FILE *stream, const char *name, const char *help,
+        size_t buckets_offset, unsigned int nbuckets, size_t sum_offset,
+        double (*bound)(unsigned int), unsigned int sum_decimals)
+{
+    if (fprintf(stream, "# HELP %s %s\n# TYPE %s histogram\n",
+                name, help, name) < 0)
+    {
+        return -1;
+    }
+
+    // the count is the cumulative total over buckets, rather than a
+    // separate counter, so that it is consistent with them
+    uint64_t count = 0;
+    for (unsigned int i = 0; i <= nbuckets; ++i)
+    {
+        count += sum(buckets_offset + i * sizeof(atomic_uint_fast64_t));
+        int r = (i < nbuckets)?
+            fprintf(stream, "%s_bucket{le=\"%.9g\"} %" PRIu64 "\n",
+                    name, bound(i), count) :
+            fprintf(stream, "%s_bucket{le=\"+Inf\"} %" PRIu64 "\n",
+                    name, count);
+        if (r < 0)
+        {
+            return -1;
+        }
+    }
+
+    // the sum is a fixed point value, with the given number of decimals
+    uint64_t total = sum(sum_offset);
+    uint64_t divisor = 1;
+    for (unsigned int i = 0; i < sum_decimals; ++i)
+    {
+        divisor *= 10;
+    }
+    int r = (sum_decimals > 0)?
+        fprintf(stream, "%s_sum %" PRIu64 ".%0*" PRIu64 "\n", name,
+                total / divisor, (int)sum_decimals, total % divisor) :
+        fprintf(stream, "%s_sum %" PRIu64 "\n", name, total);
+    if (r < 0 || fprintf(stream, "%s_count %" PRIu64 "\n", name, count) < 0)
+    {
+        return -1;
+    }
+    return 0;
+}
+
+
+double latency_bound(unsigned int bucket)
+{
+    return (double)((uint64_t)1 << bucket) / 1e6;
+}
+
+
+double size_bound(unsigned int bucket)
+{
+    return (double)((uint64_t)1 << (bucket + SIZE_MIN_LOG2));
+}
@@ -0,0 +1,46 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CYPHER_PARSER_METRICS_H
+#define CYPHER_PARSER_METRICS_H
+
+#include "cypher-parser.h"
+
+
+/*
+ * Check if the metrics registry is enabled. Callers should check once per
+ * parse, and skip all other metrics calls when disabled.
+ */
+bool cp_metrics_enabled(void);
+
+/*
+ * Count a call to parse.
+ */
+void cp_metrics_parse(void);
+
+/*
+ * Count a parsed segment.
+ */
+void cp_metrics_segment(uint64_t duration, size_t nbytes,
+        unsigned int nerrors, unsigned int nnodes);
+
+/*
+ * Count a segment emitted by the quick parser.
+ */
+void cp_metrics_quick_segment(void);
+
+
+#endif/*CYPHER_PARSER_METRICS_H*/
@@ -0,0 +1,145 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "node_index.h"
+#include "ast.h"
+#include "astnode.h"
+#include "util.h"
+#include <assert.h>
+
+
+void cp_node_index_init(cp_node_index_t *index)
+{
+    index->lists = NULL;
+}
+
+
+void cp_node_index_cleanup(cp_node_index_t *index)
+{
+    if (index->lists == NULL)
+    {
+        return;
+    }
+    for (unsigned int i = cp_ast_ntypes(); i-- > 0; )
+    {
+        cp_node_list_cleanup(&(index->lists[i]));
+    }
+    free(index->lists);
+    index->lists = NULL;
+}
+
+
+int cp_node_index_add(cp_node_index_t *index, const cypher_astnode_t *node)
+{
+    if (index->lists == NULL)
+    {
+        unsigned int ntypes = cp_ast_ntypes();
+        index->lists = calloc(ntypes, sizeof(cp_node_list_t));
+        if (index->lists == NULL)
+        {
+            return -1;
+        }
+        for (unsigned int i = 0; i < ntypes; ++i)
+        {
+            cp_node_list_init(&(index->lists[i]));
+        }
+    }
+
+    if (cp_node_list_push(&(index->lists[node->type]), node))
+    {
+        return -1;
+    }
+    unsigned int nancestors;
+    const cypher_astnode_type_t *ancestors =
+            cp_ast_type_ancestors(node->type, &nancestors);
+    for (unsigned int i = 0; i < nancestors; ++i)
+    {
+        if (cp_node_list_push(&(index->lists[ancestors[i]]), node))
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+
+int cp_node_index_add_tree(cp_node_index_t *index,
+        const cypher_astnode_t *node)
+{
+    if (node == NULL)
+    {
+        return 0;
+    }
+    if (cp_node_index_add(index, node))
+    {
+        return -1;
+    }
+    for (unsigned int i = 0; i < node->nchildren; ++i)
+    {
+        if (cp_node_index_add_tree(index, node->children[i]))
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+
+int cp_node_index_append(cp_node_index_t *index, cp_node_index_t *other)
+{
+    if (other->lists == NULL)
+    {
+        return 0;
+    }
+    if (index->lists == NULL)
+    {
+        index->lists = other->lists;
+        other->lists = NULL;
+        return 0;
+    }
+
+    for (unsigned int i = cp_ast_ntypes(); i-- > 0; )
+    {
+        cp_node_list_t *list = &(other->lists[i]);
+        const cypher_astnode_t **nodes = cp_node_list_elements(list);
+        unsigned int n = cp_node_list_size(list);
+        for (unsigned int j = 0; j < n; ++j)
+        {
+            if (cp_node_list_push(&(index->lists[i]), nodes[j]))
+            {
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+
+const cypher_astnode_t * const *cp_node_index_get(
+        const cp_node_index_t *index, cypher_astnode_type_t type,
+        unsigned int *n)
+{
+    assert(type < cp_ast_ntypes());
+    if (index->lists == NULL || cp_node_list_size(&(index->lists[type])) == 0)
+    {
+        *n = 0;
+        return NULL;
+    }
+    *n = cp_node_list_size(&(index->lists[type]));
+    return (const cypher_astnode_t * const *)cp_node_list_elements(
+            &(index->lists[type]));
+}
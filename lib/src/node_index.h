@@ -0,0 +1,60 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CYPHER_PARSER_NODE_INDEX_H
+#define CYPHER_PARSER_NODE_INDEX_H
+
+#include "cypher-parser.h"
+#include "vector.h"
+
+
+DECLARE_VECTOR(cp_node_list, const cypher_astnode_t *, NULL);
+
+/*
+ * Lists of AST nodes by type, in the order added. Each node is listed under
+ * its own type and every type it is an instance of.
+ */
+typedef struct cp_node_index cp_node_index_t;
+struct cp_node_index
+{
+    cp_node_list_t *lists; // one per type, allocated on first use
+};
+
+
+void cp_node_index_init(cp_node_index_t *index);
+
+void cp_node_index_cleanup(cp_node_index_t *index);
+
+int cp_node_index_add(cp_node_index_t *index, const cypher_astnode_t *node);
+
+/*
+ * Add a node and all its children, at any depth, in pre-order (which is the
+ * order of their ordinals).
+ */
+int cp_node_index_add_tree(cp_node_index_t *index,
+        const cypher_astnode_t *node);
+
+/*
+ * Add all nodes listed in another index, after those already listed.
+ */
+int cp_node_index_append(cp_node_index_t *index, cp_node_index_t *other);
+
+const cypher_astnode_t * const *cp_node_index_get(
+        const cp_node_index_t *index, cypher_astnode_type_t type,
+        unsigned int *n);
+
+
+#endif/*CYPHER_PARSER_NODE_INDEX_H*/
@@ -0,0 +1,612 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "parallel_literals.h"
+#include "ast.h"
+#include "util.h"
+#include <assert.h>
+#include <errno.h>
+#ifdef HAVE_PTHREADS
+#include <pthread.h>
+#endif
+
+
+struct scanner
+{
+    const char *s;
+    size_t n;
+    struct cypher_input_position initial_position;
+    unsigned int line;
+    size_t line_start;
+    bool first_line;
+};
+
+struct open_bracket
+{
+    size_t index;
+    char c;
+    struct cypher_input_position position;
+};
+
+
+static size_t skip_ignored(const char *s, size_t i, size_t n);
+static bool starts_comprehension(const char *s, size_t i, size_t n);
+static size_t skip_name(const char *s, size_t i, size_t n);
+static size_t skip_blank(const char *s, size_t i, size_t n);
+static void track_lines(struct scanner *sc, size_t from, size_t to);
+static struct cypher_input_position scanner_position(
+        const struct scanner *sc, size_t i);
+static int add_literal(struct cp_literals *literals, size_t start, size_t end,
+        bool is_map, struct cypher_input_position position);
+static int split_literal(struct cp_literal *literal, struct scanner *sc,
+        unsigned int target_chunks);
+static int add_chunk(struct cp_literal *literal, const struct scanner *sc,
+        size_t start, size_t end);
+static void chunk_cleanup(struct cp_literal_chunk *chunk);
+
+
+int cp_find_large_literals(struct cp_literals *literals, const char *s,
+        size_t n, struct cypher_input_position initial_position,
+        size_t threshold, unsigned int target_chunks)
+{
+    REQUIRE(threshold > 0, -1);
+    memset(literals, 0, sizeof(struct cp_literals));
+
+    struct scanner sc = { .s = s, .n = n,
+            .initial_position = initial_position,
+            .line = initial_position.line, .line_start = 0,
+            .first_line = true };
+
+    struct open_bracket *stack = NULL;
+    unsigned int depth = 0, stack_cap = 0;
+
+    for (size_t i = 0; i < n; )
+    {
+        size_t next = skip_ignored(s, i, n);
+        if (next != i)
+        {
+            track_lines(&sc, i, next);
+            i = next;
+            continue;
+        }
+
+        char c = s[i];
+        if (c == '\n')
+        {
+            track_lines(&sc, i, i+1);
+        }
+        else if (c == '[' || c == '{' || c == '(')
+        {
+            if (depth >= stack_cap)
+            {
+                unsigned int cap = (stack_cap == 0)? 16 : stack_cap * 2;
+                struct open_bracket *st = realloc(stack,
+                        cap * sizeof(struct open_bracket));
+                if (st == NULL)
+                {
+                    goto failure;
+                }
+                stack = st;
+                stack_cap = cap;
+            }
+            stack[depth].index = i;
+            stack[depth].c = c;
+            stack[depth].position = scanner_position(&sc, i);
+            ++depth;
+        }
+        else if (c == ']' || c == '}' || c == ')')
+        {
+            char open = (c == ']')? '[' : (c == '}')? '{' : '(';
+            if (depth > 0 && stack[depth-1].c == open)
+            {
+                --depth;
+                struct open_bracket *b = &(stack[depth]);
+                if (open != '(' && i - b->index >= threshold &&
+                        (open == '{' ||
+                         !starts_comprehension(s, b->index + 1, i)) &&
+                        add_literal(literals, b->index, i, (open == '{'),
+                            b->position))
+                {
+                    goto failure;
+                }
+            }
+        }
+        ++i;
+    }
+
+    free(stack);
+    stack = NULL;
+
+    for (unsigned int i = 0; i < literals->nliterals; ++i)
+    {
+        struct cp_literal *literal = &(literals->literals[i]);
+        sc.line = literal->position.line;
+        sc.first_line = (literal->position.line == initial_position.line);
+        sc.line_start = sc.first_line?
+                0 : literal->start + 1 - literal->position.column;
+        if (split_literal(literal, &sc, target_chunks))
+        {
+            goto failure;
+        }
+    }
+    return 0;
+
+    int errsv;
+failure:
+    errsv = errno;
+    free(stack);
+    cp_literals_cleanup(literals);
+    errno = errsv;
+    return -1;
+}
+
+
+/*
+ * Skip any quoted string, escaped name or comment starting at `i`, returning
+ * the index following it (or `i` if there is none).
+ */
+size_t skip_ignored(const char *s, size_t i, size_t n)
+{
+    char c = s[i];
+    if (c == '\'' || c == '"')
+    {
+        for (++i; i < n && s[i] != c; ++i)
+        {
+            if (s[i] == '\\' && i+1 < n)
+            {
+                ++i;
+            }
+        }
+        return (i < n)? i+1 : n;
+    }
+    if (c == '`')
+    {
+        const char *end = memchr(s + i + 1, '`', n - i - 1);
+        return (end == NULL)? n : (size_t)(end - s) + 1;
+    }
+    if (c == '/' && i+1 < n && s[i+1] == '/')
+    {
+        const char *end = memchr(s + i + 2, '\n', n - i - 2);
+        return (end == NULL)? n : (size_t)(end - s);
+    }
+    if (c == '/' && i+1 < n && s[i+1] == '*')
+    {
+        for (i += 2; i+1 < n; ++i)
+        {
+            if (s[i] == '*' && s[i+1] == '/')
+            {
+                return i+2;
+            }
+        }
+        return n;
+    }
+    return i;
+}
+
+
+/*
+ * Check if the body of square brackets, from `i` to `n`, may be a list or
+ * pattern comprehension rather than a collection literal. Once its body is
+ * blanked, the grammar would reduce either as an empty collection, so the
+ * check errs towards treating the body as a comprehension.
+ */
+bool starts_comprehension(const char *s, size_t i, size_t n)
+{
+    i = skip_blank(s, i, n);
+    if (i >= n)
+    {
+        return false;
+    }
+    // a pattern comprehension starts with a node pattern or a path name
+    if (s[i] == '(')
+    {
+        return true;
+    }
+    size_t end = skip_name(s, i, n);
+    if (end == i)
+    {
+        return false;
+    }
+    i = skip_blank(s, end, n);
+    if (i < n && s[i] == '=')
+    {
+        return true;
+    }
+    // a list comprehension starts with `identifier IN`
+    return (i > end && n - i > 2 && (s[i] == 'I' || s[i] == 'i') &&
+            (s[i+1] == 'N' || s[i+1] == 'n') && skip_name(s, i+2, n) == i+2);
+}
+
+
+/*
+ * Skip a symbolic name starting at `i`, returning the index following it
+ * (or `i` if there is none).
+ */
+size_t skip_name(const char *s, size_t i, size_t n)
+{
+    if (i < n && s[i] == '`')
+    {
+        return skip_ignored(s, i, n);
+    }
+    size_t start = i;
+    for (; i < n; ++i)
+    {
+        unsigned char c = s[i];
+        if (!(c == '_' || c >= 0x80 || (c >= 'a' && c <= 'z') ||
+                (c >= 'A' && c <= 'Z') || (i > start && c >= '0' && c <= '9')))
+        {
+            break;
+        }
+    }
+    return i;
+}
+
+
+/*
+ * Skip any whitespace and comments starting at `i`, returning the index
+ * following them.
+ */
+size_t skip_blank(const char *s, size_t i, size_t n)
+{
+    while (i < n)
+    {
+        if (s[i] == ' ' || s[i] == '\t' || s[i] == '\n' || s[i] == '\r')
+        {
+            ++i;
+            continue;
+        }
+        size_t next = (s[i] == '/')? skip_ignored(s, i, n) : i;
+        if (next == i)
+        {
+            break;
+        }
+        i = next;
+    }
+    return i;
+}
+
+
+void track_lines(struct scanner *sc, size_t from, size_t to)
+{
+    const char *p = sc->s + from;
+    const char *end = sc->s + to;
+    while (p < end && (p = memchr(p, '\n', end - p)) != NULL)
+    {
+        ++p;
+        sc->line++;
+        sc->line_start = p - sc->s;
+        sc->first_line = false;
+    }
+}
+
+
+struct cypher_input_position scanner_position(const struct scanner *sc,
+        size_t i)
+{
+    struct cypher_input_position position =
+        { .line = sc->line,
+          .column = i - sc->line_start +
+              (sc->first_line? sc->initial_position.column : 1),
+          .offset = i + sc->initial_position.offset };
+    return position;
+}
+
+
+int add_literal(struct cp_literals *literals, size_t start, size_t end,
+        bool is_map, struct cypher_input_position position)
+{
+    // literals close in order, so any nested within this one are the most
+    // recently added, and are superseded by it
+    while (literals->nliterals > 0 &&
+            literals->literals[literals->nliterals - 1].start > start)
+    {
+        literals->nliterals--;
+    }
+
+    struct cp_literal *l = realloc(literals->literals,
+            (literals->nliterals + 1) * sizeof(struct cp_literal));
+    if (l == NULL)
+    {
+        return -1;
+    }
+    literals->literals = l;
+    l = &(literals->literals[literals->nliterals++]);
+    memset(l, 0, sizeof(struct cp_literal));
+    l->is_map = is_map;
+    l->start = start;
+    l->end = end;
+    l->position = position;
+    return 0;
+}
+
+
+int split_literal(struct cp_literal *literal, struct scanner *sc,
+        unsigned int target_chunks)
+{
+    const char *s = sc->s;
+    size_t target_size = (literal->end - literal->start - 1) /
+            maxu(target_chunks, 1);
+    size_t chunk_start = literal->start + 1;
+    unsigned int depth = 0;
+
+    track_lines(sc, literal->start, chunk_start);
+    size_t tracked = chunk_start;
+
+    for (size_t i = chunk_start; i < literal->end; )
+    {
+        size_t next = skip_ignored(s, i, literal->end);
+        if (next != i)
+        {
+            i = next;
+            continue;
+        }
+
+        char c = s[i];
+        if (c == '[' || c == '{' || c == '(')
+        {
+            ++depth;
+        }
+        else if ((c == ']' || c == '}' || c == ')') && depth > 0)
+        {
+            --depth;
+        }
+        else if (c == ',' && depth == 0 && i - chunk_start >= target_size)
+        {
+            track_lines(sc, tracked, chunk_start);
+            tracked = chunk_start;
+            if (add_chunk(literal, sc, chunk_start, i))
+            {
+                return -1;
+            }
+            chunk_start = i + 1;
+        }
+        ++i;
+    }
+
+    track_lines(sc, tracked, chunk_start);
+    return add_chunk(literal, sc, chunk_start, literal->end);
+}
+
+
+int add_chunk(struct cp_literal *literal, const struct scanner *sc,
+        size_t start, size_t end)
+{
+    struct cp_literal_chunk *chunks = realloc(literal->chunks,
+            (literal->nchunks + 1) * sizeof(struct cp_literal_chunk));
+    if (chunks == NULL)
+    {
+        return -1;
+    }
+    literal->chunks = chunks;
+    struct cp_literal_chunk *chunk = &(chunks[literal->nchunks++]);
+    memset(chunk, 0, sizeof(struct cp_literal_chunk));
+    chunk->text = sc->s + start;
+    chunk->length = end - start;
+    chunk->position = scanner_position(sc, start);
+    chunk->is_map = literal->is_map;
+    return 0;
+}
+
+
+struct chunk_work
+{
+    struct cp_literal_chunk **chunks;
+    unsigned int nchunks;
+    unsigned int next;
+    cp_literal_chunk_parser_t parser;
+    void *data;
+    int err;
+#ifdef HAVE_PTHREADS
+    pthread_mutex_t mutex;
+#endif
+};
+
+
+static void *chunk_worker(void *data)
+{
+    struct chunk_work *work = data;
+    for (;;)
+    {
+#ifdef HAVE_PTHREADS
+        pthread_mutex_lock(&(work->mutex));
+#endif
+        unsigned int i = work->next++;
+        bool abandon = (work->err != 0);
+#ifdef HAVE_PTHREADS
+        pthread_mutex_unlock(&(work->mutex));
+#endif
+        if (i >= work->nchunks || abandon)
+        {
+            return NULL;
+        }
+        if (work->parser(work->data, work->chunks[i]))
+        {
+#ifdef HAVE_PTHREADS
+            pthread_mutex_lock(&(work->mutex));
+#endif
+            work->err = errno;
+#ifdef HAVE_PTHREADS
+            pthread_mutex_unlock(&(work->mutex));
+#endif
+        }
+    }
+}
+
+
+int cp_parse_literal_chunks(struct cp_literals *literals,
+        unsigned int nthreads, cp_literal_chunk_parser_t parser, void *data)
+{
+    struct chunk_work work =
+        { .chunks = NULL, .nchunks = 0, .next = 0,
+          .parser = parser, .data = data, .err = 0 };
+
+    for (unsigned int i = 0; i < literals->nliterals; ++i)
+    {
+        work.nchunks += literals->literals[i].nchunks;
+    }
+    if (work.nchunks == 0)
+    {
+        return 0;
+    }
+    work.chunks = calloc(work.nchunks, sizeof(struct cp_literal_chunk *));
+    if (work.chunks == NULL)
+    {
+        return -1;
+    }
+    for (unsigned int i = 0, k = 0; i < literals->nliterals; ++i)
+    {
+        for (unsigned int j = 0; j < literals->literals[i].nchunks; ++j)
+        {
+            work.chunks[k++] = &(literals->literals[i].chunks[j]);
+        }
+    }
+
+#ifdef HAVE_PTHREADS
+    nthreads = minu(nthreads, work.nchunks);
+    pthread_t *threads = NULL;
+    unsigned int nstarted = 0;
+    if (pthread_mutex_init(&(work.mutex), NULL))
+    {
+        free(work.chunks);
+        return -1;
+    }
+    if (nthreads > 1)
+    {
+        threads = calloc(nthreads - 1, sizeof(pthread_t));
+    }
+    for (; threads != NULL && nstarted < nthreads - 1; ++nstarted)
+    {
+        if (pthread_create(&(threads[nstarted]), NULL, chunk_worker, &work))
+        {
+            // continue with however many threads could be started
+            break;
+        }
+    }
+#endif
+
+    chunk_worker(&work);
+
+#ifdef HAVE_PTHREADS
+    for (unsigned int i = 0; i < nstarted; ++i)
+    {
+        pthread_join(threads[i], NULL);
+    }
+    free(threads);
+    pthread_mutex_destroy(&(work.mutex));
+#endif
+
+    free(work.chunks);
+    if (work.err != 0)
+    {
+        errno = work.err;
+        return -1;
+    }
+    return 0;
+}
+
+
+bool cp_literal_chunks_ok(const struct cp_literals *literals)
+{
+    for (unsigned int i = 0; i < literals->nliterals; ++i)
+    {
+        const struct cp_literal *literal = &(literals->literals[i]);
+        for (unsigned int j = 0; j < literal->nchunks; ++j)
+        {
+            const struct cp_literal_chunk *chunk = &(literal->chunks[j]);
+            // an empty chunk is only valid as the sole content of a literal
+            if (chunk->failed ||
+                    (chunk->nelements == 0 && literal->nchunks > 1))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+
+void cp_blank_literals(const struct cp_literals *literals, size_t offset,
+        char *buf, size_t n)
+{
+    for (unsigned int i = 0; i < literals->nliterals; ++i)
+    {
+        const struct cp_literal *literal = &(literals->literals[i]);
+        size_t start = maxzu(literal->start + 1, offset);
+        size_t end = minzu(literal->end, offset + n);
+        for (size_t j = start; j < end; ++j)
+        {
+            // line endings are kept, so all positions are unaffected
+            if (buf[j - offset] != '\n')
+            {
+                buf[j - offset] = ' ';
+            }
+        }
+    }
+}
+
+
+struct cp_literal *cp_find_literal(struct cp_literals *literals,
+        size_t offset)
+{
+    unsigned int lo = 0, hi = literals->nliterals;
+    while (lo < hi)
+    {
+        unsigned int mid = lo + (hi - lo) / 2;
+        struct cp_literal *literal = &(literals->literals[mid]);
+        if (literal->position.offset == offset)
+        {
+            return literal;
+        }
+        if (literal->position.offset < offset)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return NULL;
+}
+
+
+void cp_literals_cleanup(struct cp_literals *literals)
+{
+    for (unsigned int i = 0; i < literals->nliterals; ++i)
+    {
+        struct cp_literal *literal = &(literals->literals[i]);
+        for (unsigned int j = 0; j < literal->nchunks; ++j)
+        {
+            chunk_cleanup(&(literal->chunks[j]));
+        }
+        free(literal->chunks);
+    }
+    free(literals->literals);
+    memset(literals, 0, sizeof(struct cp_literals));
+}
+
+
+void chunk_cleanup(struct cp_literal_chunk *chunk)
+{
+    cypher_ast_vfree(chunk->children, chunk->nchildren);
+    free(chunk->children);
+    free(chunk->elements);
+    chunk->children = NULL;
+    chunk->nchildren = 0;
+    chunk->elements = NULL;
+    chunk->nelements = 0;
+}
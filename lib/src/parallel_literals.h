@@ -0,0 +1,83 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CYPHER_PARSER_PARALLEL_LITERALS_H
+#define CYPHER_PARSER_PARALLEL_LITERALS_H
+
+#include "cypher-parser.h"
+
+
+struct cp_literal_chunk
+{
+    const char *text;
+    size_t length;
+    struct cypher_input_position position;
+    bool is_map;
+
+    // on success, the sequence of elements (or key/value pairs for a map)
+    // and all nodes created within the chunk, in order
+    cypher_astnode_t **elements;
+    unsigned int nelements;
+    cypher_astnode_t **children;
+    unsigned int nchildren;
+    bool failed;
+};
+
+
+struct cp_literal
+{
+    bool is_map;
+    // buffer index of the opening and closing bracket
+    size_t start;
+    size_t end;
+    struct cypher_input_position position;
+
+    struct cp_literal_chunk *chunks;
+    unsigned int nchunks;
+    bool spliced;
+};
+
+
+struct cp_literals
+{
+    struct cp_literal *literals;
+    unsigned int nliterals;
+};
+
+
+typedef int (*cp_literal_chunk_parser_t)(void *data,
+        struct cp_literal_chunk *chunk);
+
+
+int cp_find_large_literals(struct cp_literals *literals, const char *s,
+        size_t n, struct cypher_input_position initial_position,
+        size_t threshold, unsigned int target_chunks);
+
+int cp_parse_literal_chunks(struct cp_literals *literals,
+        unsigned int nthreads, cp_literal_chunk_parser_t parser, void *data);
+
+bool cp_literal_chunks_ok(const struct cp_literals *literals);
+
+void cp_blank_literals(const struct cp_literals *literals, size_t offset,
+        char *buf, size_t n);
+
+struct cp_literal *cp_find_literal(struct cp_literals *literals,
+        size_t offset);
+
+void cp_literals_cleanup(struct cp_literals *literals);
+
+
+#endif/*CYPHER_PARSER_PARALLEL_LITERALS_H*/
@@ -0,0 +1,161 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "parse_events.h"
+#include "astnode.h"
+#include "segment.h"
+#include <assert.h>
+
+
+typedef const char *(*scalar_getter_t)(const cypher_astnode_t *node);
+typedef size_t (*scalar_length_t)(const cypher_astnode_t *node);
+
+static const struct scalar_type
+{
+    const cypher_astnode_type_t *type;
+    scalar_getter_t get;
+    scalar_length_t length;
+} scalar_types[] =
+    { { &CYPHER_AST_IDENTIFIER,
+          cypher_ast_identifier_get_name,
+          cypher_ast_identifier_get_name_len },
+      { &CYPHER_AST_PARAMETER,
+          cypher_ast_parameter_get_name,
+          cypher_ast_parameter_get_name_len },
+      { &CYPHER_AST_STRING,
+          cypher_ast_string_get_value,
+          cypher_ast_string_get_value_len },
+      { &CYPHER_AST_INTEGER,
+          cypher_ast_integer_get_valuestr,
+          cypher_ast_integer_get_valuestr_len },
+      { &CYPHER_AST_FLOAT,
+          cypher_ast_float_get_valuestr,
+          cypher_ast_float_get_valuestr_len },
+      { &CYPHER_AST_LABEL,
+          cypher_ast_label_get_name,
+          cypher_ast_label_get_name_len },
+      { &CYPHER_AST_RELTYPE,
+          cypher_ast_reltype_get_name,
+          cypher_ast_reltype_get_name_len },
+      { &CYPHER_AST_PROP_NAME,
+          cypher_ast_prop_name_get_value,
+          cypher_ast_prop_name_get_value_len },
+      { &CYPHER_AST_FUNCTION_NAME,
+          cypher_ast_function_name_get_value,
+          cypher_ast_function_name_get_value_len },
+      { &CYPHER_AST_INDEX_NAME,
+          cypher_ast_index_name_get_value,
+          cypher_ast_index_name_get_value_len },
+      { &CYPHER_AST_PROC_NAME,
+          cypher_ast_proc_name_get_value,
+          cypher_ast_proc_name_get_value_len },
+      { &CYPHER_AST_LINE_COMMENT,
+          cypher_ast_line_comment_get_value,
+          cypher_ast_line_comment_get_value_len },
+      { &CYPHER_AST_BLOCK_COMMENT,
+          cypher_ast_block_comment_get_value,
+          cypher_ast_block_comment_get_value_len },
+      { &CYPHER_AST_ERROR,
+          cypher_ast_error_get_value,
+          cypher_ast_error_get_value_len } };
+#define NSCALAR_TYPES (sizeof(scalar_types) / sizeof(struct scalar_type))
+
+
+static int emit_node(const struct cypher_parser_event_handlers *handlers,
+        void *userdata, const cypher_astnode_t *node,
+        const cypher_astnode_t *parent, unsigned int index);
+
+
+int cp_emit_segment_events(const struct cypher_parser_event_handlers *handlers,
+        void *userdata, const cypher_parse_segment_t *segment)
+{
+    int err;
+    for (unsigned int i = 0; i < segment->nerrors; ++i)
+    {
+        if (handlers->on_error != NULL &&
+            (err = handlers->on_error(userdata, &(segment->errors[i]))) != 0)
+        {
+            return err;
+        }
+    }
+
+    for (unsigned int i = 0; i < segment->nroots; ++i)
+    {
+        if ((err = emit_node(handlers, userdata, segment->roots[i], NULL, i))
+                != 0)
+        {
+            return err;
+        }
+    }
+
+    if (handlers->on_segment_end != NULL)
+    {
+        return handlers->on_segment_end(userdata, segment->range,
+                segment->directive, segment->eof);
+    }
+    return 0;
+}
+
+
+int emit_node(const struct cypher_parser_event_handlers *handlers,
+        void *userdata, const cypher_astnode_t *node,
+        const cypher_astnode_t *parent, unsigned int index)
+{
+    cypher_astnode_type_t type = node->type;
+    int err;
+
+    if (node->nchildren == 0)
+    {
+        for (unsigned int i = 0; i < NSCALAR_TYPES; ++i)
+        {
+            if (*(scalar_types[i].type) != type)
+            {
+                continue;
+            }
+            if (handlers->on_scalar == NULL)
+            {
+                return 0;
+            }
+            const char *text = scalar_types[i].get(node);
+            assert(text != NULL);
+            return handlers->on_scalar(userdata, node, type, node->range,
+                    text, scalar_types[i].length(node), parent, index);
+        }
+    }
+
+    if (handlers->on_node_begin != NULL &&
+        (err = handlers->on_node_begin(userdata, node, type, node->range,
+                parent, index)) != 0)
+    {
+        return err;
+    }
+
+    for (unsigned int i = 0; i < node->nchildren; ++i)
+    {
+        if ((err = emit_node(handlers, userdata, node->children[i], node, i))
+                != 0)
+        {
+            return err;
+        }
+    }
+
+    if (handlers->on_node_end != NULL)
+    {
+        return handlers->on_node_end(userdata, node, type, parent, index);
+    }
+    return 0;
+}
@@ -0,0 +1,27 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CYPHER_PARSER_PARSE_EVENTS_H
+#define CYPHER_PARSER_PARSE_EVENTS_H
+
+#include "cypher-parser.h"
+
+
+int cp_emit_segment_events(const struct cypher_parser_event_handlers *handlers,
+        void *userdata, const cypher_parse_segment_t *segment);
+
+
+#endif/*CYPHER_PARSER_PARSE_EVENTS_H*/
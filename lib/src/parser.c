@@ -17,17 +17,30 @@
 #include "../../config.h"
 #include "cypher-parser.h"
 #include "ast.h"
+#include "capture.h"
+#include "catalog.h"
 #include "errors.h"
+#include "lazy_result.h"
+#include "metrics.h"
 #include "operators.h"
+#include "parallel_literals.h"
+#include "parse_events.h"
 #include "parser_config.h"
+#include "read_ahead.h"
 #include "result.h"
 #include "segment.h"
+#include "slowlog.h"
 #include "string_buffer.h"
+#include "unicode.h"
+#include "utf8.h"
 #include "util.h"
 #include "vector.h"
 #include <assert.h>
 #include <ctype.h>
 #include <setjmp.h>
+#ifndef WIN32
+#include <unistd.h>
+#endif
 
 DECLARE_VECTOR(offsets, unsigned int, 0);
 DECLARE_VECTOR(precedences, unsigned int, 0);
@@ -61,11 +74,26 @@ typedef int (*source_cb_t)(void *data, char *buf, int n);
 static int parse_each(yyrule rule, source_cb_t source, void *sourcedata,
         cypher_parser_segment_callback_t callback, void *userdata,
         struct cypher_input_position *last, cypher_parser_config_t *config,
-        uint_fast32_t flags);
+        uint_fast32_t flags, struct cp_literals *literals);
 static cypher_parse_result_t *parse(yyrule rule, source_cb_t source,
         void *sourcedata, struct cypher_input_position *last,
-        cypher_parser_config_t *config, uint_fast32_t flags);
+        cypher_parser_config_t *config, uint_fast32_t flags,
+        struct cp_literals *literals);
 static int parse_one(yycontext *yy, yyrule rule);
+static cypher_parse_result_t *uparse_parallel(yyrule rule, const char *s,
+        size_t n, struct cypher_input_position *last,
+        cypher_parser_config_t *config, uint_fast32_t flags);
+static int parse_literal_chunk(void *data, struct cp_literal_chunk *chunk);
+static int parse_events(yyrule rule, source_cb_t source, void *sourcedata,
+        const struct cypher_parser_event_handlers *handlers, void *userdata,
+        struct cypher_input_position *last, cypher_parser_config_t *config,
+        uint_fast32_t flags);
+static cypher_parse_result_t *parse_lazy(yyrule rule, source_cb_t source,
+        void *sourcedata, struct cypher_input_position *last,
+        cypher_parser_config_t *config, uint_fast32_t flags,
+        const char *buffer, size_t length, FILE *stream, off_t stream_start);
+static bool lazy_enabled(const cypher_parser_config_t *config,
+        uint_fast32_t flags);
 static void source(yycontext *yy, char *buf, int *result, int max_size);
 
 
@@ -86,6 +114,7 @@ static int source_from_buffer(void *data, char *buf, int n)
         return len;
     }
     memcpy(buf, input->buffer, len);
+    input->buffer += len;
     return len;
 }
 
@@ -99,7 +128,7 @@ static int uparse_each(yyrule rule, const char *s, size_t n,
     REQUIRE(callback != NULL, -1);
     struct source_from_buffer_data sourcedata = { .buffer = s, .length = n };
     return parse_each(rule, source_from_buffer, &sourcedata, callback,
-            userdata, last, config, flags);
+            userdata, last, config, flags, NULL);
 }
 
 
@@ -108,11 +137,197 @@ static cypher_parse_result_t *uparse(yyrule rule, const char *s, size_t n,
         uint_fast32_t flags)
 {
     REQUIRE(s != NULL, NULL);
+    if (lazy_enabled(config, flags))
+    {
+        struct source_from_buffer_data sourcedata =
+                { .buffer = s, .length = n };
+        return parse_lazy(rule, source_from_buffer, &sourcedata, last,
+                config, flags, s, n, NULL, 0);
+    }
+    if (config != NULL && config->parallel_literal_threshold > 0 &&
+            n >= config->parallel_literal_threshold &&
+            !config->utf8_validation &&
+            !(flags & CYPHER_PARSE_VALIDATE_ONLY))
+    {
+        return uparse_parallel(rule, s, n, last, config, flags);
+    }
     struct source_from_buffer_data sourcedata = { .buffer = s, .length = n };
-    return parse(rule, source_from_buffer, &sourcedata, last, config, flags);
+    return parse(rule, source_from_buffer, &sourcedata, last, config, flags,
+            NULL);
 }
 
 
+struct source_from_spliced_buffer_data
+{
+    struct source_from_buffer_data input;
+    size_t offset;
+    const struct cp_literals *literals;
+};
+
+
+static int source_from_spliced_buffer(void *data, char *buf, int n)
+{
+    struct source_from_spliced_buffer_data *input = data;
+    int len = source_from_buffer(&(input->input), buf, n);
+    cp_blank_literals(input->literals, input->offset, buf, len);
+    input->offset += len;
+    return len;
+}
+
+
+/*
+ * Parse a buffer containing one or more large collection or map literals.
+ *
+ * The elements of each literal are split at top-level commas and parsed
+ * concurrently, after which the enclosing input is parsed with the body of
+ * each literal presented as whitespace. When the grammar reduces the
+ * (now empty) literal, the pre-parsed elements are spliced into it. If any
+ * chunk fails to parse, or any literal is not reduced as a collection or
+ * map, or if the enclosing input contains any error, then the input is
+ * reparsed serially so that errors, their contexts and recovery are
+ * unaffected. Brackets whose body starts a list or pattern comprehension
+ * are never treated as literals, as with their body blanked they would
+ * also reduce as a collection.
+ */
+cypher_parse_result_t *uparse_parallel(yyrule rule, const char *s, size_t n,
+        struct cypher_input_position *last, cypher_parser_config_t *config,
+        uint_fast32_t flags)
+{
+    unsigned int nthreads = config->parallel_literal_threads;
+    if (nthreads == 0)
+    {
+#if !defined(WIN32) && defined(_SC_NPROCESSORS_ONLN)
+        long ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+#else
+        long ncpus = 1;
+#endif
+        nthreads = (ncpus > 0)? (unsigned int)ncpus : 1;
+    }
+
+    struct cp_literals literals;
+    if (cp_find_large_literals(&literals, s, n, config->initial_position,
+                config->parallel_literal_threshold, nthreads * 4))
+    {
+        return NULL;
+    }
+
+    cypher_parse_result_t *result = NULL;
+    if (literals.nliterals > 0)
+    {
+        if (cp_parse_literal_chunks(&literals, nthreads, parse_literal_chunk,
+                    config))
+        {
+            goto failure;
+        }
+    }
+
+    if (literals.nliterals > 0 && cp_literal_chunks_ok(&literals))
+    {
+        struct source_from_spliced_buffer_data sourcedata =
+            { .input = { .buffer = s, .length = n }, .offset = 0,
+              .literals = &literals };
+        result = parse(rule, source_from_spliced_buffer, &sourcedata, last,
+                config, flags, &literals);
+        if (result == NULL)
+        {
+            goto failure;
+        }
+        // errors in the enclosing input would be reported against the
+        // blanked text, so any error also falls back to a serial reparse
+        bool reparse = (result->nerrors > 0);
+        for (unsigned int i = 0; !reparse && i < literals.nliterals; ++i)
+        {
+            reparse = !literals.literals[i].spliced;
+        }
+        if (reparse)
+        {
+            cypher_parse_result_free(result);
+            result = NULL;
+        }
+    }
+
+    cp_literals_cleanup(&literals);
+    if (result == NULL)
+    {
+        struct source_from_buffer_data sourcedata =
+                { .buffer = s, .length = n };
+        result = parse(rule, source_from_buffer, &sourcedata, last, config,
+                flags, NULL);
+    }
+    return result;
+
+    int errsv;
+failure:
+    errsv = errno;
+    cp_literals_cleanup(&literals);
+    errno = errsv;
+    return NULL;
+}
+
+
+#ifndef WIN32
+struct source_from_iovec_data
+{
+    const struct iovec *iov;
+    int iovcnt;
+    size_t offset;
+};
+
+
+static int source_from_iovec(void *data, char *buf, int n)
+{
+    struct source_from_iovec_data *input = data;
+    int len = 0;
+    while (len < n && input->iovcnt > 0)
+    {
+        size_t avail = input->iov->iov_len - input->offset;
+        size_t chunk = minzu(avail, (size_t)(n - len));
+        memcpy(buf + len, (const char *)input->iov->iov_base + input->offset,
+                chunk);
+        len += chunk;
+        input->offset += chunk;
+        if (input->offset == input->iov->iov_len)
+        {
+            ++(input->iov);
+            --(input->iovcnt);
+            input->offset = 0;
+        }
+    }
+    return len;
+}
+#endif
+
+
+#ifndef WIN32
+static int uparsev_each(yyrule rule, const struct iovec *iov, int iovcnt,
+        cypher_parser_segment_callback_t callback, void *userdata,
+        struct cypher_input_position *last, cypher_parser_config_t *config,
+        uint_fast32_t flags)
+{
+    REQUIRE(iov != NULL || iovcnt == 0, -1);
+    REQUIRE(iovcnt >= 0, -1);
+    REQUIRE(callback != NULL, -1);
+    struct source_from_iovec_data sourcedata =
+            { .iov = iov, .iovcnt = iovcnt, .offset = 0 };
+    return parse_each(rule, source_from_iovec, &sourcedata, callback,
+            userdata, last, config, flags, NULL);
+}
+
+
+static cypher_parse_result_t *uparsev(yyrule rule, const struct iovec *iov,
+        int iovcnt, struct cypher_input_position *last,
+        cypher_parser_config_t *config, uint_fast32_t flags)
+{
+    REQUIRE(iov != NULL || iovcnt == 0, NULL);
+    REQUIRE(iovcnt >= 0, NULL);
+    struct source_from_iovec_data sourcedata =
+            { .iov = iov, .iovcnt = iovcnt, .offset = 0 };
+    return parse(rule, source_from_iovec, &sourcedata, last, config, flags,
+            NULL);
+}
+#endif
+
+
 static int source_from_stream(void *data, char *buf, int n)
 {
     FILE *stream = data;
@@ -133,8 +348,27 @@ static int fparse_each(yyrule rule, FILE *stream,
 {
     REQUIRE(stream != NULL, -1);
     REQUIRE(callback != NULL, -1);
+    if (config != NULL && config->read_ahead_block_size > 0)
+    {
+        cp_read_ahead_t *ra =
+                cp_read_ahead(stream, config->read_ahead_block_size);
+        if (ra == NULL)
+        {
+            return -1;
+        }
+        int result = parse_each(rule, cp_read_ahead_source, ra, callback,
+                userdata, last, config, flags, NULL);
+        int err = cp_read_ahead_error(ra);
+        cp_read_ahead_free(ra);
+        if (result == 0 && err != 0)
+        {
+            errno = err;
+            result = -1;
+        }
+        return result;
+    }
     return parse_each(rule, source_from_stream, stream, callback, userdata,
-            last, config, flags);
+            last, config, flags, NULL);
 }
 
 
@@ -143,7 +377,39 @@ static cypher_parse_result_t *fparse(yyrule rule, FILE *stream,
         uint_fast32_t flags)
 {
     REQUIRE(stream != NULL, NULL);
-    return parse(rule, source_from_stream, stream, last, config, flags);
+#ifndef WIN32
+    if (lazy_enabled(config, flags))
+    {
+        // segments are reread on access, so the stream must be seekable
+        off_t start = ftello(stream);
+        if (start >= 0)
+        {
+            return parse_lazy(rule, source_from_stream, stream, last, config,
+                    flags, NULL, 0, stream, start);
+        }
+    }
+#endif
+    if (config != NULL && config->read_ahead_block_size > 0)
+    {
+        cp_read_ahead_t *ra =
+                cp_read_ahead(stream, config->read_ahead_block_size);
+        if (ra == NULL)
+        {
+            return NULL;
+        }
+        cypher_parse_result_t *result = parse(rule, cp_read_ahead_source, ra,
+                last, config, flags, NULL);
+        int err = cp_read_ahead_error(ra);
+        cp_read_ahead_free(ra);
+        if (result != NULL && err != 0)
+        {
+            cypher_parse_result_free(result);
+            errno = err;
+            return NULL;
+        }
+        return result;
+    }
+    return parse(rule, source_from_stream, stream, last, config, flags, NULL);
 }
 
 
@@ -151,6 +417,8 @@ static void *abort_malloc(yycontext *yy, size_t size);
 static void *abort_realloc(yycontext *yy, void *ptr, size_t size);
 static void finished(yycontext *yy);
 static void line_start(yycontext *yy);
+static void cut(yycontext *yy);
+static bool unicode_sym(yycontext *yy, bool start);
 static void block_start_action(yycontext *yy, char *text, int count);
 static struct block *block_start(yycontext *yy, size_t offset,
         struct cypher_input_position position);
@@ -160,23 +428,53 @@ static void block_merge_action(yycontext *yy, char *text, int pos);
 static struct block *block_end(yycontext *yy, size_t offset,
         struct cypher_input_position position);
 
+/*
+ * When only validating, no AST is constructed: actions that would create an
+ * AST node yield NULL instead, and no block or sequence bookkeeping is done.
+ */
+#define VALIDATING() (yy->validate_only)
+#define NODE(expr) (VALIDATING()? NULL : (expr))
+
 #define ERR(label) _err(yy, label)
 static void _err(yycontext *yy, const char *msg);
 static void record_error(yycontext *yy);
 
-#define strbuf_reset() cp_sb_reset(&(yy->string_buffer))
-#define strbuf_append(s, n) _strbuf_append(yy, s, n)
+enum resync_point
+{
+    RESYNC_CLAUSE = (1<<0),
+    RESYNC_PARAMS = (1<<1),
+    RESYNC_STATEMENT = (1<<2),
+    RESYNC_DIRECTIVE = (1<<3)
+};
+static bool resync(yycontext *yy, enum resync_point point);
+
+struct duplicate_keys
+{
+    yycontext *yy;
+    cypher_astnode_t * const *entries;
+    unsigned int stride;
+};
+static int duplicate_key(void *userdata, unsigned int earlier,
+        unsigned int later);
+
+#define strbuf_reset() \
+    (VALIDATING()? (void)0 : cp_sb_reset(&(yy->string_buffer)))
+#define strbuf_append(s, n) \
+    (VALIDATING()? (void)0 : _strbuf_append(yy, s, n))
 static void _strbuf_append(yycontext *yy, const char *s, size_t n);
-#define strbuf_append_block() _strbuf_append_block(yy)
+#define strbuf_append_block() \
+    (VALIDATING()? (void)0 : _strbuf_append_block(yy))
 static void _strbuf_append_block(yycontext *yy);
 
-#define sequence_add(node) _sequence_add(yy, node)
+#define sequence_add(node) \
+    (VALIDATING()? (void)0 : _sequence_add(yy, node))
 static void _sequence_add(yycontext *yy, cypher_astnode_t *node);
-#define collection_literal() _collection_literal(yy)
+#define collection_literal() NODE(_collection_literal(yy))
 static cypher_astnode_t *_collection_literal(yycontext *yy);
 
 #define OP(n) (yy->op = CYPHER_OP_##n, 1)
-#define op_push(n) _op_push(yy, CYPHER_OP_##n)
+#define op_push(n) \
+    (VALIDATING()? (void)0 : _op_push(yy, CYPHER_OP_##n))
 static void _op_push(yycontext *yy, const cypher_operator_t *op);
 #define op_pop() operators_pop(&(yy->operators))
 
@@ -188,300 +486,301 @@ static void _prec_push_top(yycontext *yy);
     ((yy->op->precedence >= precedences_last(&(yy->precedences)))? 1 : 0)
 #define PREC_POP() (precedences_pop(&(yy->precedences)), 1)
 
-#define statement(b) _statement(yy, b)
+#define statement(b) NODE(_statement(yy, b))
 static cypher_astnode_t *_statement(yycontext *yy, cypher_astnode_t *body);
-#define cypher_option(b) _cypher_option(yy, b)
+#define cypher_option(b) NODE(_cypher_option(yy, b))
 static cypher_astnode_t *_cypher_option(yycontext *yy,
         cypher_astnode_t *version);
-#define cypher_option_param(n, v) _cypher_option_param(yy, n, v)
+#define cypher_option_param(n, v) NODE(_cypher_option_param(yy, n, v))
 static cypher_astnode_t *_cypher_option_param(yycontext *yy,
         cypher_astnode_t *name, cypher_astnode_t *value);
-#define explain_option() _explain_option(yy)
+#define explain_option() NODE(_explain_option(yy))
 static cypher_astnode_t *_explain_option(yycontext *yy);
-#define profile_option() _profile_option(yy)
+#define profile_option() NODE(_profile_option(yy))
 static cypher_astnode_t *_profile_option(yycontext *yy);
-#define create_index(l) _create_index(yy, l)
+#define create_index(l) NODE(_create_index(yy, l))
 static cypher_astnode_t *_create_index(yycontext *yy, cypher_astnode_t *label);
-#define drop_index(l) _drop_index(yy, l)
+#define drop_index(l) NODE(_drop_index(yy, l))
 static cypher_astnode_t *_drop_index(yycontext *yy, cypher_astnode_t *label);
 #define create_node_prop_constraint(i, l, e, u) \
-        _create_node_prop_constraint(yy, i, l, e, u)
+        NODE(_create_node_prop_constraint(yy, i, l, e, u))
 static cypher_astnode_t *_create_node_prop_constraint(yycontext *yy,
         cypher_astnode_t *identifier, cypher_astnode_t *label,
         cypher_astnode_t *expression, bool unique);
 #define drop_node_prop_constraint(i, l, e, u) \
-        _drop_node_prop_constraint(yy, i, l, e, u)
+        NODE(_drop_node_prop_constraint(yy, i, l, e, u))
 static cypher_astnode_t *_drop_node_prop_constraint(yycontext *yy,
         cypher_astnode_t *identifier, cypher_astnode_t *label,
         cypher_astnode_t *expression, bool unique);
 #define create_rel_prop_constraint(i, l, e, u) \
-        _create_rel_prop_constraint(yy, i, l, e, u)
+        NODE(_create_rel_prop_constraint(yy, i, l, e, u))
 static cypher_astnode_t *_create_rel_prop_constraint(yycontext *yy,
         cypher_astnode_t *identifier, cypher_astnode_t *label,
         cypher_astnode_t *expression, bool unique);
 #define drop_rel_prop_constraint(i, l, e, u) \
-        _drop_rel_prop_constraint(yy, i, l, e, u)
+        NODE(_drop_rel_prop_constraint(yy, i, l, e, u))
 static cypher_astnode_t *_drop_rel_prop_constraint(yycontext *yy,
         cypher_astnode_t *identifier, cypher_astnode_t *label,
         cypher_astnode_t *expression, bool unique);
-#define query() _query(yy)
+#define query() NODE(_query(yy))
 static cypher_astnode_t *_query(yycontext *yy);
-#define using_periodic_commit(l) _using_periodic_commit(yy, l)
+#define using_periodic_commit(l) NODE(_using_periodic_commit(yy, l))
 static cypher_astnode_t *_using_periodic_commit(yycontext *yy,
         cypher_astnode_t *limit);
-#define load_csv(wh, url, id, ft) _load_csv(yy, wh, url, id, ft)
+#define load_csv(wh, url, id, ft) NODE(_load_csv(yy, wh, url, id, ft))
 static cypher_astnode_t *_load_csv(yycontext *yy, bool with_headers,
         cypher_astnode_t *url, cypher_astnode_t *identifier,
         cypher_astnode_t *field_terminator);
-#define start_clause(c) _start_clause(yy, c)
+#define start_clause(c) NODE(_start_clause(yy, c))
 static cypher_astnode_t *_start_clause(yycontext *yy, 
         cypher_astnode_t *predicate);
-#define node_index_lookup(i, x, p, l) _node_index_lookup(yy, i, x, p, l)
+#define node_index_lookup(i, x, p, l) NODE(_node_index_lookup(yy, i, x, p, l))
 static cypher_astnode_t *_node_index_lookup(yycontext *yy,
         cypher_astnode_t *identifier, cypher_astnode_t *index,
         cypher_astnode_t *prop_name, cypher_astnode_t *lookup);
-#define node_index_query(i, x, q) _node_index_query(yy, i, x, q)
+#define node_index_query(i, x, q) NODE(_node_index_query(yy, i, x, q))
 static cypher_astnode_t *_node_index_query(yycontext *yy,
         cypher_astnode_t *identifier, cypher_astnode_t *index,
         cypher_astnode_t *query);
-#define node_id_lookup(i) _node_id_lookup(yy, i)
+#define node_id_lookup(i) NODE(_node_id_lookup(yy, i))
 static cypher_astnode_t *_node_id_lookup(yycontext *yy,
         cypher_astnode_t *identifier);
-#define all_nodes_scan(i) _all_nodes_scan(yy, i)
+#define all_nodes_scan(i) NODE(_all_nodes_scan(yy, i))
 static cypher_astnode_t *_all_nodes_scan(yycontext *yy,
         cypher_astnode_t *identifier);
-#define rel_index_lookup(i, x, p, l) _rel_index_lookup(yy, i, x, p, l)
+#define rel_index_lookup(i, x, p, l) NODE(_rel_index_lookup(yy, i, x, p, l))
 static cypher_astnode_t *_rel_index_lookup(yycontext *yy,
         cypher_astnode_t *identifier, cypher_astnode_t *index,
         cypher_astnode_t *prop_name, cypher_astnode_t *lookup);
-#define rel_index_query(i, x, q) _rel_index_query(yy, i, x, q)
+#define rel_index_query(i, x, q) NODE(_rel_index_query(yy, i, x, q))
 static cypher_astnode_t *_rel_index_query(yycontext *yy,
         cypher_astnode_t *identifier, cypher_astnode_t *index,
         cypher_astnode_t *query);
-#define rel_id_lookup(i) _rel_id_lookup(yy, i)
+#define rel_id_lookup(i) NODE(_rel_id_lookup(yy, i))
 static cypher_astnode_t *_rel_id_lookup(yycontext *yy,
         cypher_astnode_t *identifier);
-#define all_rels_scan(i) _all_rels_scan(yy, i)
+#define all_rels_scan(i) NODE(_all_rels_scan(yy, i))
 static cypher_astnode_t *_all_rels_scan(yycontext *yy,
         cypher_astnode_t *identifier);
-#define match_clause(o, p, c) _match_clause(yy, o, p, c)
+#define match_clause(o, p, c) NODE(_match_clause(yy, o, p, c))
 static cypher_astnode_t *_match_clause(yycontext *yy, bool optional,
         cypher_astnode_t *pattern, cypher_astnode_t *predicate);
-#define using_index(i, l, p) _using_index(yy, i, l, p)
+#define using_index(i, l, p) NODE(_using_index(yy, i, l, p))
 static cypher_astnode_t *_using_index(yycontext *yy,
         cypher_astnode_t *identifier, cypher_astnode_t *label,
         cypher_astnode_t *prop_name);
-#define using_join() _using_join(yy)
+#define using_join() NODE(_using_join(yy))
 static cypher_astnode_t *_using_join(yycontext *yy);
-#define using_scan(i, l) _using_scan(yy, i, l)
+#define using_scan(i, l) NODE(_using_scan(yy, i, l))
 static cypher_astnode_t *_using_scan(yycontext *yy,
         cypher_astnode_t *identifier, cypher_astnode_t *label);
-#define merge_clause(p) _merge_clause(yy, p)
+#define merge_clause(p) NODE(_merge_clause(yy, p))
 static cypher_astnode_t *_merge_clause(yycontext *yy,
         cypher_astnode_t *pattern_part);
-#define on_match() _on_match(yy)
+#define on_match() NODE(_on_match(yy))
 static cypher_astnode_t *_on_match(yycontext *yy);
-#define on_create() _on_create(yy)
+#define on_create() NODE(_on_create(yy))
 static cypher_astnode_t *_on_create(yycontext *yy);
-#define create_clause(u, p) _create_clause(yy, u, p)
+#define create_clause(u, p) NODE(_create_clause(yy, u, p))
 static cypher_astnode_t *_create_clause(yycontext *yy, bool unique,
         cypher_astnode_t *pattern);
-#define set_clause() _set_clause(yy)
+#define set_clause() NODE(_set_clause(yy))
 static cypher_astnode_t *_set_clause(yycontext *yy);
-#define set_property(p, e) _set_property(yy, p, e)
+#define set_property(p, e) NODE(_set_property(yy, p, e))
 static cypher_astnode_t *_set_property(yycontext *yy,
         cypher_astnode_t *prop_name, cypher_astnode_t *expression);
-#define set_all_properties(i, e) _set_all_properties(yy, i, e)
+#define set_all_properties(i, e) NODE(_set_all_properties(yy, i, e))
 static cypher_astnode_t *_set_all_properties(yycontext *yy,
         cypher_astnode_t *identifier, cypher_astnode_t *expression);
-#define merge_properties(i, e) _merge_properties(yy, i, e)
+#define merge_properties(i, e) NODE(_merge_properties(yy, i, e))
 static cypher_astnode_t *_merge_properties(yycontext *yy,
         cypher_astnode_t *identifier, cypher_astnode_t *expression);
-#define set_labels(i) _set_labels(yy, i)
+#define set_labels(i) NODE(_set_labels(yy, i))
 static cypher_astnode_t *_set_labels(yycontext *yy,
         cypher_astnode_t *identifier);
-#define delete(d) _delete(yy, d)
+#define delete(d) NODE(_delete(yy, d))
 static cypher_astnode_t *_delete(yycontext *yy, bool detach);
-#define remove_clause() _remove_clause(yy)
+#define remove_clause() NODE(_remove_clause(yy))
 static cypher_astnode_t *_remove_clause(yycontext *yy);
-#define remove_property(p) _remove_property(yy, p)
+#define remove_property(p) NODE(_remove_property(yy, p))
 static cypher_astnode_t *_remove_property(yycontext *yy,
         cypher_astnode_t *prop_name);
-#define remove_labels(i) _remove_labels(yy, i)
+#define remove_labels(i) NODE(_remove_labels(yy, i))
 static cypher_astnode_t *_remove_labels(yycontext *yy,
         cypher_astnode_t *identifier);
-#define foreach_clause(i, e) _foreach_clause(yy, i, e)
+#define foreach_clause(i, e) NODE(_foreach_clause(yy, i, e))
 static cypher_astnode_t *_foreach_clause(yycontext *yy,
         cypher_astnode_t *identifier, cypher_astnode_t *expression);
-#define with_clause(d, a, o, s, l, p) _with_clause(yy, d, a, o, s, l, p)
+#define with_clause(d, a, o, s, l, p) NODE(_with_clause(yy, d, a, o, s, l, p))
 static cypher_astnode_t *_with_clause(yycontext *yy, bool distinct,
         bool include_existing, cypher_astnode_t *order_by,
         cypher_astnode_t *skip, cypher_astnode_t *limit,
         cypher_astnode_t *predicate);
-#define unwind_clause(e, i) _unwind_clause(yy, e, i)
+#define unwind_clause(e, i) NODE(_unwind_clause(yy, e, i))
 static cypher_astnode_t *_unwind_clause(yycontext *yy,
         cypher_astnode_t *expression, cypher_astnode_t *identifier);
-#define call_clause(p, w) _call_clause(yy, p, w)
+#define call_clause(p, w) NODE(_call_clause(yy, p, w))
 static cypher_astnode_t *_call_clause(yycontext *yy,
         cypher_astnode_t *proc_name, cypher_astnode_t *predicate);
-#define return_clause(d, a, o, s, l) _return_clause(yy, d, a, o, s, l)
+#define return_clause(d, a, o, s, l) NODE(_return_clause(yy, d, a, o, s, l))
 static cypher_astnode_t *_return_clause(yycontext *yy, bool distinct,
         bool include_existing, cypher_astnode_t *order_by,
         cypher_astnode_t *skip, cypher_astnode_t *limit);
-#define projection(e, a) _projection(yy, e, a)
+#define projection(e, a) NODE(_projection(yy, e, a))
 static cypher_astnode_t *_projection(yycontext *yy,
         cypher_astnode_t *expression, cypher_astnode_t *alias);
-#define order_by() _order_by(yy)
+#define order_by() NODE(_order_by(yy))
 static cypher_astnode_t *_order_by(yycontext *yy);
-#define sort_item(e, a) _sort_item(yy, e, a)
+#define sort_item(e, a) NODE(_sort_item(yy, e, a))
 static cypher_astnode_t *_sort_item(yycontext *yy, cypher_astnode_t *expression,
         bool ascending);
-#define union_clause(a) _union_clause(yy, a)
+#define union_clause(a) NODE(_union_clause(yy, a))
 static cypher_astnode_t *_union_clause(yycontext *yy, bool all);
-#define unary_operator(o, a) _unary_operator(yy, o, a)
+#define unary_operator(o, a) NODE(_unary_operator(yy, o, a))
 static cypher_astnode_t *_unary_operator(yycontext *yy,
         const cypher_operator_t *op, cypher_astnode_t *arg);
-#define binary_operator(o, l, r) _binary_operator(yy, o, l, r)
+#define binary_operator(o, l, r) NODE(_binary_operator(yy, o, l, r))
 static cypher_astnode_t *_binary_operator(yycontext *yy,
         const cypher_operator_t *op, cypher_astnode_t *left,
         cypher_astnode_t *right);
-#define comparison_operator() _comparison_operator(yy)
+#define comparison_operator() NODE(_comparison_operator(yy))
 static cypher_astnode_t *_comparison_operator(yycontext *yy);
-#define apply_operator(l, d) _apply_operator(yy, l, d)
+#define apply_operator(l, d) NODE(_apply_operator(yy, l, d))
 static cypher_astnode_t *_apply_operator(yycontext *yy, cypher_astnode_t *left,
         bool distinct);
-#define apply_all_operator(l, d) _apply_all_operator(yy, l, d)
+#define apply_all_operator(l, d) NODE(_apply_all_operator(yy, l, d))
 static cypher_astnode_t *_apply_all_operator(yycontext *yy,
         cypher_astnode_t *left, bool distinct);
-#define property_operator(l, r) _property_operator(yy, l, r)
+#define property_operator(l, r) NODE(_property_operator(yy, l, r))
 static cypher_astnode_t *_property_operator(yycontext *yy,
         cypher_astnode_t *map, cypher_astnode_t *prop_name);
-#define subscript_operator(l, r) _subscript_operator(yy, l, r)
+#define subscript_operator(l, r) NODE(_subscript_operator(yy, l, r))
 static cypher_astnode_t *_subscript_operator(yycontext *yy,
         cypher_astnode_t *arg, cypher_astnode_t *subscript);
-#define slice_operator(l, s, e) _slice_operator(yy, l, s, e)
+#define slice_operator(l, s, e) NODE(_slice_operator(yy, l, s, e))
 static cypher_astnode_t *_slice_operator(yycontext *yy,
         cypher_astnode_t *expression, cypher_astnode_t *start,
         cypher_astnode_t* end);
-#define map_projection(l) _map_projection(yy, l)
+#define map_projection(l) NODE(_map_projection(yy, l))
 static cypher_astnode_t *_map_projection(yycontext *yy,
         cypher_astnode_t *expression);
-#define map_projection_literal(p, e) _map_projection_literal(yy, p, e)
+#define map_projection_literal(p, e) NODE(_map_projection_literal(yy, p, e))
 static cypher_astnode_t *_map_projection_literal(yycontext *yy,
         cypher_astnode_t *prop_name, cypher_astnode_t *expression);
-#define map_projection_property(p) _map_projection_property(yy, p)
+#define map_projection_property(p) NODE(_map_projection_property(yy, p))
 static cypher_astnode_t *_map_projection_property(yycontext *yy,
         cypher_astnode_t *prop_name);
-#define map_projection_identifier(p) _map_projection_identifier(yy, p)
+#define map_projection_identifier(p) NODE(_map_projection_identifier(yy, p))
 static cypher_astnode_t *_map_projection_identifier(yycontext *yy,
         cypher_astnode_t *identifier);
-#define map_projection_all_properties() _map_projection_all_properties(yy)
+#define map_projection_all_properties() NODE(_map_projection_all_properties(yy))
 static cypher_astnode_t *_map_projection_all_properties(yycontext *yy);
-#define labels_operator(l) _labels_operator(yy, l)
+#define labels_operator(l) NODE(_labels_operator(yy, l))
 static cypher_astnode_t *_labels_operator(yycontext *yy,
         cypher_astnode_t *left);
-#define list_comprehension(i,e,p,v) _list_comprehension(yy, i, e, p, v)
+#define list_comprehension(i,e,p,v) NODE(_list_comprehension(yy, i, e, p, v))
 static cypher_astnode_t *_list_comprehension(yycontext *yy,
         cypher_astnode_t *identifier, cypher_astnode_t *expression,
         cypher_astnode_t *predicate, cypher_astnode_t *eval);
-#define pattern_comprehension(i,r,p,v) _pattern_comprehension(yy, i, r, p, v)
+#define pattern_comprehension(i,r,p,v) \
+    NODE(_pattern_comprehension(yy, i, r, p, v))
 static cypher_astnode_t *_pattern_comprehension(yycontext *yy,
         cypher_astnode_t *identifier, cypher_astnode_t *pattern,
         cypher_astnode_t *predicate, cypher_astnode_t *eval);
-#define case_expression(e,d) _case_expression(yy, e, d)
+#define case_expression(e,d) NODE(_case_expression(yy, e, d))
 static cypher_astnode_t *_case_expression(yycontext *yy,
         cypher_astnode_t *expression, cypher_astnode_t *deflt);
-#define filter(i,e,p) _filter(yy, i, e, p)
+#define filter(i,e,p) NODE(_filter(yy, i, e, p))
 static cypher_astnode_t *_filter(yycontext *yy, cypher_astnode_t *identifier,
         cypher_astnode_t *expression, cypher_astnode_t *predicate);
-#define extract(i,e,v) _extract(yy, i, e, v)
+#define extract(i,e,v) NODE(_extract(yy, i, e, v))
 static cypher_astnode_t *_extract(yycontext *yy, cypher_astnode_t *identifier,
         cypher_astnode_t *expression, cypher_astnode_t *eval);
-#define reduce(a,n,i,e,v) _reduce(yy, a, n, i, e, v)
+#define reduce(a,n,i,e,v) NODE(_reduce(yy, a, n, i, e, v))
 static cypher_astnode_t *_reduce(yycontext *yy, cypher_astnode_t *accumulator,
         cypher_astnode_t *init, cypher_astnode_t *identifier,
         cypher_astnode_t *expression, cypher_astnode_t *eval);
-#define all_predicate(i,e,p) _all_predicate(yy, i, e, p)
+#define all_predicate(i,e,p) NODE(_all_predicate(yy, i, e, p))
 static cypher_astnode_t *_all_predicate(yycontext *yy,
         cypher_astnode_t *identifier, cypher_astnode_t *expression,
         cypher_astnode_t *predicate);
-#define any_predicate(i,e,p) _any_predicate(yy, i, e, p)
+#define any_predicate(i,e,p) NODE(_any_predicate(yy, i, e, p))
 static cypher_astnode_t *_any_predicate(yycontext *yy,
         cypher_astnode_t *identifier, cypher_astnode_t *expression,
         cypher_astnode_t *predicate);
-#define single_predicate(i,e,p) _single_predicate(yy, i, e, p)
+#define single_predicate(i,e,p) NODE(_single_predicate(yy, i, e, p))
 static cypher_astnode_t *_single_predicate(yycontext *yy,
         cypher_astnode_t *identifier, cypher_astnode_t *expression,
         cypher_astnode_t *predicate);
-#define none_predicate(i,e,p) _none_predicate(yy, i, e, p)
+#define none_predicate(i,e,p) NODE(_none_predicate(yy, i, e, p))
 static cypher_astnode_t *_none_predicate(yycontext *yy,
         cypher_astnode_t *identifier, cypher_astnode_t *expression,
         cypher_astnode_t *predicate);
-#define map_literal() _map_literal(yy)
+#define map_literal() NODE(_map_literal(yy))
 static cypher_astnode_t *_map_literal(yycontext *yy);
-#define strbuf_identifier() _strbuf_identifier(yy)
+#define strbuf_identifier() NODE(_strbuf_identifier(yy))
 static cypher_astnode_t *_strbuf_identifier(yycontext *yy);
-#define block_identifier() _block_identifier(yy)
+#define block_identifier() NODE(_block_identifier(yy))
 static cypher_astnode_t *_block_identifier(yycontext *yy);
-#define strbuf_parameter() _strbuf_parameter(yy)
+#define strbuf_parameter() NODE(_strbuf_parameter(yy))
 static cypher_astnode_t *_strbuf_parameter(yycontext *yy);
-#define strbuf_integer() _strbuf_integer(yy)
+#define strbuf_integer() NODE(_strbuf_integer(yy))
 static cypher_astnode_t *_strbuf_integer(yycontext *yy);
-#define strbuf_float() _strbuf_float(yy)
+#define strbuf_float() NODE(_strbuf_float(yy))
 static cypher_astnode_t *_strbuf_float(yycontext *yy);
-#define true_literal() _true_literal(yy)
+#define true_literal() NODE(_true_literal(yy))
 static cypher_astnode_t *_true_literal(yycontext *yy);
-#define false_literal() _false_literal(yy)
+#define false_literal() NODE(_false_literal(yy))
 static cypher_astnode_t *_false_literal(yycontext *yy);
-#define null_literal() _null_literal(yy)
+#define null_literal() NODE(_null_literal(yy))
 static cypher_astnode_t *_null_literal(yycontext *yy);
-#define strbuf_label() _strbuf_label(yy)
+#define strbuf_label() NODE(_strbuf_label(yy))
 static cypher_astnode_t *_strbuf_label(yycontext *yy);
-#define strbuf_reltype() _strbuf_reltype(yy)
+#define strbuf_reltype() NODE(_strbuf_reltype(yy))
 static cypher_astnode_t *_strbuf_reltype(yycontext *yy);
-#define strbuf_prop_name() _strbuf_prop_name(yy)
+#define strbuf_prop_name() NODE(_strbuf_prop_name(yy))
 static cypher_astnode_t *_strbuf_prop_name(yycontext *yy);
-#define strbuf_function_name() _strbuf_function_name(yy)
+#define strbuf_function_name() NODE(_strbuf_function_name(yy))
 static cypher_astnode_t *_strbuf_function_name(yycontext *yy);
-#define strbuf_index_name() _strbuf_index_name(yy)
+#define strbuf_index_name() NODE(_strbuf_index_name(yy))
 static cypher_astnode_t *_strbuf_index_name(yycontext *yy);
-#define strbuf_proc_name() _strbuf_proc_name(yy)
+#define strbuf_proc_name() NODE(_strbuf_proc_name(yy))
 static cypher_astnode_t *_strbuf_proc_name(yycontext *yy);
-#define pattern() _pattern(yy)
+#define pattern() NODE(_pattern(yy))
 static cypher_astnode_t *_pattern(yycontext *yy);
-#define named_path(s, p) _named_path(yy, s, p)
+#define named_path(s, p) NODE(_named_path(yy, s, p))
 static cypher_astnode_t *_named_path(yycontext *yy,
         cypher_astnode_t *identifier, cypher_astnode_t *path);
-#define shortest_path(s, p) _shortest_path(yy, s, p)
+#define shortest_path(s, p) NODE(_shortest_path(yy, s, p))
 static cypher_astnode_t *_shortest_path(yycontext *yy, bool single,
         cypher_astnode_t *path);
-#define pattern_path() _pattern_path(yy)
+#define pattern_path() NODE(_pattern_path(yy))
 static cypher_astnode_t *_pattern_path(yycontext *yy);
-#define node_pattern(i, p) _node_pattern(yy, i, p)
+#define node_pattern(i, p) NODE(_node_pattern(yy, i, p))
 static cypher_astnode_t *_node_pattern(yycontext *yy,
         cypher_astnode_t *identifier, cypher_astnode_t *properties);
 #define simple_rel_pattern(d) \
-    _rel_pattern(yy, CYPHER_REL_##d, NULL, NULL, NULL)
-#define rel_pattern(d, i, r, p) _rel_pattern(yy, CYPHER_REL_##d, i, r, p)
+    NODE(_rel_pattern(yy, CYPHER_REL_##d, NULL, NULL, NULL))
+#define rel_pattern(d, i, r, p) NODE(_rel_pattern(yy, CYPHER_REL_##d, i, r, p))
 static cypher_astnode_t *_rel_pattern(yycontext *yy,
         enum cypher_rel_direction direction, cypher_astnode_t *identifier,
         cypher_astnode_t *varlength, cypher_astnode_t *properties);
-#define range(s, e) _range(yy, s, e)
+#define range(s, e) NODE(_range(yy, s, e))
 static cypher_astnode_t *_range(yycontext *yy, cypher_astnode_t *start,
         cypher_astnode_t *end);
-#define command(name) _command(yy, name)
+#define command(name) NODE(_command(yy, name))
 static cypher_astnode_t *_command(yycontext *yy, cypher_astnode_t *name);
-#define string(s, n) _string(yy, s, n)
+#define string(s, n) NODE(_string(yy, s, n))
 static cypher_astnode_t *_string(yycontext *yy, const char *s, size_t n);
-#define block_string() _block_string(yy)
+#define block_string() NODE(_block_string(yy))
 static cypher_astnode_t *_block_string(yycontext *yy);
-#define strbuf_string() _strbuf_string(yy)
+#define strbuf_string() NODE(_strbuf_string(yy))
 static cypher_astnode_t *_strbuf_string(yycontext *yy);
-#define line_comment() _line_comment(yy)
+#define line_comment() NODE(_line_comment(yy))
 static cypher_astnode_t *_line_comment(yycontext *yy);
-#define block_comment() _block_comment(yy)
+#define block_comment() NODE(_block_comment(yy))
 static cypher_astnode_t *_block_comment(yycontext *yy);
-#define skip() _skip(yy)
+#define skip() NODE(_skip(yy))
 static cypher_astnode_t *_skip(yycontext *yy);
 
 
@@ -501,17 +800,29 @@ static cypher_astnode_t *_skip(yycontext *yy);
     cypher_astnode_t *result; \
     bool eof; \
     cp_error_tracking_t error_tracking; \
-    unsigned int consumed;
+    unsigned int consumed; \
+    unsigned int window_offset; /* segment offset of __buf[0] */ \
+    unsigned int window_lines; /* line starts discarded with the window */ \
+    struct cp_literals *literals; \
+    struct cp_utf8_validator *utf8; /* NULL if not validating */ \
+    bool validate_only; \
+    bool reject_duplicate_keys; \
+    unsigned int slowlog_prefix_length; \
+    char slowlog_prefix[CYPHER_SLOWLOG_PREFIX_LENGTH];
 
 #define YYSTYPE cypher_astnode_t *
 
+#define ERROR_CONTEXT_LENGTH 80
+
 #define YY_MALLOC abort_malloc
 #define YY_REALLOC abort_realloc
 
 #define YY_BEGIN \
-    (yy->__begin = yy->__pos, yyDo(yy, block_start_action, yy->__pos, 0), 1)
+    (yy->__begin = yy->__pos, VALIDATING()? 1 : \
+        (yyDo(yy, block_start_action, yy->__pos, 0), 1))
 #define YY_END \
-    (yy->__end = 0, yyDo(yy, block_end_action, yy->__pos, 0), 1)
+    (yy->__end = 0, VALIDATING()? 1 : \
+        (yyDo(yy, block_end_action, yy->__pos, 0), 1))
 
 #define YY_CTX_LOCAL
 #define YY_PARSE(T) static T
@@ -528,7 +839,22 @@ static cypher_astnode_t *_skip(yycontext *yy);
 #define abort_parse(yy) \
     do { assert(errno != 0); siglongjmp(yy->abort_env, errno); } while (0)
 static int safe_yyparsefrom(yycontext *yy, yyrule rule);
+static unsigned int segment_offset(yycontext *yy, int pos);
+static void capture_prefix(yycontext *yy);
+static void record_slow_parse(yycontext *yy,
+        const cypher_parse_segment_t *segment, uint64_t duration,
+        unsigned long start_allocations);
+static size_t context_start(yycontext *yy, size_t offset);
+static void mark_line_start(yycontext *yy, unsigned int pos);
 static unsigned int backtrack_lines(yycontext *yy, unsigned int pos);
+static int refill(yycontext *yy);
+static int resync_peek(yycontext *yy, int pos);
+static int resync_find(yycontext *yy, int pos, const char *s);
+static int resync_keyword(yycontext *yy, int pos, enum resync_point point);
+static int resync_word(yycontext *yy, int pos, const char *word);
+static int resync_skip_whitespace(yycontext *yy, int pos);
+static int unicode_sym_length(yycontext *yy, int pos, bool start);
+static void add_utf8_errors(yycontext *yy);
 static struct cypher_input_position input_position(yycontext *yy,
         unsigned int pos);
 static void block_free(struct block *block);
@@ -545,6 +871,12 @@ void source(yycontext *yy, char *buf, int *result, int max_size)
     }
     assert(yy != NULL && yy->source != NULL);
     *result = yy->source(yy->source_data, buf, max_size);
+    if (yy->utf8 != NULL && ((*result > 0)?
+                cp_utf8_validate(yy->utf8, buf, *result) :
+                cp_utf8_validate_end(yy->utf8)))
+    {
+        abort_parse(yy);
+    }
 }
 
 
@@ -564,11 +896,37 @@ cypher_parse_result_t *cypher_uparse(const char *s, size_t n,
         struct cypher_input_position *last, cypher_parser_config_t *config,
         uint_fast32_t flags)
 {
+    if (config != NULL && config->capture != NULL && s != NULL)
+    {
+        cp_capture_record(config->capture, CYPHER_CAPTURE_PARSE, flags, s, n);
+    }
     yyrule rule = cypher_yyrule_from_flags(flags);
     return uparse(rule, s, n, last, config, flags);
 }
 
 
+#ifndef WIN32
+int cypher_uparsev_each(const struct iovec *iov, int iovcnt,
+        cypher_parser_segment_callback_t callback, void *userdata,
+        struct cypher_input_position *last, cypher_parser_config_t *config,
+        uint_fast32_t flags)
+{
+    yyrule rule = cypher_yyrule_from_flags(flags);
+    return uparsev_each(rule, iov, iovcnt, callback, userdata, last, config,
+            flags);
+}
+
+
+cypher_parse_result_t *cypher_uparsev(const struct iovec *iov, int iovcnt,
+        struct cypher_input_position *last, cypher_parser_config_t *config,
+        uint_fast32_t flags)
+{
+    yyrule rule = cypher_yyrule_from_flags(flags);
+    return uparsev(rule, iov, iovcnt, last, config, flags);
+}
+#endif
+
+
 int cypher_fparse_each(FILE *stream, cypher_parser_segment_callback_t callback,
         void *userdata, struct cypher_input_position *last,
         cypher_parser_config_t *config, uint_fast32_t flags)
@@ -587,10 +945,35 @@ cypher_parse_result_t *cypher_fparse(FILE *stream,
 }
 
 
+int cypher_uparse_events(const char *s, size_t n,
+        const struct cypher_parser_event_handlers *handlers, void *userdata,
+        struct cypher_input_position *last, cypher_parser_config_t *config,
+        uint_fast32_t flags)
+{
+    REQUIRE(s != NULL, -1);
+    yyrule rule = cypher_yyrule_from_flags(flags);
+    struct source_from_buffer_data sourcedata = { .buffer = s, .length = n };
+    return parse_events(rule, source_from_buffer, &sourcedata, handlers,
+            userdata, last, config, flags);
+}
+
+
+int cypher_fparse_events(FILE *stream,
+        const struct cypher_parser_event_handlers *handlers, void *userdata,
+        struct cypher_input_position *last, cypher_parser_config_t *config,
+        uint_fast32_t flags)
+{
+    REQUIRE(stream != NULL, -1);
+    yyrule rule = cypher_yyrule_from_flags(flags);
+    return parse_events(rule, source_from_stream, stream, handlers, userdata,
+            last, config, flags);
+}
+
+
 int parse_each(yyrule rule, source_cb_t source, void *sourcedata,
         cypher_parser_segment_callback_t callback, void *userdata,
         struct cypher_input_position *last, cypher_parser_config_t *config,
-        uint_fast32_t flags)
+        uint_fast32_t flags, struct cp_literals *literals)
 {
     int result = -1;
 
@@ -604,8 +987,18 @@ int parse_each(yyrule rule, source_cb_t source, void *sourcedata,
     precedences_init(&(yy.precedences));
     yy.source = source;
     yy.source_data = sourcedata;
+    yy.literals = literals;
+    yy.validate_only = flags & CYPHER_PARSE_VALIDATE_ONLY;
+    yy.reject_duplicate_keys = flags & CYPHER_PARSE_REJECT_DUPLICATE_KEYS;
     cp_et_init(&(yy.error_tracking), yy.config->error_colorization);
 
+    struct cp_utf8_validator utf8;
+    cp_utf8_validator_init(&utf8, yy.config->initial_position);
+    if (yy.config->utf8_validation)
+    {
+        yy.utf8 = &utf8;
+    }
+
     struct block *top_block = NULL;
 
     if (offsets_push(&(yy.line_start_offsets), 0))
@@ -619,9 +1012,27 @@ int parse_each(yyrule rule, source_cb_t source, void *sourcedata,
     }
 
     unsigned int ordinal = yy.config->initial_ordinal;
+    cypher_slowlog_t *slowlog = yy.config->slowlog;
+    bool metrics = cp_metrics_enabled();
+    if (metrics)
+    {
+        cp_metrics_parse();
+    }
 
     for (;;)
     {
+        uint64_t start_time = 0;
+        unsigned long start_allocations = 0;
+        if (slowlog != NULL || metrics)
+        {
+            start_time = cp_slowlog_now();
+        }
+        if (slowlog != NULL)
+        {
+            start_allocations = cp_ast_nallocations();
+            yy.slowlog_prefix_length = 0;
+        }
+
         if (parse_one(&yy, rule))
         {
             goto cleanup;
@@ -651,11 +1062,26 @@ int parse_each(yyrule rule, source_cb_t source, void *sourcedata,
         unsigned int nroots = astnodes_size(&(top_block->children));
 
         cypher_parse_segment_t *segment = cypher_parse_segment(ordinal,
-                range, errors, nerrors, roots, nroots, yy.result, yy.eof);
+                range, errors, nerrors, roots, nroots, yy.result, yy.eof,
+                flags & CYPHER_PARSE_NODE_INDEX);
         if (segment == NULL)
         {
             goto cleanup;
         }
+        if (slowlog != NULL || metrics)
+        {
+            uint64_t duration = cp_slowlog_now() - start_time;
+            if (slowlog != NULL)
+            {
+                record_slow_parse(&yy, segment, duration, start_allocations);
+            }
+            if (metrics)
+            {
+                cp_metrics_segment(duration,
+                        range.end.offset - range.start.offset, nerrors,
+                        segment->nnodes);
+            }
+        }
 
         cp_et_clear_errors(&(yy.error_tracking));
         astnodes_clear(&(top_block->children));
@@ -699,6 +1125,7 @@ cleanup:
     precedences_cleanup(&(yy.precedences));
     cp_et_cleanup(&(yy.error_tracking));
     cp_sb_cleanup(&(yy.string_buffer));
+    cp_utf8_validator_cleanup(&utf8);
     yyrelease(&yy);
     errno = errsv;
     return result;
@@ -714,7 +1141,7 @@ static int parse_all_callback(void *data, cypher_parse_segment_t *segment)
 
 cypher_parse_result_t *parse(yyrule rule, source_cb_t source, void *sourcedata,
         struct cypher_input_position *last, cypher_parser_config_t *config,
-        uint_fast32_t flags)
+        uint_fast32_t flags, struct cp_literals *literals)
 {
     cypher_parse_result_t *result = calloc(1, sizeof(cypher_parse_result_t));
     if (result == NULL)
@@ -723,7 +1150,7 @@ cypher_parse_result_t *parse(yyrule rule, source_cb_t source, void *sourcedata,
     }
 
     if (parse_each(rule, source, sourcedata, parse_all_callback, result,
-                last, config, flags))
+                last, config, flags, literals))
     {
         cypher_parse_result_free(result);
         return NULL;
@@ -733,6 +1160,274 @@ cypher_parse_result_t *parse(yyrule rule, source_cb_t source, void *sourcedata,
 }
 
 
+struct parse_events_data
+{
+    const struct cypher_parser_event_handlers *handlers;
+    void *userdata;
+    struct cp_ast_scratch *scratch;
+};
+
+
+static int parse_events_callback(void *data, cypher_parse_segment_t *segment)
+{
+    struct parse_events_data *d = data;
+    cp_ast_scratch_activate(NULL);
+    int err = cp_emit_segment_events(d->handlers, d->userdata, segment);
+    // the nodes are released with the scratch area, rather than individually
+    segment->nroots = 0;
+    segment->directive = NULL;
+    cp_ast_scratch_reset(d->scratch);
+    cp_ast_scratch_activate(d->scratch);
+    return err;
+}
+
+
+/*
+ * Parse the input, building the AST for each segment in a scratch area that
+ * is reset once events for the segment have been emitted.
+ */
+int parse_events(yyrule rule, source_cb_t source, void *sourcedata,
+        const struct cypher_parser_event_handlers *handlers, void *userdata,
+        struct cypher_input_position *last, cypher_parser_config_t *config,
+        uint_fast32_t flags)
+{
+    REQUIRE(handlers != NULL, -1);
+    struct parse_events_data data =
+            { .handlers = handlers, .userdata = userdata,
+              .scratch = cp_ast_scratch_new() };
+    if (data.scratch == NULL)
+    {
+        return -1;
+    }
+
+    cp_ast_scratch_activate(data.scratch);
+    int result = parse_each(rule, source, sourcedata, parse_events_callback,
+            &data, last, config, flags, NULL);
+    int errsv = errno;
+    cp_ast_scratch_activate(NULL);
+    cp_ast_scratch_free(data.scratch);
+    errno = errsv;
+    return result;
+}
+
+
+struct lazy_source
+{
+    yyrule rule;
+    uint_fast32_t flags;
+    struct cypher_parser_config config;
+    const char *buffer;
+    size_t length;
+    FILE *stream;
+    off_t stream_start;
+};
+
+
+static int lazy_result_callback(void *data, cypher_parse_segment_t *segment)
+{
+    return cp_lazy_result_add_segment((cypher_parse_result_t *)data, segment);
+}
+
+
+static int load_segment_callback(void *data, cypher_parse_segment_t *segment)
+{
+    cypher_parse_segment_retain(segment);
+    *(cypher_parse_segment_t **)data = segment;
+    return 1;
+}
+
+
+static cypher_parse_segment_t *load_lazy_segment(void *data,
+        const struct cp_lazy_segment *segment)
+{
+    struct lazy_source *src = data;
+    struct cypher_parser_config config = src->config;
+    config.initial_position = segment->range.start;
+    config.initial_ordinal = segment->ordinal;
+    config.lazy_segments = 0;
+    config.parallel_literal_threshold = 0;
+
+    size_t offset = segment->range.start.offset -
+            src->config.initial_position.offset;
+    uint_fast32_t flags = src->flags | CYPHER_PARSE_SINGLE;
+    cypher_parse_segment_t *loaded = NULL;
+    int err;
+    if (src->stream == NULL)
+    {
+        assert(offset <= src->length);
+        struct source_from_buffer_data sourcedata =
+                { .buffer = src->buffer + offset,
+                  .length = src->length - offset };
+        err = parse_each(src->rule, source_from_buffer, &sourcedata,
+                load_segment_callback, &loaded, NULL, &config, flags, NULL);
+    }
+    else
+    {
+#ifndef WIN32
+        if (fseeko(src->stream, src->stream_start + (off_t)offset, SEEK_SET))
+        {
+            return NULL;
+        }
+#endif
+        err = parse_each(src->rule, source_from_stream, src->stream,
+                load_segment_callback, &loaded, NULL, &config, flags, NULL);
+    }
+
+    if (err)
+    {
+        cypher_parse_segment_release(loaded);
+        return NULL;
+    }
+    if (loaded == NULL ||
+            loaded->range.end.offset != segment->range.end.offset)
+    {
+        cypher_parse_segment_release(loaded);
+        errno = EIO;
+        return NULL;
+    }
+    return loaded;
+}
+
+
+bool lazy_enabled(const cypher_parser_config_t *config, uint_fast32_t flags)
+{
+    return config != NULL && config->lazy_segments > 0 &&
+            !(flags & CYPHER_PARSE_VALIDATE_ONLY);
+}
+
+
+/*
+ * Parse the input once, recording the range, ordinals and errors of each
+ * segment but releasing its AST immediately. Segments are then reparsed
+ * from the original input when accessed, and a bounded number are kept.
+ */
+cypher_parse_result_t *parse_lazy(yyrule rule, source_cb_t source,
+        void *sourcedata, struct cypher_input_position *last,
+        cypher_parser_config_t *config, uint_fast32_t flags,
+        const char *buffer, size_t length, FILE *stream, off_t stream_start)
+{
+    struct lazy_source *src = calloc(1, sizeof(struct lazy_source));
+    if (src == NULL)
+    {
+        return NULL;
+    }
+    src->rule = rule;
+    src->flags = flags;
+    src->config = *config;
+    src->buffer = buffer;
+    src->length = length;
+    src->stream = stream;
+    src->stream_start = stream_start;
+
+    cypher_parse_result_t *result = cp_lazy_result(config->initial_ordinal,
+            config->lazy_segments, load_lazy_segment, src, free);
+    if (result == NULL)
+    {
+        free(src);
+        return NULL;
+    }
+
+    if (parse_each(rule, source, sourcedata, lazy_result_callback, result,
+                last, config, flags, NULL))
+    {
+        cypher_parse_result_free(result);
+        return NULL;
+    }
+
+    return result;
+}
+
+
+int parse_literal_chunk(void *data, struct cp_literal_chunk *chunk)
+{
+    cypher_parser_config_t *config = data;
+    int result = -1;
+
+    yycontext yy;
+    memset(&yy, 0, sizeof(yycontext));
+    yy.config = config;
+    yy.position_offset = chunk->position;
+    offsets_init(&(yy.line_start_offsets));
+    blocks_init(&(yy.blocks));
+    operators_init(&(yy.operators));
+    precedences_init(&(yy.precedences));
+    struct source_from_buffer_data sourcedata =
+            { .buffer = chunk->text, .length = chunk->length };
+    yy.source = source_from_buffer;
+    yy.source_data = &sourcedata;
+    // a duplicate key fails the chunk, so that the serial reparse reports
+    // it only if requested
+    yy.reject_duplicate_keys = true;
+    cp_et_init(&(yy.error_tracking), config->error_colorization);
+
+    if (offsets_push(&(yy.line_start_offsets), 0))
+    {
+        goto cleanup;
+    }
+    struct block *top_block = block_start(&yy, 0, input_position(&yy, 0));
+    if (top_block == NULL)
+    {
+        goto cleanup;
+    }
+
+    int r = safe_yyparsefrom(&yy,
+            chunk->is_map? yy_literal_entries : yy_literal_elements);
+    if (r < 0)
+    {
+        goto cleanup;
+    }
+    if (r == 0 || cp_et_nerrors(&(yy.error_tracking)) > 0)
+    {
+        chunk->failed = true;
+        result = 0;
+        goto cleanup;
+    }
+    assert(blocks_size(&(yy.blocks)) == 1 && yy.prev_block == NULL);
+
+    unsigned int nelements = astnodes_size(&(top_block->sequence));
+    chunk->elements = mdup(astnodes_elements(&(top_block->sequence)),
+            nelements * sizeof(cypher_astnode_t *));
+    if (nelements > 0 && chunk->elements == NULL)
+    {
+        goto cleanup;
+    }
+    unsigned int nchildren = astnodes_size(&(top_block->children));
+    chunk->children = mdup(astnodes_elements(&(top_block->children)),
+            nchildren * sizeof(cypher_astnode_t *));
+    if (nchildren > 0 && chunk->children == NULL)
+    {
+        free(chunk->elements);
+        chunk->elements = NULL;
+        goto cleanup;
+    }
+    chunk->nelements = nelements;
+    chunk->nchildren = nchildren;
+    astnodes_clear(&(top_block->sequence));
+    astnodes_clear(&(top_block->children));
+
+    result = 0;
+
+    int errsv;
+cleanup:
+    errsv = errno;
+    struct block *block;
+    while ((block = blocks_pop(&(yy.blocks))) != NULL)
+    {
+        block_free(block);
+    }
+    block_free(yy.prev_block);
+    offsets_cleanup(&(yy.line_start_offsets));
+    blocks_cleanup(&(yy.blocks));
+    operators_cleanup(&(yy.operators));
+    precedences_cleanup(&(yy.precedences));
+    cp_et_cleanup(&(yy.error_tracking));
+    cp_sb_cleanup(&(yy.string_buffer));
+    yyrelease(&yy);
+    errno = errsv;
+    return result;
+}
+
+
 int parse_one(yycontext *yy, yyrule rule)
 {
 #ifndef NDEBUG
@@ -741,6 +1436,8 @@ int parse_one(yycontext *yy, yyrule rule)
 
     yy->result = NULL;
     yy->eof = false;
+    yy->window_offset = 0;
+    yy->window_lines = 0;
     if (safe_yyparsefrom(yy, rule) <= 0)
     {
         goto failure;
@@ -783,71 +1480,253 @@ failure:
 }
 
 
-int safe_yyparsefrom(yycontext *yy, yyrule rule)
-{
-    int err;
-    if ((err = sigsetjmp(yy->abort_env, 0)) != 0)
+int safe_yyparsefrom(yycontext *yy, yyrule rule)
+{
+    int err;
+    if ((err = sigsetjmp(yy->abort_env, 0)) != 0)
+    {
+        errno = err;
+        return -1;
+    }
+
+    int result = yyparsefrom(yy, rule);
+    memset(yy->abort_env, 0, sizeof(sigjmp_buf));
+    return result;
+}
+
+
+void *abort_malloc(yycontext *yy, size_t size)
+{
+    void *m = malloc(size);
+    if (m == NULL)
+    {
+        abort_parse(yy);
+    }
+    return m;
+}
+
+
+void *abort_realloc(yycontext *yy, void *ptr, size_t size)
+{
+    void *m = realloc(ptr, size);
+    if (m == NULL)
+    {
+        abort_parse(yy);
+    }
+    return m;
+}
+
+
+void finished(yycontext *yy)
+{
+    yy->consumed = segment_offset(yy, yy->__pos);
+    add_utf8_errors(yy);
+    if (yy->window_offset == 0)
+    {
+        capture_prefix(yy);
+    }
+
+    for (unsigned int i = cp_et_nerrors(&(yy->error_tracking)); i-- > 0; )
+    {
+        cypher_parse_error_t *err = yy->error_tracking.errors + i;
+        if (err->context != NULL)
+        {
+            break;
+        }
+
+        size_t ctx_offset = err->position.offset -
+                yy->position_offset.offset - yy->window_offset;
+        char *ctx = line_context(yy->__buf, yy->__limit, &ctx_offset,
+                ERROR_CONTEXT_LENGTH);
+        if (ctx == NULL)
+        {
+            abort_parse(yy);
+        }
+        err->context = ctx;
+        err->context_offset = ctx_offset;
+    }
+}
+
+
+void line_start(yycontext *yy)
+{
+    mark_line_start(yy, segment_offset(yy, yy->__pos));
+}
+
+
+/*
+ * Match a non-ASCII character that may start (or continue) a symbolic name,
+ * advancing the input past it.
+ */
+bool unicode_sym(yycontext *yy, bool start)
+{
+    int n = unicode_sym_length(yy, yy->__pos, start);
+    yy->__pos += n;
+    return n > 0;
+}
+
+
+/*
+ * A cut is placed where the grammar can no longer backtrack past the current
+ * position (after each complete clause of a query). Once the buffer is more
+ * than half consumed, the pending actions are run and the input before the
+ * cut is discarded, so that the buffer need only hold the input since the
+ * last cut rather than the entire statement. Input needed for the context of
+ * errors not yet reported is retained.
+ */
+void cut(yycontext *yy)
+{
+    assert(yy->__pos >= 0);
+    if (yy->__pos < yy->__buflen / 2)
+    {
+        return;
+    }
+
+    yyDone(yy);
+
+    size_t discard = context_start(yy, yy->__pos);
+    for (unsigned int i = cp_et_nerrors(&(yy->error_tracking)); i-- > 0; )
+    {
+        cypher_parse_error_t *err = yy->error_tracking.errors + i;
+        if (err->context != NULL)
+        {
+            break;
+        }
+        discard = minzu(discard, context_start(yy, err->position.offset -
+                yy->position_offset.offset - yy->window_offset));
+    }
+    if (yy->error_tracking.nlabels > 0)
+    {
+        discard = minzu(discard, context_start(yy,
+                yy->error_tracking.last_position.offset -
+                yy->position_offset.offset - yy->window_offset));
+    }
+    const struct cp_utf8_error *utf8_err = (yy->utf8 != NULL)?
+            cp_utf8_peek_error(yy->utf8) : NULL;
+    if (utf8_err != NULL)
+    {
+        discard = minzu(discard, context_start(yy, utf8_err->position.offset -
+                yy->position_offset.offset - yy->window_offset));
+    }
+
+    // only shift when enough is discarded to amortize the move
+    if (discard < (size_t)yy->__buflen / 4)
+    {
+        return;
+    }
+
+    if (yy->window_offset == 0)
+    {
+        capture_prefix(yy);
+    }
+    memmove(yy->__buf, yy->__buf + discard, yy->__limit - discard);
+    yy->__limit -= discard;
+    yy->__pos -= discard;
+    yy->__begin = (yy->__begin > (int)discard)? yy->__begin - discard : 0;
+    yy->__end = (yy->__end > (int)discard)? yy->__end - discard : 0;
+    yy->window_offset += discard;
+
+    // blocks still open began before the cut, and their text is never used
+    for (unsigned int i = blocks_size(&(yy->blocks)); i-- > 0; )
+    {
+        struct block *block = blocks_get(&(yy->blocks), i);
+        block->buffer_start -= minzu(block->buffer_start, discard);
+        block->buffer_end -= minzu(block->buffer_end, discard);
+    }
+    if (yy->prev_block != NULL)
+    {
+        struct block *block = yy->prev_block;
+        block->buffer_start -= minzu(block->buffer_start, discard);
+        block->buffer_end -= minzu(block->buffer_end, discard);
+    }
+
+    // drop the starts of lines that end before the window
+    unsigned int *starts = offsets_elements(&(yy->line_start_offsets));
+    unsigned int nstarts = offsets_size(&(yy->line_start_offsets));
+    unsigned int first = 0;
+    while (first + 1 < nstarts && starts[first + 1] <= yy->window_offset)
     {
-        errno = err;
-        return -1;
+        ++first;
+    }
+    if (first > 0)
+    {
+        memmove(starts, starts + first, (nstarts - first) * sizeof(*starts));
+        offsets_npop(&(yy->line_start_offsets), first);
+        yy->window_lines += first;
     }
+}
 
-    int result = yyparsefrom(yy, rule);
-    memset(yy->abort_env, 0, sizeof(sigjmp_buf));
-    return result;
+
+unsigned int segment_offset(yycontext *yy, int pos)
+{
+    assert(pos >= 0);
+    return yy->window_offset + (unsigned int)pos;
 }
 
 
-void *abort_malloc(yycontext *yy, size_t size)
+/*
+ * Retain the start of the segment's input for the slowlog, which must be
+ * done before it is discarded from the buffer.
+ */
+void capture_prefix(yycontext *yy)
 {
-    void *m = malloc(size);
-    if (m == NULL)
+    if (yy->config->slowlog == NULL)
     {
-        abort_parse(yy);
+        return;
     }
-    return m;
+    assert(yy->window_offset == 0);
+    size_t n = minzu(yy->__pos, CYPHER_SLOWLOG_PREFIX_LENGTH);
+    // don't split a multibyte character
+    while (n > 0 && n < (size_t)yy->__pos &&
+            ((unsigned char)yy->__buf[n] & 0xC0) == 0x80)
+    {
+        --n;
+    }
+    memcpy(yy->slowlog_prefix, yy->__buf, n);
+    yy->slowlog_prefix_length = n;
 }
 
 
-void *abort_realloc(yycontext *yy, void *ptr, size_t size)
+void record_slow_parse(yycontext *yy, const cypher_parse_segment_t *segment,
+        uint64_t duration, unsigned long start_allocations)
 {
-    void *m = realloc(ptr, size);
-    if (m == NULL)
+    if (!cp_slowlog_exceeds(yy->config->slowlog, duration, segment->nnodes))
     {
-        abort_parse(yy);
+        return;
     }
-    return m;
+
+    struct cypher_slowlog_entry entry;
+    entry.range = segment->range;
+    entry.nnodes = segment->nnodes;
+    entry.nerrors = segment->nerrors;
+    entry.nallocations = cp_ast_nallocations() - start_allocations;
+    entry.duration = duration;
+    entry.prefix_length = yy->slowlog_prefix_length;
+    memcpy(entry.prefix, yy->slowlog_prefix, entry.prefix_length);
+    entry.prefix[entry.prefix_length] = '\0';
+    cp_slowlog_record(yy->config->slowlog, &entry);
 }
 
 
-void finished(yycontext *yy)
+// the start of the input used by line_context for an offset in the buffer
+size_t context_start(yycontext *yy, size_t offset)
 {
-    yy->consumed = yy->__pos;
-
-    for (unsigned int i = cp_et_nerrors(&(yy->error_tracking)); i-- > 0; )
+    const char *buf = yy->__buf;
+    if (offset >= (size_t)yy->__limit)
     {
-        cypher_parse_error_t *err = yy->error_tracking.errors + i;
-        if (err->context != NULL)
-        {
-            break;
-        }
-
-        size_t ctx_offset = err->position.offset - yy->position_offset.offset;
-        char *ctx = line_context(yy->__buf, yy->__limit, &ctx_offset, 80);
-        if (ctx == NULL)
-        {
-            abort_parse(yy);
-        }
-        err->context = ctx;
-        err->context_offset = ctx_offset;
+        offset = (yy->__limit > 0)? yy->__limit - 1 : 0;
+    }
+    while (offset > 0 &&
+            (buf[offset] == '\n' || buf[offset] == '\r' || buf[offset] == '\0'))
+    {
+        --offset;
     }
+    return offset - minzu(offset, ERROR_CONTEXT_LENGTH);
 }
 
 
-void line_start(yycontext *yy)
+void mark_line_start(yycontext *yy, unsigned int pos)
 {
-    assert(yy->__pos >= 0);
-    unsigned int pos = (unsigned int)yy->__pos;
     unsigned int line_start_pos = backtrack_lines(yy, pos);
     if (line_start_pos == pos)
     {
@@ -885,10 +1764,11 @@ struct cypher_input_position input_position(yycontext *yy, unsigned int pos)
     assert(depth > 0);
     assert(line_start_pos <= pos);
 
+    bool first_line = (depth == 1 && yy->window_lines == 0);
     struct cypher_input_position position =
-        { .line = (depth-1) + yy->position_offset.line,
+        { .line = (depth-1) + yy->window_lines + yy->position_offset.line,
           .column = pos - line_start_pos +
-              ((depth == 1)? yy->position_offset.column : 1),
+              (first_line? yy->position_offset.column : 1),
           .offset = pos + yy->position_offset.offset };
     return position;
 }
@@ -896,8 +1776,8 @@ struct cypher_input_position input_position(yycontext *yy, unsigned int pos)
 
 void block_start_action(yycontext *yy, char *text, int pos)
 {
-    assert(pos >= 0);
-    struct cypher_input_position position = input_position(yy, pos);
+    struct cypher_input_position position =
+            input_position(yy, segment_offset(yy, pos));
     if (block_start(yy, pos, position) == NULL)
     {
         abort_parse(yy);
@@ -933,8 +1813,8 @@ struct block *block_start(yycontext *yy, size_t offset,
 // close a block (and move to yy->prev_block)
 void block_end_action(yycontext *yy, char *text, int pos)
 {
-    assert(pos >= 0);
-    struct cypher_input_position position = input_position(yy, pos);
+    struct cypher_input_position position =
+            input_position(yy, segment_offset(yy, pos));
     struct block *block = block_end(yy, pos, position);
     assert(block != NULL);
     assert(yy->prev_block == NULL || astnodes_size(&(yy->prev_block->children)) == 0);
@@ -946,8 +1826,8 @@ void block_end_action(yycontext *yy, char *text, int pos)
 // close a block, and start a new block with the same starting input position
 void block_replace_action(yycontext *yy, char *text, int pos)
 {
-    assert(pos >= 0);
-    struct cypher_input_position position = input_position(yy, pos);
+    struct cypher_input_position position =
+            input_position(yy, segment_offset(yy, pos));
     struct block *block = block_end(yy, pos, position);
     assert(block != NULL);
     assert(yy->prev_block == NULL || astnodes_size(&(yy->prev_block->children)) == 0);
@@ -963,8 +1843,8 @@ void block_replace_action(yycontext *yy, char *text, int pos)
 // close a block, but move all the children to the parent
 void block_merge_action(yycontext *yy, char *text, int pos)
 {
-    assert(pos >= 0);
-    struct cypher_input_position position = input_position(yy, pos);
+    struct cypher_input_position position =
+            input_position(yy, segment_offset(yy, pos));
     struct block *block = block_end(yy, pos, position);
     assert(block != NULL);
     assert(yy->prev_block == NULL || astnodes_size(&(yy->prev_block->children)) == 0);
@@ -1021,12 +1901,11 @@ void block_free(struct block *block)
 
 void _err(yycontext *yy, const char *label)
 {
-    assert(yy->__pos >= 0);
-    unsigned int pos = (unsigned int)yy->__pos;
+    unsigned int pos = segment_offset(yy, yy->__pos);
     backtrack_lines(yy, pos);
 
     struct cypher_input_position position = input_position(yy, pos);
-    char c = (yy->__pos < yy->__limit)? yy->__buf[pos] : '\0';
+    char c = (yy->__pos < yy->__limit)? yy->__buf[yy->__pos] : '\0';
     if (cp_et_note_potential_error(&(yy->error_tracking), position, c, label))
     {
         abort_parse(yy);
@@ -1043,6 +1922,339 @@ void record_error(yycontext *yy)
 }
 
 
+/*
+ * Error recovery: advance the input to the next sync point of the given
+ * kind, which is EOF, a ';', or a whitespace character or comment that is
+ * immediately followed by a keyword for that kind (see `resync_keywords`).
+ * Every input position is tested, including those within strings and
+ * comments, exactly as if the grammar were testing each in turn - but bytes
+ * that cannot begin a sync point are skipped without further inspection.
+ */
+static const struct resync_keyword
+{
+    const char *word;
+    const char *word2;
+    unsigned int points;
+} resync_keywords[] =
+    { { "LOAD", "CSV", RESYNC_CLAUSE | RESYNC_STATEMENT | RESYNC_DIRECTIVE },
+      { "START", NULL, RESYNC_CLAUSE | RESYNC_STATEMENT | RESYNC_DIRECTIVE },
+      { "MATCH", NULL, RESYNC_CLAUSE | RESYNC_STATEMENT | RESYNC_DIRECTIVE },
+      { "UNWIND", NULL, RESYNC_CLAUSE | RESYNC_STATEMENT | RESYNC_DIRECTIVE },
+      { "MERGE", NULL, RESYNC_CLAUSE | RESYNC_STATEMENT | RESYNC_DIRECTIVE },
+      { "CREATE", NULL, RESYNC_CLAUSE | RESYNC_STATEMENT | RESYNC_DIRECTIVE },
+      { "SET", NULL, RESYNC_CLAUSE | RESYNC_STATEMENT | RESYNC_DIRECTIVE },
+      { "DELETE", NULL, RESYNC_CLAUSE | RESYNC_STATEMENT | RESYNC_DIRECTIVE },
+      { "REMOVE", NULL, RESYNC_CLAUSE | RESYNC_STATEMENT | RESYNC_DIRECTIVE },
+      { "FOREACH", NULL, RESYNC_CLAUSE | RESYNC_STATEMENT | RESYNC_DIRECTIVE },
+      { "WITH", NULL, RESYNC_CLAUSE | RESYNC_STATEMENT | RESYNC_DIRECTIVE },
+      { "CALL", NULL, RESYNC_CLAUSE | RESYNC_STATEMENT | RESYNC_DIRECTIVE },
+      { "RETURN", NULL, RESYNC_CLAUSE | RESYNC_STATEMENT | RESYNC_DIRECTIVE },
+      { "DROP", NULL, RESYNC_CLAUSE | RESYNC_STATEMENT | RESYNC_DIRECTIVE },
+      { "CYPHER", NULL, RESYNC_PARAMS | RESYNC_STATEMENT | RESYNC_DIRECTIVE },
+      { "PROFILE", NULL, RESYNC_STATEMENT | RESYNC_DIRECTIVE },
+      { "EXPLAIN", NULL, RESYNC_STATEMENT | RESYNC_DIRECTIVE } };
+#define NRESYNC_KEYWORDS \
+    (sizeof(resync_keywords) / sizeof(struct resync_keyword))
+
+#define RESYNC_UPPER(c) (((c) >= 'a' && (c) <= 'z')? (c) - ('a' - 'A') : (c))
+
+static const unsigned char resync_chars[256] =
+    { [' '] = 1, ['\t'] = 1, ['\n'] = 1, ['\r'] = 1, [';'] = 1, ['/'] = 1 };
+
+
+bool resync(yycontext *yy, enum resync_point point)
+{
+    int pos = yy->__pos;
+    // positions of the next newline and comment close found, which remain
+    // valid until the scan passes them (-1 if there are none before EOF)
+    int next_newline = -2;
+    int next_close = -2;
+
+    for (;;)
+    {
+        if (pos >= yy->__limit && !refill(yy))
+        {
+            break;
+        }
+        const char *buf = yy->__buf;
+        int limit = yy->__limit;
+        while (pos < limit && !resync_chars[(unsigned char)buf[pos]])
+        {
+            ++pos;
+        }
+        if (pos >= limit)
+        {
+            continue;
+        }
+
+        int c = (unsigned char)buf[pos];
+        int next = -1;
+        if (c == ';')
+        {
+            break;
+        }
+        else if (c == ' ' || c == '\t')
+        {
+            next = pos + 1;
+        }
+        else if (c == '\n')
+        {
+            next = pos + 1;
+            mark_line_start(yy, segment_offset(yy, next));
+        }
+        else if (c == '\r')
+        {
+            if (resync_peek(yy, pos + 1) == '\n')
+            {
+                next = pos + 2;
+                mark_line_start(yy, segment_offset(yy, next));
+            }
+        }
+        else if (resync_peek(yy, pos + 1) == '/')
+        {
+            if (next_newline != -1 && next_newline < pos + 2)
+            {
+                next_newline = resync_find(yy, pos + 2, "\n");
+            }
+            // a line comment ending at EOF cannot be followed by a keyword
+            next = (next_newline < 0)? -1 : next_newline + 1;
+        }
+        else if (resync_peek(yy, pos + 1) == '*')
+        {
+            if (next_close != -1 && next_close < pos + 2)
+            {
+                next_close = resync_find(yy, pos + 2, "*/");
+            }
+            next = (next_close < 0)? -1 : next_close + 2;
+        }
+
+        if (next >= 0 && resync_keyword(yy, next, point))
+        {
+            break;
+        }
+        ++pos;
+    }
+
+    yy->__pos = pos;
+    return true;
+}
+
+
+/*
+ * Read more input for lookahead beyond the current parse position. The leg
+ * refill reads input at the parse position, as it only expects to be called
+ * once all buffered input is consumed.
+ */
+int refill(yycontext *yy)
+{
+    int pos = yy->__pos;
+    yy->__pos = yy->__limit;
+    int result = yyrefill(yy);
+    yy->__pos = pos;
+    return result;
+}
+
+
+int resync_peek(yycontext *yy, int pos)
+{
+    while (pos >= yy->__limit)
+    {
+        if (!refill(yy))
+        {
+            return -1;
+        }
+    }
+    return (unsigned char)yy->__buf[pos];
+}
+
+
+int resync_find(yycontext *yy, int pos, const char *s)
+{
+    size_t n = strlen(s);
+    assert(n > 0);
+    for (;;)
+    {
+        if (pos >= yy->__limit && !refill(yy))
+        {
+            return -1;
+        }
+        const char *start = yy->__buf + pos;
+        const char *p = memchr(start, s[0], yy->__limit - pos);
+        if (p == NULL)
+        {
+            pos = yy->__limit;
+            continue;
+        }
+        pos += p - start;
+        size_t i = 1;
+        for (; i < n && resync_peek(yy, pos + i) == (unsigned char)s[i]; ++i)
+            ;
+        if (i == n)
+        {
+            return pos;
+        }
+        ++pos;
+    }
+}
+
+
+int resync_keyword(yycontext *yy, int pos, enum resync_point point)
+{
+    int c = resync_peek(yy, pos);
+    if (c < 0)
+    {
+        return 0;
+    }
+    if (c == ':')
+    {
+        return (point & RESYNC_DIRECTIVE) != 0;
+    }
+    c = RESYNC_UPPER(c);
+    for (unsigned int i = 0; i < NRESYNC_KEYWORDS; ++i)
+    {
+        const struct resync_keyword *keyword = &(resync_keywords[i]);
+        if (!(keyword->points & point) || keyword->word[0] != c)
+        {
+            continue;
+        }
+        int end = resync_word(yy, pos, keyword->word);
+        if (end >= 0 && keyword->word2 != NULL)
+        {
+            end = resync_word(yy, resync_skip_whitespace(yy, end),
+                    keyword->word2);
+        }
+        if (end >= 0)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+int resync_word(yycontext *yy, int pos, const char *word)
+{
+    for (; *word != '\0'; ++word, ++pos)
+    {
+        int c = resync_peek(yy, pos);
+        if (c < 0 || RESYNC_UPPER(c) != *word)
+        {
+            return -1;
+        }
+    }
+    int c = resync_peek(yy, pos);
+    // the keyword must be followed by a word boundary (see `WB`)
+    if (c >= 0 && ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                (c >= '0' && c <= '9') || c == '_' || c == '$' ||
+                unicode_sym_length(yy, pos, false) > 0))
+    {
+        return -1;
+    }
+    return pos;
+}
+
+
+int resync_skip_whitespace(yycontext *yy, int pos)
+{
+    for (;;)
+    {
+        int c = resync_peek(yy, pos);
+        if (c == ' ' || c == '\t' || c == '\n')
+        {
+            ++pos;
+            continue;
+        }
+        int c2 = resync_peek(yy, pos + 1);
+        if (c == '\r' && c2 == '\n')
+        {
+            pos += 2;
+        }
+        else if (c == '/' && c2 == '/')
+        {
+            int newline = resync_find(yy, pos + 2, "\n");
+            if (newline < 0)
+            {
+                return yy->__limit;
+            }
+            pos = newline + 1;
+        }
+        else if (c == '/' && c2 == '*')
+        {
+            int close = resync_find(yy, pos + 2, "*/");
+            if (close < 0)
+            {
+                return pos;
+            }
+            pos = close + 2;
+        }
+        else
+        {
+            return pos;
+        }
+    }
+}
+
+
+/*
+ * Return the length of the UTF-8 encoded character at the position, if it is
+ * a non-ASCII character allowed at the start (or within) a symbolic name,
+ * or 0 otherwise.
+ */
+int unicode_sym_length(yycontext *yy, int pos, bool start)
+{
+    if (resync_peek(yy, pos) < 0x80)
+    {
+        return 0;
+    }
+    uint32_t c;
+    int n;
+    while ((n = cp_utf8_decode((unsigned char *)yy->__buf + pos,
+                    yy->__limit - pos, &c)) == 0)
+    {
+        if (!refill(yy))
+        {
+            return 0;
+        }
+    }
+    if (n < 0 ||
+            !(start? cp_unicode_is_id_start(c) : cp_unicode_is_id_part(c)))
+    {
+        return 0;
+    }
+    return n;
+}
+
+
+/*
+ * Move UTF-8 validation errors within the segment into the error tracking,
+ * leaving any in later input for the next segment.
+ */
+void add_utf8_errors(yycontext *yy)
+{
+    if (yy->utf8 == NULL)
+    {
+        return;
+    }
+    const struct cypher_parser_colorization *colorization =
+            yy->error_tracking.colorization;
+    size_t end = yy->position_offset.offset + yy->consumed;
+    const struct cp_utf8_error *err;
+    while ((err = cp_utf8_peek_error(yy->utf8)) != NULL &&
+            err->position.offset < end)
+    {
+        if (cp_et_add_error(&(yy->error_tracking), err->position,
+                    "%sInvalid input%s %s'\\x%02X'%s: not valid UTF-8",
+                    colorization->error[0], colorization->error[1],
+                    colorization->error_token[0], err->byte,
+                    colorization->error_token[1]))
+        {
+            abort_parse(yy);
+        }
+        cp_utf8_take_error(yy->utf8);
+    }
+}
+
+
 void _strbuf_append(yycontext *yy, const char *s, size_t n)
 {
     if (cp_sb_append(&(yy->string_buffer), s, n))
@@ -2322,16 +3534,60 @@ cypher_astnode_t *_slice_operator(yycontext *yy, cypher_astnode_t *expression,
 }
 
 
+int duplicate_key(void *userdata, unsigned int earlier, unsigned int later)
+{
+    struct duplicate_keys *dk = (struct duplicate_keys *)userdata;
+    const cypher_astnode_t *key = dk->entries[later * dk->stride];
+    const char *name;
+    if (cypher_astnode_instanceof(key, CYPHER_AST_PROP_NAME))
+    {
+        name = cypher_ast_prop_name_get_value(key);
+    }
+    else if (cypher_astnode_instanceof(key,
+                CYPHER_AST_MAP_PROJECTION_LITERAL))
+    {
+        key = cypher_ast_map_projection_literal_get_prop_name(key);
+        name = cypher_ast_prop_name_get_value(key);
+    }
+    else if (cypher_astnode_instanceof(key,
+                CYPHER_AST_MAP_PROJECTION_PROPERTY))
+    {
+        key = cypher_ast_map_projection_property_get_prop_name(key);
+        name = cypher_ast_prop_name_get_value(key);
+    }
+    else
+    {
+        assert(cypher_astnode_instanceof(key,
+                CYPHER_AST_MAP_PROJECTION_IDENTIFIER));
+        key = cypher_ast_map_projection_identifier_get_identifier(key);
+        name = cypher_ast_identifier_get_name(key);
+    }
+
+    const struct cypher_parser_colorization *colorization =
+            dk->yy->error_tracking.colorization;
+    return cp_et_add_error(&(dk->yy->error_tracking),
+            cypher_astnode_range(key).start, "%sDuplicate key%s %s'%s'%s",
+            colorization->error[0], colorization->error[1],
+            colorization->error_token[0], name,
+            colorization->error_token[1]);
+}
+
+
 cypher_astnode_t *_map_projection(yycontext *yy, cypher_astnode_t *expression)
 {
     assert(yy->prev_block != NULL &&
             "An AST node can only be created immediately after a `>` in the grammar");
-    cypher_astnode_t *node = cypher_ast_map_projection(expression,
+    struct duplicate_keys dk =
+        { .yy = yy,
+          .entries = astnodes_elements(&(yy->prev_block->sequence)),
+          .stride = 1 };
+    cypher_astnode_t *node = cp_ast_map_projection(expression,
             astnodes_elements(&(yy->prev_block->sequence)),
             astnodes_size(&(yy->prev_block->sequence)),
             astnodes_elements(&(yy->prev_block->children)),
             astnodes_size(&(yy->prev_block->children)),
-            yy->prev_block->range);
+            yy->prev_block->range,
+            yy->reject_duplicate_keys? duplicate_key : NULL, &dk);
     if (node == NULL)
     {
         abort_parse(yy);
@@ -2654,10 +3910,49 @@ cypher_astnode_t *_none_predicate(yycontext *yy, cypher_astnode_t *identifier,
 }
 
 
+// Substitute elements parsed separately for those of a blanked literal
+static void splice_literal(yycontext *yy, bool is_map)
+{
+    struct block *block = yy->prev_block;
+    struct cp_literal *literal =
+            cp_find_literal(yy->literals, block->range.start.offset);
+    if (literal == NULL || literal->is_map != is_map || literal->spliced)
+    {
+        return;
+    }
+    assert(astnodes_size(&(block->sequence)) == 0);
+    literal->spliced = true;
+
+    for (unsigned int i = 0; i < literal->nchunks; ++i)
+    {
+        struct cp_literal_chunk *chunk = &(literal->chunks[i]);
+        for (unsigned int j = 0; j < chunk->nchildren; ++j)
+        {
+            if (astnodes_push(&(block->children), chunk->children[j]))
+            {
+                abort_parse(yy);
+            }
+            chunk->children[j] = NULL;
+        }
+        for (unsigned int j = 0; j < chunk->nelements; ++j)
+        {
+            if (astnodes_push(&(block->sequence), chunk->elements[j]))
+            {
+                abort_parse(yy);
+            }
+        }
+    }
+}
+
+
 cypher_astnode_t *_collection_literal(yycontext *yy)
 {
     assert(yy->prev_block != NULL &&
             "An AST node can only be created immediately after a `>` in the grammar");
+    if (yy->literals != NULL)
+    {
+        splice_literal(yy, false);
+    }
     cypher_astnode_t *node = cypher_ast_collection(
             astnodes_elements(&(yy->prev_block->sequence)),
             astnodes_size(&(yy->prev_block->sequence)),
@@ -2680,13 +3975,22 @@ cypher_astnode_t *_map_literal(yycontext *yy)
 {
     assert(yy->prev_block != NULL &&
             "An AST node can only be created immediately after a `>` in the grammar");
+    if (yy->literals != NULL)
+    {
+        splice_literal(yy, true);
+    }
     assert(astnodes_size(&(yy->prev_block->sequence)) % 2 == 0);
-    cypher_astnode_t *node = cypher_ast_pair_map(
+    struct duplicate_keys dk =
+        { .yy = yy,
+          .entries = astnodes_elements(&(yy->prev_block->sequence)),
+          .stride = 2 };
+    cypher_astnode_t *node = cp_ast_pair_map(
             astnodes_elements(&(yy->prev_block->sequence)),
             astnodes_size(&(yy->prev_block->sequence)) / 2,
             astnodes_elements(&(yy->prev_block->children)),
             astnodes_size(&(yy->prev_block->children)),
-            yy->prev_block->range);
+            yy->prev_block->range,
+            yy->reject_duplicate_keys? duplicate_key : NULL, &dk);
     if (node == NULL)
     {
         abort_parse(yy);
@@ -2819,9 +4123,15 @@ cypher_astnode_t *_strbuf_function_name(yycontext *yy)
     assert(yy->prev_block != NULL &&
             "An AST node can only be created immediately after a `>` in the grammar");
     struct cypher_input_range range = yy->prev_block->range;
-    return add_terminal(yy, cypher_ast_function_name(
-                cp_sb_data(&(yy->string_buffer)),
-                cp_sb_length(&(yy->string_buffer)), range));
+    const char *name = cp_sb_data(&(yy->string_buffer));
+    size_t n = cp_sb_length(&(yy->string_buffer));
+    int id = -1;
+    uint_fast32_t flags = 0;
+    if (yy->config->catalog != NULL)
+    {
+        id = cp_catalog_resolve_function(yy->config->catalog, name, n, &flags);
+    }
+    return add_terminal(yy, cp_ast_function_name(name, n, id, flags, range));
 }
 
 
@@ -2841,9 +4151,15 @@ cypher_astnode_t *_strbuf_proc_name(yycontext *yy)
     assert(yy->prev_block != NULL &&
             "An AST node can only be created immediately after a `>` in the grammar");
     struct cypher_input_range range = yy->prev_block->range;
-    return add_terminal(yy, cypher_ast_proc_name(
-                cp_sb_data(&(yy->string_buffer)),
-                cp_sb_length(&(yy->string_buffer)), range));
+    const char *name = cp_sb_data(&(yy->string_buffer));
+    size_t n = cp_sb_length(&(yy->string_buffer));
+    int id = -1;
+    uint_fast32_t flags = 0;
+    if (yy->config->catalog != NULL)
+    {
+        id = cp_catalog_resolve_procedure(yy->config->catalog, name, n, &flags);
+    }
+    return add_terminal(yy, cp_ast_proc_name(name, n, id, flags, range));
 }
 
 
@@ -3117,7 +4433,8 @@ cypher_astnode_t *add_child(yycontext *yy, cypher_astnode_t *node)
 }
 
 yyrule cypher_yyrule_from_flags(int flags) {
-    if(flags & CYPHER_PARSE_ONLY_STATEMENTS) return yy_statement;
+    if(flags & (CYPHER_PARSE_ONLY_STATEMENTS | CYPHER_PARSE_WITH_PARAMETERS))
+        return yy_statement;
     if(flags & CYPHER_PARSE_ONLY_PARAMETERS) return yy_params;
     return yy_directive;
 }
@@ -61,7 +61,15 @@ const struct cypher_parser_colorization *cypher_parser_ansi_colorization =
 struct cypher_parser_config cypher_parser_std_config =
     { .initial_position = { 1, 1, 0 },
       .initial_ordinal = 0,
-      .error_colorization = &_cypher_parser_no_colorization };
+      .error_colorization = &_cypher_parser_no_colorization,
+      .parallel_literal_threshold = 0,
+      .parallel_literal_threads = 0,
+      .lazy_segments = 0,
+      .catalog = NULL,
+      .read_ahead_block_size = 0,
+      .utf8_validation = false,
+      .slowlog = NULL,
+      .capture = NULL };
 
 
 const char *libcypher_parser_version(void)
@@ -107,3 +115,53 @@ void cypher_parser_config_set_error_colorization(cypher_parser_config_t *config,
 {
     config->error_colorization = colorization;
 }
+
+
+void cypher_parser_config_set_parallel_literals(cypher_parser_config_t *config,
+        size_t threshold, unsigned int nthreads)
+{
+    config->parallel_literal_threshold = threshold;
+    config->parallel_literal_threads = nthreads;
+}
+
+
+void cypher_parser_config_set_lazy_segments(cypher_parser_config_t *config,
+        unsigned int max_cached)
+{
+    config->lazy_segments = max_cached;
+}
+
+
+void cypher_parser_config_set_catalog(cypher_parser_config_t *config,
+        const cypher_catalog_t *catalog)
+{
+    config->catalog = catalog;
+}
+
+
+void cypher_parser_config_set_read_ahead(cypher_parser_config_t *config,
+        size_t block_size)
+{
+    config->read_ahead_block_size = block_size;
+}
+
+
+void cypher_parser_config_set_utf8_validation(cypher_parser_config_t *config,
+        bool enabled)
+{
+    config->utf8_validation = enabled;
+}
+
+
+void cypher_parser_config_set_slowlog(cypher_parser_config_t *config,
+        cypher_slowlog_t *slowlog)
+{
+    config->slowlog = slowlog;
+}
+
+
+void cypher_parser_config_set_capture(cypher_parser_config_t *config,
+        cypher_capture_t *capture)
+{
+    config->capture = capture;
+}
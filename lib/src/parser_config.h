@@ -24,6 +24,14 @@ struct cypher_parser_config
     struct cypher_input_position initial_position;
     unsigned int initial_ordinal;
     const struct cypher_parser_colorization *error_colorization;
+    size_t parallel_literal_threshold;
+    unsigned int parallel_literal_threads;
+    unsigned int lazy_segments;
+    const cypher_catalog_t *catalog;
+    size_t read_ahead_block_size;
+    bool utf8_validation;
+    cypher_slowlog_t *slowlog;
+    cypher_capture_t *capture;
 };
 
 
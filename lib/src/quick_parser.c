@@ -16,6 +16,8 @@
  */
 #include "../../config.h"
 #include "cypher-parser.h"
+#include "capture.h"
+#include "metrics.h"
 #include "util.h"
 #include "vector.h"
 #include <assert.h>
@@ -29,8 +31,19 @@ typedef int (*yyrule)(yycontext *yy);
 typedef int (*source_cb_t)(void *data, char *buf, int n);
 
 static int parse(source_cb_t source, void *sourcedata,
+        cypher_parser_quick_segment_callback_t callback, void *userdata,
+        uint_fast32_t flags, struct cypher_input_position initial_position);
+static int _follow(cypher_quick_follow_t *follow, const char *s, size_t n,
+        cypher_parser_quick_segment_callback_t callback, void *userdata,
+        uint_fast32_t flags);
+static size_t follow_scan(cypher_quick_follow_t *follow, uint_fast32_t flags);
+static int follow_emit_segment(void *data,
+        const cypher_quick_parse_segment_t *segment);
+static int follow_emit(cypher_quick_follow_t *follow, size_t n,
         cypher_parser_quick_segment_callback_t callback, void *userdata,
         uint_fast32_t flags);
+static void follow_reset(cypher_quick_follow_t *follow);
+static inline bool is_escapable(int c);
 static void source(yycontext *yy, char *buf, int *result, int max_size);
 
 
@@ -51,10 +64,44 @@ static int source_from_buffer(void *data, char *buf, int n)
         return len;
     }
     memcpy(buf, input->buffer, len);
+    input->buffer += len;
     return len;
 }
 
 
+#ifndef WIN32
+struct source_from_iovec_data
+{
+    const struct iovec *iov;
+    int iovcnt;
+    size_t offset;
+};
+
+
+static int source_from_iovec(void *data, char *buf, int n)
+{
+    struct source_from_iovec_data *input = data;
+    int len = 0;
+    while (len < n && input->iovcnt > 0)
+    {
+        size_t avail = input->iov->iov_len - input->offset;
+        size_t chunk = minzu(avail, (size_t)(n - len));
+        memcpy(buf + len, (const char *)input->iov->iov_base + input->offset,
+                chunk);
+        len += chunk;
+        input->offset += chunk;
+        if (input->offset == input->iov->iov_len)
+        {
+            ++(input->iov);
+            --(input->iovcnt);
+            input->offset = 0;
+        }
+    }
+    return len;
+}
+#endif
+
+
 static int source_from_stream(void *data, char *buf, int n)
 {
     FILE *stream = data;
@@ -72,16 +119,488 @@ int cypher_quick_uparse(const char *s, size_t n,
         cypher_parser_quick_segment_callback_t callback, void *userdata,
         uint_fast32_t flags)
 {
+    cypher_capture_t *capture = cp_quick_parser_capture();
+    if (capture != NULL && s != NULL)
+    {
+        cp_capture_record(capture, CYPHER_CAPTURE_QUICK_PARSE, flags, s, n);
+    }
     struct source_from_buffer_data sourcedata = { .buffer = s, .length = n };
-    return parse(source_from_buffer, &sourcedata, callback, userdata, flags);
+    return parse(source_from_buffer, &sourcedata, callback, userdata, flags,
+            cypher_input_position_zero);
 }
 
 
+#ifndef WIN32
+int cypher_quick_uparsev(const struct iovec *iov, int iovcnt,
+        cypher_parser_quick_segment_callback_t callback, void *userdata,
+        uint_fast32_t flags)
+{
+    REQUIRE(iov != NULL || iovcnt == 0, -1);
+    REQUIRE(iovcnt >= 0, -1);
+    struct source_from_iovec_data sourcedata =
+            { .iov = iov, .iovcnt = iovcnt, .offset = 0 };
+    return parse(source_from_iovec, &sourcedata, callback, userdata, flags,
+            cypher_input_position_zero);
+}
+#endif
+
+
 int cypher_quick_fparse(FILE *stream,
         cypher_parser_quick_segment_callback_t callback, void *userdata,
         uint_fast32_t flags)
 {
-    return parse(source_from_stream, stream, callback, userdata, flags);
+    return parse(source_from_stream, stream, callback, userdata, flags,
+            cypher_input_position_zero);
+}
+
+
+enum follow_directive
+{
+    FOLLOW_UNDECIDED,
+    FOLLOW_STATEMENT,
+    FOLLOW_COMMAND
+};
+
+
+enum follow_mode
+{
+    FOLLOW_NORMAL,
+    FOLLOW_LINE_COMMENT,
+    FOLLOW_BLOCK_COMMENT,
+    FOLLOW_SINGLE_QUOTED,
+    FOLLOW_DOUBLE_QUOTED
+};
+
+
+struct cypher_quick_follow
+{
+    // input not yet emitted as a segment is `buffer[start..length)`, and
+    // begins at `position`; emitted input is discarded once per call
+    char *buffer;
+    size_t start;
+    size_t length;
+    size_t capacity;
+    struct cypher_input_position position;
+
+    // the scanner state at `scanned` bytes into the unemitted input
+    size_t scanned;
+    enum follow_directive directive;
+    enum follow_mode mode;
+    bool continuation;
+};
+
+
+struct follow_emit_data
+{
+    cypher_parser_quick_segment_callback_t callback;
+    void *userdata;
+    bool delivered;
+    int result;
+    struct cypher_input_position next;
+};
+
+
+cypher_quick_follow_t *cypher_quick_follow_new(void)
+{
+    cypher_quick_follow_t *follow = calloc(1, sizeof(cypher_quick_follow_t));
+    if (follow == NULL)
+    {
+        return NULL;
+    }
+    follow->position = cypher_input_position_zero;
+    follow_reset(follow);
+    return follow;
+}
+
+
+void cypher_quick_follow_free(cypher_quick_follow_t *follow)
+{
+    if (follow == NULL)
+    {
+        return;
+    }
+    free(follow->buffer);
+    free(follow);
+}
+
+
+struct cypher_input_position cypher_quick_follow_position(
+        const cypher_quick_follow_t *follow)
+{
+    REQUIRE(follow != NULL, cypher_input_position_zero);
+    return follow->position;
+}
+
+
+int cypher_quick_ufollow(cypher_quick_follow_t *follow, const char *s,
+        size_t n, cypher_parser_quick_segment_callback_t callback,
+        void *userdata, uint_fast32_t flags)
+{
+    REQUIRE(follow != NULL, -1);
+    REQUIRE(s != NULL || n == 0, -1);
+    REQUIRE(callback != NULL, -1);
+    int err = _follow(follow, s, n, callback, userdata, flags);
+    return (err > 0)? 0 : err;
+}
+
+
+int cypher_quick_ffollow(cypher_quick_follow_t *follow, FILE *stream,
+        cypher_parser_quick_segment_callback_t callback, void *userdata,
+        uint_fast32_t flags)
+{
+    REQUIRE(follow != NULL, -1);
+    REQUIRE(stream != NULL, -1);
+    REQUIRE(callback != NULL, -1);
+    // the stream may have grown since the end of input was last reached
+    clearerr(stream);
+
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), stream)) > 0)
+    {
+        int err = _follow(follow, buf, n, callback, userdata, flags);
+        if (err)
+        {
+            return (err > 0)? 0 : err;
+        }
+    }
+    return ferror(stream)? -1 : 0;
+}
+
+
+/*
+ * Append input to the follow state and emit each directive it completes,
+ * returning a positive value if the callback (or CYPHER_PARSE_SINGLE)
+ * stopped parsing.
+ */
+int _follow(cypher_quick_follow_t *follow, const char *s, size_t n,
+        cypher_parser_quick_segment_callback_t callback, void *userdata,
+        uint_fast32_t flags)
+{
+    if (follow->start > 0)
+    {
+        memmove(follow->buffer, follow->buffer + follow->start,
+                follow->length - follow->start);
+        follow->length -= follow->start;
+        follow->start = 0;
+    }
+    if (follow->length + n > follow->capacity)
+    {
+        size_t capacity = maxzu(follow->capacity * 2, follow->length + n);
+        char *buffer = realloc(follow->buffer, capacity);
+        if (buffer == NULL)
+        {
+            return -1;
+        }
+        follow->buffer = buffer;
+        follow->capacity = capacity;
+    }
+    if (n > 0)
+    {
+        memcpy(follow->buffer + follow->length, s, n);
+        follow->length += n;
+    }
+
+    size_t len;
+    while ((len = follow_scan(follow, flags)) > 0)
+    {
+        int err = follow_emit(follow, len, callback, userdata, flags);
+        if (err != 0)
+        {
+            return err;
+        }
+        if (flags & CYPHER_PARSE_SINGLE)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+int cypher_quick_follow_finish(cypher_quick_follow_t *follow,
+        cypher_parser_quick_segment_callback_t callback, void *userdata,
+        uint_fast32_t flags)
+{
+    REQUIRE(follow != NULL, -1);
+    REQUIRE(callback != NULL, -1);
+    struct follow_emit_data emit =
+            { .callback = callback, .userdata = userdata,
+              .delivered = false, .result = 0, .next = follow->position };
+    const char *s = follow->buffer + follow->start;
+    size_t n = follow->length - follow->start;
+    struct source_from_buffer_data sourcedata = { .buffer = s, .length = n };
+    int err = parse(source_from_buffer, &sourcedata, follow_emit_segment,
+            &emit, flags, follow->position);
+    if (err)
+    {
+        return err;
+    }
+
+    if (emit.delivered && (emit.result != 0 || (flags & CYPHER_PARSE_SINGLE)))
+    {
+        // parsing was stopped, so retain the input after the last segment
+        follow->start += emit.next.offset - follow->position.offset;
+        follow->position = emit.next;
+        follow_reset(follow);
+        return 0;
+    }
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        char c = s[i];
+        follow->position.offset++;
+        if (c == '\n')
+        {
+            follow->position.line++;
+            follow->position.column = 1;
+        }
+        else if (c != '\r' || i + 1 >= n || s[i + 1] != '\n')
+        {
+            follow->position.column++;
+        }
+    }
+    follow->start = 0;
+    follow->length = 0;
+    follow_reset(follow);
+    return 0;
+}
+
+
+/*
+ * Scan the buffered input, from where the last scan stopped, for the end of
+ * the first directive. This tracks the quick parser grammar closely enough
+ * to find where a statement or command is terminated (by a semicolon or
+ * line end outside of any quote or comment), after which the quick parser
+ * itself is run over exactly that input. A character needing lookahead that
+ * is not yet available is left unscanned until more input arrives.
+ *
+ * Returns the length of the complete directive, or 0 if it is incomplete.
+ */
+size_t follow_scan(cypher_quick_follow_t *follow, uint_fast32_t flags)
+{
+    const char *s = follow->buffer + follow->start;
+    size_t n = follow->length - follow->start;
+    size_t i = follow->scanned;
+
+    while (i < n)
+    {
+        char c = s[i];
+        int next = (i + 1 < n)? (unsigned char)s[i + 1] : -1;
+
+        switch (follow->mode)
+        {
+        case FOLLOW_LINE_COMMENT:
+            ++i;
+            if (c != '\n')
+            {
+                continue;
+            }
+            follow->mode = FOLLOW_NORMAL;
+            if (follow->directive == FOLLOW_COMMAND && !follow->continuation)
+            {
+                goto complete;
+            }
+            follow->continuation = false;
+            continue;
+        case FOLLOW_BLOCK_COMMENT:
+            if (c == '*' && next < 0)
+            {
+                goto incomplete;
+            }
+            if (c == '*' && next == '/')
+            {
+                follow->mode = FOLLOW_NORMAL;
+                ++i;
+            }
+            ++i;
+            continue;
+        case FOLLOW_SINGLE_QUOTED:
+        case FOLLOW_DOUBLE_QUOTED:
+            if (c == '\\' && next < 0)
+            {
+                goto incomplete;
+            }
+            if (c == '\\' && is_escapable(next))
+            {
+                ++i;
+            }
+            else if (c == ((follow->mode == FOLLOW_SINGLE_QUOTED)? '\'':'"'))
+            {
+                follow->mode = FOLLOW_NORMAL;
+            }
+            ++i;
+            continue;
+        case FOLLOW_NORMAL:
+            break;
+        }
+
+        if (c == '/')
+        {
+            if (next < 0)
+            {
+                goto incomplete;
+            }
+            if (next == '/' || next == '*')
+            {
+                follow->mode = (next == '/')?
+                        FOLLOW_LINE_COMMENT : FOLLOW_BLOCK_COMMENT;
+                i += 2;
+                continue;
+            }
+        }
+
+        switch (follow->directive)
+        {
+        case FOLLOW_UNDECIDED:
+            if (c == ' ' || c == '\t' || c == '\n')
+            {
+                ++i;
+                continue;
+            }
+            if (c == '\r' && next < 0)
+            {
+                goto incomplete;
+            }
+            if (c == '\r' && next == '\n')
+            {
+                i += 2;
+                continue;
+            }
+            if (c == ':' && !(flags & (CYPHER_PARSE_ONLY_STATEMENTS |
+                    CYPHER_PARSE_WITH_PARAMETERS)))
+            {
+                follow->directive = FOLLOW_COMMAND;
+                ++i;
+                continue;
+            }
+            // rescan the character as part of a statement
+            follow->directive = FOLLOW_STATEMENT;
+            continue;
+        case FOLLOW_STATEMENT:
+            if (c == '\\' && next < 0)
+            {
+                goto incomplete;
+            }
+            ++i;
+            if (c == ';')
+            {
+                goto complete;
+            }
+            if (c == '\\' && is_escapable(next))
+            {
+                ++i;
+            }
+            else if (c == '\'' || c == '"')
+            {
+                follow->mode = (c == '\'')?
+                        FOLLOW_SINGLE_QUOTED : FOLLOW_DOUBLE_QUOTED;
+            }
+            continue;
+        case FOLLOW_COMMAND:
+            if (c == ' ' || c == '\t')
+            {
+                ++i;
+                continue;
+            }
+            if ((c == '\r' || c == '\\') && next < 0)
+            {
+                goto incomplete;
+            }
+            if (c == '\n' || (c == '\r' && next == '\n'))
+            {
+                i += (c == '\n')? 1 : 2;
+                if (!follow->continuation)
+                {
+                    goto complete;
+                }
+                follow->continuation = false;
+                continue;
+            }
+            follow->continuation = false;
+            ++i;
+            if (c == ';')
+            {
+                goto complete;
+            }
+            if (c == '\\' && (is_escapable(next) || next == ';'))
+            {
+                ++i;
+            }
+            else if (c == '\\')
+            {
+                // a line continuation, if only followed by a line end
+                follow->continuation = true;
+            }
+            else if (c == '\'' || c == '"')
+            {
+                follow->mode = (c == '\'')?
+                        FOLLOW_SINGLE_QUOTED : FOLLOW_DOUBLE_QUOTED;
+            }
+            continue;
+        }
+    }
+
+incomplete:
+    follow->scanned = i;
+    return 0;
+
+complete:
+    follow->scanned = i;
+    return i;
+}
+
+
+int follow_emit_segment(void *data,
+        const cypher_quick_parse_segment_t *segment)
+{
+    struct follow_emit_data *emit = data;
+    emit->delivered = true;
+    emit->next = cypher_quick_parse_segment_get_next(segment);
+    emit->result = emit->callback(emit->userdata, segment);
+    return emit->result;
+}
+
+
+// quick parse the first `n` bytes of unemitted input, containing exactly one
+// complete directive, then mark them emitted
+int follow_emit(cypher_quick_follow_t *follow, size_t n,
+        cypher_parser_quick_segment_callback_t callback, void *userdata,
+        uint_fast32_t flags)
+{
+    struct follow_emit_data emit =
+            { .callback = callback, .userdata = userdata,
+              .delivered = false, .result = 0, .next = follow->position };
+    struct source_from_buffer_data sourcedata =
+            { .buffer = follow->buffer + follow->start, .length = n };
+
+    int err = parse(source_from_buffer, &sourcedata, follow_emit_segment,
+            &emit, flags | CYPHER_PARSE_SINGLE, follow->position);
+    if (!emit.delivered)
+    {
+        return (err < 0)? err : 0;
+    }
+    assert(emit.next.offset == follow->position.offset + n);
+
+    follow->start += n;
+    follow->position = emit.next;
+    follow_reset(follow);
+    return emit.result;
+}
+
+
+void follow_reset(cypher_quick_follow_t *follow)
+{
+    follow->scanned = 0;
+    follow->directive = FOLLOW_UNDECIDED;
+    follow->mode = FOLLOW_NORMAL;
+    follow->continuation = false;
+}
+
+
+bool is_escapable(int c)
+{
+    return c > 0 && strchr("abfnrtv\"'?\\", c) != NULL;
 }
 
 
@@ -96,6 +615,7 @@ int cypher_quick_fparse(FILE *stream,
     struct cypher_input_position position_offset; \
     offsets_t line_start_offsets; \
     bool eof; \
+    bool metrics; \
     int result;
 
 #define YY_MALLOC abort_malloc
@@ -136,7 +656,7 @@ void source(yycontext *yy, char *buf, int *result, int max_size)
 
 int parse(source_cb_t source, void *sourcedata,
         cypher_parser_quick_segment_callback_t callback, void *userdata,
-        uint_fast32_t flags)
+        uint_fast32_t flags, struct cypher_input_position initial_position)
 {
     yycontext yy;
     memset(&yy, 0, sizeof(yycontext));
@@ -145,7 +665,8 @@ int parse(source_cb_t source, void *sourcedata,
     yy.source_data = sourcedata;
     yy.callback = callback;
     yy.callback_data = userdata;
-    yy.position_offset = cypher_input_position_zero;
+    yy.position_offset = initial_position;
+    yy.metrics = cp_metrics_enabled();
     offsets_init(&(yy.line_start_offsets));
     int err = -1;
 
@@ -154,7 +675,8 @@ int parse(source_cb_t source, void *sourcedata,
         goto cleanup;
     }
 
-    yyrule rule = (flags & CYPHER_PARSE_ONLY_STATEMENTS)?
+    yyrule rule = (flags & (CYPHER_PARSE_ONLY_STATEMENTS |
+                CYPHER_PARSE_WITH_PARAMETERS))?
             yy_statement : yy_directive;
 
     for (;;)
@@ -267,6 +789,10 @@ void segment(bool is_statement, yycontext *yy)
           .next = consumed_offset,
           .eof = yy->eof };
 
+    if (yy->metrics)
+    {
+        cp_metrics_quick_segment();
+    }
     yy->result = yy->callback(yy->callback_data, &segment);
     yy->position_offset = consumed_offset;
 }
@@ -0,0 +1,232 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "read_ahead.h"
+#include "util.h"
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAVE_PTHREADS
+#include <pthread.h>
+#endif
+
+
+struct cp_read_ahead
+{
+    FILE *stream;
+    size_t block_size;
+    char *blocks[2];
+    size_t lengths[2];
+    bool filled[2];
+    // the block being consumed, and the offset of the next byte within it
+    unsigned int current;
+    size_t offset;
+    bool stop;
+    int err;
+#ifdef HAVE_PTHREADS
+    bool threaded;
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+#endif
+};
+
+
+static bool fill(cp_read_ahead_t *ra, unsigned int i);
+#ifdef HAVE_PTHREADS
+static void *reader(void *data);
+#endif
+
+
+cp_read_ahead_t *cp_read_ahead(FILE *stream, size_t block_size)
+{
+    REQUIRE(stream != NULL, NULL);
+    REQUIRE(block_size > 0, NULL);
+
+    cp_read_ahead_t *ra = calloc(1, sizeof(cp_read_ahead_t));
+    if (ra == NULL)
+    {
+        return NULL;
+    }
+    ra->stream = stream;
+    ra->block_size = block_size;
+    ra->blocks[0] = malloc(2 * block_size);
+    if (ra->blocks[0] == NULL)
+    {
+        goto failure;
+    }
+    ra->blocks[1] = ra->blocks[0] + block_size;
+
+#ifdef HAVE_PTHREADS
+    if (pthread_mutex_init(&(ra->mutex), NULL))
+    {
+        goto failure;
+    }
+    if (pthread_cond_init(&(ra->cond), NULL))
+    {
+        pthread_mutex_destroy(&(ra->mutex));
+        goto failure;
+    }
+    // if no thread can be started, blocks are read on demand instead
+    ra->threaded = (pthread_create(&(ra->thread), NULL, reader, ra) == 0);
+#endif
+    return ra;
+
+    int errsv;
+failure:
+    errsv = errno;
+    free(ra->blocks[0]);
+    free(ra);
+    errno = errsv;
+    return NULL;
+}
+
+
+void cp_read_ahead_free(cp_read_ahead_t *ra)
+{
+    if (ra == NULL)
+    {
+        return;
+    }
+    int errsv = errno;
+#ifdef HAVE_PTHREADS
+    if (ra->threaded)
+    {
+        pthread_mutex_lock(&(ra->mutex));
+        ra->stop = true;
+        pthread_cond_broadcast(&(ra->cond));
+        pthread_mutex_unlock(&(ra->mutex));
+        pthread_join(ra->thread, NULL);
+    }
+    pthread_cond_destroy(&(ra->cond));
+    pthread_mutex_destroy(&(ra->mutex));
+#endif
+    free(ra->blocks[0]);
+    free(ra);
+    errno = errsv;
+}
+
+
+int cp_read_ahead_error(cp_read_ahead_t *ra)
+{
+#ifdef HAVE_PTHREADS
+    pthread_mutex_lock(&(ra->mutex));
+    int err = ra->err;
+    pthread_mutex_unlock(&(ra->mutex));
+    return err;
+#else
+    return ra->err;
+#endif
+}
+
+
+int cp_read_ahead_source(void *data, char *buf, int n)
+{
+    cp_read_ahead_t *ra = data;
+    assert(n >= 0);
+    unsigned int i = ra->current;
+
+    for (;;)
+    {
+#ifdef HAVE_PTHREADS
+        if (ra->threaded)
+        {
+            pthread_mutex_lock(&(ra->mutex));
+            while (!ra->filled[i])
+            {
+                pthread_cond_wait(&(ra->cond), &(ra->mutex));
+            }
+            pthread_mutex_unlock(&(ra->mutex));
+        }
+        else
+#endif
+        if (!ra->filled[i])
+        {
+            fill(ra, i);
+        }
+
+        if (ra->offset < ra->lengths[i])
+        {
+            break;
+        }
+        // a short block is the last
+        if (ra->lengths[i] < ra->block_size)
+        {
+            return 0;
+        }
+
+        // hand the exhausted block back to be refilled
+#ifdef HAVE_PTHREADS
+        pthread_mutex_lock(&(ra->mutex));
+#endif
+        ra->filled[i] = false;
+#ifdef HAVE_PTHREADS
+        pthread_cond_broadcast(&(ra->cond));
+        pthread_mutex_unlock(&(ra->mutex));
+#endif
+        i = ra->current = i ^ 1;
+        ra->offset = 0;
+    }
+
+    size_t len = minzu(ra->lengths[i] - ra->offset, (size_t)n);
+    memcpy(buf, ra->blocks[i] + ra->offset, len);
+    ra->offset += len;
+    return (int)len;
+}
+
+
+// read block i, returning false if it is the last block of the stream
+bool fill(cp_read_ahead_t *ra, unsigned int i)
+{
+    size_t len = fread(ra->blocks[i], 1, ra->block_size, ra->stream);
+    int err = ferror(ra->stream)? errno : 0;
+#ifdef HAVE_PTHREADS
+    pthread_mutex_lock(&(ra->mutex));
+#endif
+    ra->lengths[i] = len;
+    ra->filled[i] = true;
+    ra->err = err;
+#ifdef HAVE_PTHREADS
+    pthread_cond_broadcast(&(ra->cond));
+    pthread_mutex_unlock(&(ra->mutex));
+#endif
+    return len == ra->block_size;
+}
+
+
+#ifdef HAVE_PTHREADS
+void *reader(void *data)
+{
+    cp_read_ahead_t *ra = data;
+    for (unsigned int i = 0;; i ^= 1)
+    {
+        pthread_mutex_lock(&(ra->mutex));
+        while (ra->filled[i] && !ra->stop)
+        {
+            pthread_cond_wait(&(ra->cond), &(ra->mutex));
+        }
+        bool stop = ra->stop;
+        pthread_mutex_unlock(&(ra->mutex));
+        if (stop || !fill(ra, i))
+        {
+            return NULL;
+        }
+    }
+}
+#endif
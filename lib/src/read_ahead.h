@@ -0,0 +1,54 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CYPHER_PARSER_READ_AHEAD_H
+#define CYPHER_PARSER_READ_AHEAD_H
+
+#include <stdio.h>
+
+
+typedef struct cp_read_ahead cp_read_ahead_t;
+
+
+/*
+ * Start reading a stream ahead of the parser, into two blocks of the given
+ * size. One block is filled by a background thread while the other is
+ * consumed via `cp_read_ahead_source`, and blocks are exchanged between the
+ * threads without copying. Where threads are unavailable, blocks are read
+ * synchronously on demand.
+ */
+cp_read_ahead_t *cp_read_ahead(FILE *stream, size_t block_size);
+
+/*
+ * Copy up to `n` bytes of input into `buf`, returning the number of bytes
+ * copied, or 0 at the end of the stream. Suitable for use as a parser source.
+ */
+int cp_read_ahead_source(void *data, char *buf, int n);
+
+/*
+ * Return the error (an errno value) that ended reading of the stream, or 0
+ * if the end of the stream was reached without error.
+ */
+int cp_read_ahead_error(cp_read_ahead_t *ra);
+
+/*
+ * Stop reading and release all resources. Any input read ahead of the
+ * parser is discarded, so the stream position is left unspecified.
+ */
+void cp_read_ahead_free(cp_read_ahead_t *ra);
+
+
+#endif/*CYPHER_PARSER_READ_AHEAD_H*/
@@ -0,0 +1,179 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "cypher-parser.h"
+#include "reclaim.h"
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#ifdef HAVE_PTHREADS
+#include <pthread.h>
+#endif
+
+
+// objects awaiting reclamation, most recently deferred first
+static struct cp_reclaim_link *pending = NULL;
+#ifdef HAVE_PTHREADS
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t cond = PTHREAD_COND_INITIALIZER;
+static pthread_t thread;
+static bool running = false;
+static bool stop = false;
+#endif
+
+
+static struct cp_reclaim_link *take_pending(void);
+static unsigned int reclaim_all(struct cp_reclaim_link *link);
+#ifdef HAVE_PTHREADS
+static void *reclaimer(void *data);
+#endif
+
+
+void cp_reclaim_defer(struct cp_reclaim_link *link,
+        void (*reclaim)(struct cp_reclaim_link *link))
+{
+    assert(link != NULL && reclaim != NULL);
+    link->reclaim = reclaim;
+#ifdef HAVE_PTHREADS
+    pthread_mutex_lock(&mutex);
+    link->next = pending;
+    pending = link;
+    if (running && link->next == NULL)
+    {
+        pthread_cond_signal(&cond);
+    }
+    pthread_mutex_unlock(&mutex);
+#else
+    link->next = pending;
+    pending = link;
+#endif
+}
+
+
+unsigned int cypher_parser_reclaim(void)
+{
+    return reclaim_all(take_pending());
+}
+
+
+int cypher_parser_start_reclaimer(void)
+{
+#ifdef HAVE_PTHREADS
+    pthread_mutex_lock(&mutex);
+    if (running)
+    {
+        pthread_mutex_unlock(&mutex);
+        return 0;
+    }
+    stop = false;
+    int err = pthread_create(&thread, NULL, reclaimer, NULL);
+    if (err != 0)
+    {
+        pthread_mutex_unlock(&mutex);
+        errno = err;
+        return -1;
+    }
+    running = true;
+    pthread_mutex_unlock(&mutex);
+    return 0;
+#else
+    errno = ENOTSUP;
+    return -1;
+#endif
+}
+
+
+void cypher_parser_stop_reclaimer(void)
+{
+#ifdef HAVE_PTHREADS
+    pthread_mutex_lock(&mutex);
+    if (!running)
+    {
+        pthread_mutex_unlock(&mutex);
+        return;
+    }
+    stop = true;
+    pthread_cond_signal(&cond);
+    pthread_mutex_unlock(&mutex);
+
+    int errsv = errno;
+    pthread_join(thread, NULL);
+    errno = errsv;
+
+    pthread_mutex_lock(&mutex);
+    running = false;
+    pthread_mutex_unlock(&mutex);
+#endif
+}
+
+
+struct cp_reclaim_link *take_pending(void)
+{
+#ifdef HAVE_PTHREADS
+    pthread_mutex_lock(&mutex);
+    struct cp_reclaim_link *link = pending;
+    pending = NULL;
+    pthread_mutex_unlock(&mutex);
+    return link;
+#else
+    struct cp_reclaim_link *link = pending;
+    pending = NULL;
+    return link;
+#endif
+}
+
+
+unsigned int reclaim_all(struct cp_reclaim_link *link)
+{
+    unsigned int n = 0;
+    while (link != NULL)
+    {
+        struct cp_reclaim_link *next = link->next;
+        link->reclaim(link);
+        link = next;
+        ++n;
+    }
+    return n;
+}
+
+
+#ifdef HAVE_PTHREADS
+void *reclaimer(void *data)
+{
+    pthread_mutex_lock(&mutex);
+    for (;;)
+    {
+        while (pending == NULL && !stop)
+        {
+            pthread_cond_wait(&cond, &mutex);
+        }
+        // anything deferred before the stop request is still reclaimed
+        struct cp_reclaim_link *link = pending;
+        pending = NULL;
+        if (link == NULL)
+        {
+            break;
+        }
+        pthread_mutex_unlock(&mutex);
+        reclaim_all(link);
+        pthread_mutex_lock(&mutex);
+    }
+    pthread_mutex_unlock(&mutex);
+    return NULL;
+}
+#endif
@@ -0,0 +1,41 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CYPHER_PARSER_RECLAIM_H
+#define CYPHER_PARSER_RECLAIM_H
+
+
+/*
+ * A link embedded in an object whose release has been deferred. When the
+ * object is reclaimed, `reclaim` is invoked with the link, and must free the
+ * object containing it.
+ */
+struct cp_reclaim_link
+{
+    struct cp_reclaim_link *next;
+    void (*reclaim)(struct cp_reclaim_link *link);
+};
+
+
+/*
+ * Queue an object for reclamation, either by the reclaimer thread (if
+ * running) or by the next call to `cypher_parser_reclaim`.
+ */
+void cp_reclaim_defer(struct cp_reclaim_link *link,
+        void (*reclaim)(struct cp_reclaim_link *link));
+
+
+#endif/*CYPHER_PARSER_RECLAIM_H*/
@@ -16,14 +16,22 @@
  */
 #include "../../config.h"
 #include "result.h"
+#include "annotation.h"
 #include "ast.h"
 #include "segment.h"
 #include "util.h"
 #include <assert.h>
 
 
+static void reclaim_result(struct cp_reclaim_link *link);
+
+
 unsigned int cypher_parse_result_nroots(const cypher_parse_result_t *result)
 {
+    if (result->lazy != NULL)
+    {
+        return result->lazy->nroots;
+    }
     return result->nroots;
 }
 
@@ -31,6 +39,10 @@ unsigned int cypher_parse_result_nroots(const cypher_parse_result_t *result)
 const cypher_astnode_t *cypher_parse_result_get_root(
         const cypher_parse_result_t *result, unsigned int index)
 {
+    if (result->lazy != NULL)
+    {
+        return cp_lazy_result_get_root(result->lazy, index);
+    }
     if (index >= result->nroots)
     {
         return NULL;
@@ -45,9 +57,29 @@ unsigned int cypher_parse_result_nnodes(const cypher_parse_result_t *result)
 }
 
 
+const cypher_astnode_t * const *cypher_parse_result_nodes_of_type(
+        const cypher_parse_result_t *result, cypher_astnode_type_t type,
+        unsigned int *n)
+{
+    REQUIRE(n != NULL, NULL);
+    *n = 0;
+    REQUIRE(type < cp_ast_ntypes(), NULL);
+    // segments of a lazy result are materialized individually
+    if (result->lazy != NULL)
+    {
+        return NULL;
+    }
+    return cp_node_index_get(&(result->index), type, n);
+}
+
+
 unsigned int cypher_parse_result_ndirectives(
         const cypher_parse_result_t *result)
 {
+    if (result->lazy != NULL)
+    {
+        return result->lazy->ndirectives;
+    }
     return result->ndirectives;
 }
 
@@ -55,6 +87,10 @@ unsigned int cypher_parse_result_ndirectives(
 const cypher_astnode_t *cypher_parse_result_get_directive(
                 const cypher_parse_result_t *result, unsigned int index)
 {
+    if (result->lazy != NULL)
+    {
+        return cp_lazy_result_get_directive(result->lazy, index);
+    }
     if (index >= result->ndirectives)
     {
         return NULL;
@@ -89,26 +125,14 @@ bool cypher_parse_result_eof(const cypher_parse_result_t *result)
 int cp_result_merge_segment(cypher_parse_result_t *result,
         cypher_parse_segment_t *segment)
 {
-    if (!result->eof && segment->eof &&
-            (segment->directive != NULL || segment->nerrors > 0))
+    if (cp_result_merge_segment_errors(result, segment))
     {
-        result->eof = true;
+        return -1;
     }
 
-    if (segment->nerrors > 0)
+    if (cp_node_index_append(&(result->index), &(segment->index)))
     {
-        unsigned int n = result->nerrors + segment->nerrors;
-        cypher_parse_error_t *errors = realloc(result->errors,
-                n * sizeof(cypher_parse_error_t));
-        if (errors == NULL)
-        {
-            return -1;
-        }
-        memcpy(errors + result->nerrors, segment->errors,
-                segment->nerrors * sizeof(cypher_parse_error_t));
-        segment->nerrors = 0;
-        result->errors = errors;
-        result->nerrors = n;
+        return -1;
     }
 
     if (segment->nroots > 0)
@@ -153,16 +177,121 @@ int cp_result_merge_segment(cypher_parse_result_t *result,
 }
 
 
+int cp_result_merge_segment_errors(cypher_parse_result_t *result,
+        cypher_parse_segment_t *segment)
+{
+    if (!result->eof && segment->eof &&
+            (segment->directive != NULL || segment->nerrors > 0))
+    {
+        result->eof = true;
+    }
+
+    if (segment->nerrors > 0)
+    {
+        unsigned int n = result->nerrors + segment->nerrors;
+        cypher_parse_error_t *errors = realloc(result->errors,
+                n * sizeof(cypher_parse_error_t));
+        if (errors == NULL)
+        {
+            return -1;
+        }
+        memcpy(errors + result->nerrors, segment->errors,
+                segment->nerrors * sizeof(cypher_parse_error_t));
+        segment->nerrors = 0;
+        result->errors = errors;
+        result->nerrors = n;
+    }
+
+    return 0;
+}
+
+
 int cypher_parse_result_fprint_ast(const cypher_parse_result_t *result,
         FILE *stream, unsigned int width,
         const struct cypher_parser_colorization *colorization,
         uint_fast32_t flags)
 {
+    if (result->lazy != NULL)
+    {
+        return cp_lazy_result_fprint_ast(result->lazy, stream, width,
+                colorization, flags);
+    }
     return cypher_ast_fprintv(result->roots, result->nroots,
             stream, width, colorization, flags);
 }
 
 
+int cypher_parse_result_compact(cypher_parse_result_t *result)
+{
+    REQUIRE(result != NULL, -1);
+    // segments of a lazy result are materialized and released on demand
+    if (result->lazy != NULL || result->nroots == 0)
+    {
+        return 0;
+    }
+
+    cypher_astnode_t **roots = calloc(result->nroots,
+            sizeof(cypher_astnode_t *));
+    if (roots == NULL)
+    {
+        return -1;
+    }
+    size_t size;
+    void *buffer = cp_ast_vcompact(result->roots, result->nroots, roots,
+            &size);
+    if (buffer == NULL)
+    {
+        free(roots);
+        return -1;
+    }
+
+    // the compacted nodes are indexed in the same order as the originals,
+    // if the originals were indexed at all
+    cp_node_index_t index;
+    cp_node_index_init(&index);
+    for (unsigned int i = 0; result->index.lists != NULL && i < result->nroots;
+            ++i)
+    {
+        if (cp_node_index_add_tree(&index, roots[i]))
+        {
+            int errsv = errno;
+            cp_node_index_cleanup(&index);
+            cp_ast_vfree_compacted(roots, result->nroots, buffer, size);
+            free(roots);
+            errno = errsv;
+            return -1;
+        }
+    }
+    cp_node_index_cleanup(&(result->index));
+    result->index = index;
+
+    // directives are always roots, and keep their relative order
+    for (unsigned int i = 0, j = 0; i < result->ndirectives; ++i)
+    {
+        for (; j < result->nroots && result->roots[j] != result->directives[i];
+                ++j)
+            ;
+        assert(j < result->nroots);
+        result->directives[i] = roots[j];
+    }
+
+    if (result->compact_buffer != NULL)
+    {
+        cp_ast_vfree_compacted(result->roots, result->nroots,
+                result->compact_buffer, result->compact_size);
+    }
+    else
+    {
+        cypher_ast_vfree(result->roots, result->nroots);
+    }
+    free(result->roots);
+    result->roots = roots;
+    result->compact_buffer = buffer;
+    result->compact_size = size;
+    return 0;
+}
+
+
 size_t cypher_parse_error_context_offset(const cypher_parse_error_t *error)
 {
     REQUIRE(error != NULL, 0);
@@ -179,8 +308,45 @@ void cypher_parse_result_free(cypher_parse_result_t *result)
 
     cp_errors_vcleanup(result->errors, result->nerrors);
     free(result->errors);
-    cypher_ast_vfree(result->roots, result->nroots);
+    if (result->compact_buffer != NULL)
+    {
+        cp_ast_vfree_compacted(result->roots, result->nroots,
+                result->compact_buffer, result->compact_size);
+    }
+    else
+    {
+        cypher_ast_vfree(result->roots, result->nroots);
+    }
     free(result->roots);
+    cp_node_index_cleanup(&(result->index));
     free(result->directives);
+    cp_lazy_result_free(result->lazy);
     free(result);
 }
+
+
+void cypher_parse_result_free_deferred(cypher_parse_result_t *result)
+{
+    if (result == NULL)
+    {
+        return;
+    }
+    // annotation contexts are owned by the caller, so release handlers are
+    // invoked now rather than on whichever thread reclaims the result
+    if (cp_nannotations() > 0)
+    {
+        cp_ast_vrelease_annotations(result->roots, result->nroots);
+    }
+    if (result->lazy != NULL)
+    {
+        cp_lazy_result_release_deferred(result->lazy);
+    }
+    cp_reclaim_defer(&(result->reclaim), reclaim_result);
+}
+
+
+void reclaim_result(struct cp_reclaim_link *link)
+{
+    cypher_parse_result_free(container_of(link, cypher_parse_result_t,
+                reclaim));
+}
@@ -19,6 +19,9 @@
 
 #include "cypher-parser.h"
 #include "errors.h"
+#include "lazy_result.h"
+#include "node_index.h"
+#include "reclaim.h"
 
 
 struct cypher_parse_result
@@ -29,17 +32,29 @@ struct cypher_parse_result
     cypher_astnode_t **roots;
     unsigned int nroots;
     unsigned int nnodes;
+    cp_node_index_t index;
 
     const cypher_astnode_t **directives;
     unsigned int ndirectives;
     unsigned int directives_cap;
 
     bool eof;
+
+    void *compact_buffer;
+    size_t compact_size;
+
+    // when set, segments are recorded and only parsed on access
+    struct cp_lazy_result *lazy;
+
+    struct cp_reclaim_link reclaim;
 };
 
 
 int cp_result_merge_segment(cypher_parse_result_t *result,
         cypher_parse_segment_t *segment);
 
+int cp_result_merge_segment_errors(cypher_parse_result_t *result,
+        cypher_parse_segment_t *segment);
+
 
 #endif/*CYPHER_PARSER_RESULT_H*/
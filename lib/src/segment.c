@@ -16,15 +16,23 @@
  */
 #include "../../config.h"
 #include "segment.h"
+#include "annotation.h"
 #include "ast.h"
+#include "astnode.h"
 #include "util.h"
 #include <assert.h>
 
 
+static int index_nodes(cypher_parse_segment_t *segment,
+        cypher_astnode_t *node, unsigned int *ordinal, bool index);
+static void segment_free(cypher_parse_segment_t *segment);
+static void reclaim_segment(struct cp_reclaim_link *link);
+
+
 cypher_parse_segment_t *cypher_parse_segment(unsigned int ordinal,
         struct cypher_input_range range, cypher_parse_error_t *errors,
         unsigned int nerrors, cypher_astnode_t **roots, unsigned int nroots,
-        const cypher_astnode_t *directive, bool eof)
+        const cypher_astnode_t *directive, bool eof, bool index)
 {
     struct cypher_parse_segment *segment = calloc(1,
             sizeof(cypher_parse_segment_t));
@@ -35,6 +43,7 @@ cypher_parse_segment_t *cypher_parse_segment(unsigned int ordinal,
 
     segment->refcount = 1;
     segment->range = range;
+    cp_node_index_init(&(segment->index));
     if (nerrors > 0)
     {
         segment->errors = mdup(errors, nerrors * sizeof(cypher_parse_error_t));
@@ -59,7 +68,10 @@ cypher_parse_segment_t *cypher_parse_segment(unsigned int ordinal,
     unsigned int initial_ordinal = ordinal;
     for (unsigned int i = 0; i < nroots; ++i)
     {
-        ordinal = cypher_ast_set_ordinals(roots[i], ordinal);
+        if (index_nodes(segment, roots[i], &ordinal, index))
+        {
+            goto failure;
+        }
     }
     segment->nnodes = ordinal - initial_ordinal;
 
@@ -72,6 +84,7 @@ failure:
     {
         free(segment->errors);
         free(segment->roots);
+        cp_node_index_cleanup(&(segment->index));
     }
     free(segment);
     errno = errsv;
@@ -79,6 +92,31 @@ failure:
 }
 
 
+// assign ordinals in pre-order, and when requested, index each node by type
+// as it is visited
+int index_nodes(cypher_parse_segment_t *segment, cypher_astnode_t *node,
+        unsigned int *ordinal, bool index)
+{
+    if (node == NULL)
+    {
+        return 0;
+    }
+    node->ordinal = (*ordinal)++;
+    if (index && cp_node_index_add(&(segment->index), node))
+    {
+        return -1;
+    }
+    for (unsigned int i = 0; i < node->nchildren; ++i)
+    {
+        if (index_nodes(segment, node->children[i], ordinal, index))
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+
 void cypher_parse_segment_retain(cypher_parse_segment_t *segment)
 {
     assert(segment != NULL);
@@ -98,11 +136,44 @@ void cypher_parse_segment_release(cypher_parse_segment_t* segment)
     {
         return;
     }
+    segment_free(segment);
+}
+
 
+void cypher_parse_segment_release_deferred(cypher_parse_segment_t *segment)
+{
+    if (segment == NULL)
+    {
+        return;
+    }
+    assert(segment->refcount > 0);
+    if (--(segment->refcount) > 0)
+    {
+        return;
+    }
+    // annotation contexts are owned by the caller, so release handlers are
+    // invoked now rather than on whichever thread reclaims the segment
+    if (cp_nannotations() > 0)
+    {
+        cp_ast_vrelease_annotations(segment->roots, segment->nroots);
+    }
+    cp_reclaim_defer(&(segment->reclaim), reclaim_segment);
+}
+
+
+void reclaim_segment(struct cp_reclaim_link *link)
+{
+    segment_free(container_of(link, cypher_parse_segment_t, reclaim));
+}
+
+
+void segment_free(cypher_parse_segment_t *segment)
+{
     cp_errors_vcleanup(segment->errors, segment->nerrors);
     free(segment->errors);
     cypher_ast_vfree(segment->roots, segment->nroots);
     free(segment->roots);
+    cp_node_index_cleanup(&(segment->index));
 
     memset(segment, 0, sizeof(cypher_parse_segment_t));
     free(segment);
@@ -156,6 +227,17 @@ unsigned int cypher_parse_segment_nnodes(const cypher_parse_segment_t *segment)
 }
 
 
+const cypher_astnode_t * const *cypher_parse_segment_nodes_of_type(
+        const cypher_parse_segment_t *segment, cypher_astnode_type_t type,
+        unsigned int *n)
+{
+    REQUIRE(n != NULL, NULL);
+    *n = 0;
+    REQUIRE(type < cp_ast_ntypes(), NULL);
+    return cp_node_index_get(&(segment->index), type, n);
+}
+
+
 const cypher_astnode_t *cypher_parse_segment_get_directive(
         const cypher_parse_segment_t *segment)
 {
@@ -19,6 +19,8 @@
 
 #include "cypher-parser.h"
 #include "errors.h"
+#include "node_index.h"
+#include "reclaim.h"
 
 
 struct cypher_parse_segment
@@ -33,16 +35,19 @@ struct cypher_parse_segment
     cypher_astnode_t **roots;
     unsigned int nroots;
     unsigned int nnodes;
+    cp_node_index_t index;
 
     const cypher_astnode_t *directive;
     bool eof;
+
+    struct cp_reclaim_link reclaim;
 };
 
 
 cypher_parse_segment_t *cypher_parse_segment(unsigned int ordinal,
         struct cypher_input_range range, cypher_parse_error_t *errors,
         unsigned int nerrors, cypher_astnode_t **roots, unsigned int nroots,
-        const cypher_astnode_t *directive, bool eof);
+        const cypher_astnode_t *directive, bool eof, bool index);
 
 
 #endif/*CYPHER_PARSER_SEGMENT_H*/
@@ -0,0 +1,226 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "atomics.h"
+#include "slowlog.h"
+#include "util.h"
+#include <assert.h>
+#include <ctype.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <time.h>
+
+
+/*
+ * Each slot of the ring holds a sequence word, which is 2(n+1) once entry n
+ * has been written to the slot, and odd whilst a writer holds the slot. A
+ * writer claims a slot with a single compare-and-swap, dropping its entry if
+ * the slot is busy or already holds a newer entry. Readers copy the entry
+ * and discard the copy if the sequence word changed whilst copying.
+ */
+struct slot
+{
+    atomic_uint_fast64_t seq;
+    struct cypher_slowlog_entry entry;
+};
+
+struct cypher_slowlog
+{
+    unsigned int capacity;
+    uint64_t duration_threshold;
+    unsigned int nodes_threshold;
+    atomic_uint_fast64_t next;
+    atomic_uint_fast64_t dropped;
+    struct slot *slots;
+};
+
+
+cypher_slowlog_t *cypher_slowlog_new(unsigned int capacity,
+        uint64_t duration_threshold, unsigned int nodes_threshold)
+{
+    REQUIRE(capacity > 0, NULL);
+
+    cypher_slowlog_t *slowlog = calloc(1, sizeof(cypher_slowlog_t));
+    if (slowlog == NULL)
+    {
+        return NULL;
+    }
+    slowlog->slots = calloc(capacity, sizeof(struct slot));
+    if (slowlog->slots == NULL)
+    {
+        free(slowlog);
+        return NULL;
+    }
+    slowlog->capacity = capacity;
+    slowlog->duration_threshold =
+            (duration_threshold > 0)? duration_threshold : UINT64_MAX;
+    slowlog->nodes_threshold =
+            (nodes_threshold > 0)? nodes_threshold : UINT_MAX;
+    atomic_init(&(slowlog->next), 0);
+    atomic_init(&(slowlog->dropped), 0);
+    for (unsigned int i = 0; i < capacity; ++i)
+    {
+        atomic_init(&(slowlog->slots[i].seq), 0);
+    }
+    return slowlog;
+}
+
+
+void cypher_slowlog_free(cypher_slowlog_t *slowlog)
+{
+    if (slowlog == NULL)
+    {
+        return;
+    }
+    free(slowlog->slots);
+    free(slowlog);
+}
+
+
+uint64_t cp_slowlog_now(void)
+{
+    struct timespec ts;
+#ifdef WIN32
+    timespec_get(&ts, TIME_UTC);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+
+bool cp_slowlog_exceeds(const cypher_slowlog_t *slowlog, uint64_t duration,
+        unsigned int nnodes)
+{
+    return duration >= slowlog->duration_threshold ||
+        nnodes >= slowlog->nodes_threshold;
+}
+
+
+void cp_slowlog_record(cypher_slowlog_t *slowlog,
+        const struct cypher_slowlog_entry *entry)
+{
+    uint64_t n = atomic_fetch_add_explicit(&(slowlog->next), 1,
+            memory_order_relaxed);
+    struct slot *slot = &(slowlog->slots[n % slowlog->capacity]);
+
+    uint_fast64_t seq = atomic_load_explicit(&(slot->seq),
+            memory_order_relaxed);
+    if ((seq & 1) || seq > 2 * n ||
+        !atomic_compare_exchange_strong_explicit(&(slot->seq), &seq,
+                2 * n + 1, memory_order_acquire, memory_order_relaxed))
+    {
+        atomic_fetch_add_explicit(&(slowlog->dropped), 1,
+                memory_order_relaxed);
+        return;
+    }
+    atomic_thread_fence(memory_order_release);
+
+    slot->entry = *entry;
+    slot->entry.sequence = n;
+
+    atomic_store_explicit(&(slot->seq), 2 * n + 2, memory_order_release);
+}
+
+
+unsigned int cypher_slowlog_get_entries(const cypher_slowlog_t *slowlog,
+        struct cypher_slowlog_entry *entries, unsigned int n)
+{
+    REQUIRE(slowlog != NULL, 0);
+    REQUIRE(n == 0 || entries != NULL, 0);
+
+    cypher_slowlog_t *log = (cypher_slowlog_t *)(uintptr_t)slowlog;
+    uint64_t end = atomic_load_explicit(&(log->next), memory_order_acquire);
+    uint64_t limit = minu(n, log->capacity);
+    uint64_t start = (end > limit)? end - limit : 0;
+
+    unsigned int count = 0;
+    for (uint64_t i = start; i < end; ++i)
+    {
+        struct slot *slot = &(log->slots[i % log->capacity]);
+        uint_fast64_t seq = atomic_load_explicit(&(slot->seq),
+                memory_order_acquire);
+        if (seq != 2 * i + 2)
+        {
+            // not yet written, dropped or already overwritten
+            continue;
+        }
+        entries[count] = slot->entry;
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&(slot->seq), memory_order_relaxed) == seq)
+        {
+            ++count;
+        }
+    }
+    return count;
+}
+
+
+uint64_t cypher_slowlog_ndropped(const cypher_slowlog_t *slowlog)
+{
+    REQUIRE(slowlog != NULL, 0);
+    cypher_slowlog_t *log = (cypher_slowlog_t *)(uintptr_t)slowlog;
+    return atomic_load_explicit(&(log->dropped), memory_order_relaxed);
+}
+
+
+int cypher_slowlog_fprint(const cypher_slowlog_t *slowlog, FILE *stream)
+{
+    REQUIRE(slowlog != NULL, -1);
+    REQUIRE(stream != NULL, -1);
+
+    struct cypher_slowlog_entry *entries =
+            calloc(slowlog->capacity, sizeof(struct cypher_slowlog_entry));
+    if (entries == NULL)
+    {
+        return -1;
+    }
+    unsigned int n = cypher_slowlog_get_entries(slowlog, entries,
+            slowlog->capacity);
+
+    int result = -1;
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        struct cypher_slowlog_entry *entry = &(entries[i]);
+        for (unsigned int j = 0; j < entry->prefix_length; ++j)
+        {
+            if (iscntrl((unsigned char)entry->prefix[j]))
+            {
+                entry->prefix[j] = ' ';
+            }
+        }
+        size_t length = entry->range.end.offset - entry->range.start.offset;
+        if (fprintf(stream, "#%" PRIu64 " @%u:%u %" PRIu64 ".%03" PRIu64
+                    "ms %zu bytes %u nodes %lu allocations %u errors: %s%s\n",
+                    entry->sequence, entry->range.start.line,
+                    entry->range.start.column, entry->duration / 1000000,
+                    (entry->duration / 1000) % 1000, length, entry->nnodes,
+                    entry->nallocations, entry->nerrors, entry->prefix,
+                    (entry->prefix_length < length)? "..." : "") < 0)
+        {
+            goto cleanup;
+        }
+    }
+    result = 0;
+
+    int errsv;
+cleanup:
+    errsv = errno;
+    free(entries);
+    errno = errsv;
+    return result;
+}
@@ -0,0 +1,42 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CYPHER_PARSER_SLOWLOG_H
+#define CYPHER_PARSER_SLOWLOG_H
+
+#include "cypher-parser.h"
+
+
+/*
+ * Return the current time, in nanoseconds, from a clock suitable for
+ * measuring durations.
+ */
+uint64_t cp_slowlog_now(void);
+
+/*
+ * Check if a parse of the given duration and size should be recorded.
+ */
+bool cp_slowlog_exceeds(const cypher_slowlog_t *slowlog, uint64_t duration,
+        unsigned int nnodes);
+
+/*
+ * Record an entry. The sequence number is assigned by the slowlog.
+ */
+void cp_slowlog_record(cypher_slowlog_t *slowlog,
+        const struct cypher_slowlog_entry *entry);
+
+
+#endif/*CYPHER_PARSER_SLOWLOG_H*/
@@ -0,0 +1,35 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CYPHER_PARSER_UNICODE_H
+#define CYPHER_PARSER_UNICODE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+/*
+ * Return true if the code point may begin a symbolic name (XID_Start).
+ */
+bool cp_unicode_is_id_start(uint32_t c);
+
+/*
+ * Return true if the code point may continue a symbolic name (XID_Continue).
+ */
+bool cp_unicode_is_id_part(uint32_t c);
+
+
+#endif/*CYPHER_PARSER_UNICODE_H*/
@@ -0,0 +1,255 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "utf8.h"
+#include "util.h"
+#include <assert.h>
+#include <string.h>
+
+#define WORD_HIGH_BITS 0x8080808080808080ull
+#define WORD_LOW_BITS 0x7f7f7f7f7f7f7f7full
+#define WORD_NEWLINES 0x0a0a0a0a0a0a0a0aull
+
+
+static bool lead_byte(unsigned char b, unsigned int *need, unsigned char *lo,
+        unsigned char *hi);
+static void advance(struct cypher_input_position *position, unsigned char b);
+static int queue_error(struct cp_utf8_validator *v,
+        struct cypher_input_position position, unsigned char b);
+
+
+void cp_utf8_validator_init(struct cp_utf8_validator *v,
+        struct cypher_input_position position)
+{
+    memset(v, 0, sizeof(struct cp_utf8_validator));
+    v->position = position;
+    cp_utf8_errors_init(&(v->errors));
+}
+
+
+void cp_utf8_validator_cleanup(struct cp_utf8_validator *v)
+{
+    cp_utf8_errors_cleanup(&(v->errors));
+}
+
+
+// true if any byte of the word is zero (exactly, with no false positives)
+static inline bool has_zero_byte(uint64_t w)
+{
+    return (~(((w & WORD_LOW_BITS) + WORD_LOW_BITS) | w) & WORD_HIGH_BITS)
+            != 0;
+}
+
+
+int cp_utf8_validate(struct cp_utf8_validator *v, const char *buf, size_t n)
+{
+    const unsigned char *s = (const unsigned char *)buf;
+    const unsigned char *end = s + n;
+
+    while (s < end)
+    {
+        if (v->need == 0)
+        {
+            // skip a word at a time while it is all ASCII, with no newlines
+            // that would change the line
+            const unsigned char *start = s;
+            for (; end - s >= 8; s += 8)
+            {
+                uint64_t w;
+                memcpy(&w, s, sizeof(w));
+                if ((w & WORD_HIGH_BITS) || has_zero_byte(w ^ WORD_NEWLINES))
+                {
+                    break;
+                }
+            }
+            v->position.column += s - start;
+            v->position.offset += s - start;
+            if (s == end)
+            {
+                break;
+            }
+        }
+
+        unsigned char b = *s;
+        if (v->need > 0)
+        {
+            if (b < v->lo || b > v->hi)
+            {
+                // truncated sequence - the byte is then examined afresh
+                if (queue_error(v, v->lead_position, v->lead))
+                {
+                    return -1;
+                }
+                v->need = 0;
+                continue;
+            }
+            --(v->need);
+            v->lo = 0x80;
+            v->hi = 0xBF;
+        }
+        else if (b >= 0x80)
+        {
+            if (lead_byte(b, &(v->need), &(v->lo), &(v->hi)))
+            {
+                v->lead_position = v->position;
+                v->lead = b;
+            }
+            else if (queue_error(v, v->position, b))
+            {
+                return -1;
+            }
+        }
+        advance(&(v->position), b);
+        ++s;
+    }
+    return 0;
+}
+
+
+int cp_utf8_validate_end(struct cp_utf8_validator *v)
+{
+    if (v->need == 0)
+    {
+        return 0;
+    }
+    v->need = 0;
+    return queue_error(v, v->lead_position, v->lead);
+}
+
+
+const struct cp_utf8_error *cp_utf8_peek_error(struct cp_utf8_validator *v)
+{
+    if (v->next_error >= cp_utf8_errors_size(&(v->errors)))
+    {
+        return NULL;
+    }
+    return cp_utf8_errors_elements(&(v->errors)) + v->next_error;
+}
+
+
+void cp_utf8_take_error(struct cp_utf8_validator *v)
+{
+    assert(v->next_error < cp_utf8_errors_size(&(v->errors)));
+    if (++(v->next_error) == cp_utf8_errors_size(&(v->errors)))
+    {
+        cp_utf8_errors_clear(&(v->errors));
+        v->next_error = 0;
+    }
+}
+
+
+int cp_utf8_decode(const unsigned char *s, size_t n, uint32_t *c)
+{
+    assert(n > 0);
+    if (s[0] < 0x80)
+    {
+        *c = s[0];
+        return 1;
+    }
+    unsigned int need;
+    unsigned char lo, hi;
+    if (!lead_byte(s[0], &need, &lo, &hi))
+    {
+        return -1;
+    }
+    uint32_t value = s[0] & (0x3F >> need);
+    for (unsigned int i = 1; i <= need; ++i)
+    {
+        if (i >= n)
+        {
+            return 0;
+        }
+        if (s[i] < lo || s[i] > hi)
+        {
+            return -1;
+        }
+        value = (value << 6) | (s[i] & 0x3F);
+        lo = 0x80;
+        hi = 0xBF;
+    }
+    *c = value;
+    return need + 1;
+}
+
+
+/*
+ * Determine the number of continuation bytes following a lead byte, and the
+ * range of the first, which excludes overlong encodings, surrogates and
+ * code points beyond U+10FFFF (see Unicode Table 3-7).
+ */
+bool lead_byte(unsigned char b, unsigned int *need, unsigned char *lo,
+        unsigned char *hi)
+{
+    *lo = 0x80;
+    *hi = 0xBF;
+    if (b >= 0xC2 && b <= 0xDF)
+    {
+        *need = 1;
+    }
+    else if (b >= 0xE0 && b <= 0xEF)
+    {
+        *need = 2;
+        if (b == 0xE0)
+        {
+            *lo = 0xA0;
+        }
+        else if (b == 0xED)
+        {
+            *hi = 0x9F;
+        }
+    }
+    else if (b >= 0xF0 && b <= 0xF4)
+    {
+        *need = 3;
+        if (b == 0xF0)
+        {
+            *lo = 0x90;
+        }
+        else if (b == 0xF4)
+        {
+            *hi = 0x8F;
+        }
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+
+void advance(struct cypher_input_position *position, unsigned char b)
+{
+    if (b == '\n')
+    {
+        ++(position->line);
+        position->column = 1;
+    }
+    else
+    {
+        ++(position->column);
+    }
+    ++(position->offset);
+}
+
+
+int queue_error(struct cp_utf8_validator *v,
+        struct cypher_input_position position, unsigned char b)
+{
+    struct cp_utf8_error error = { .position = position, .byte = b };
+    return cp_utf8_errors_push(&(v->errors), error);
+}
@@ -0,0 +1,89 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CYPHER_PARSER_UTF8_H
+#define CYPHER_PARSER_UTF8_H
+
+#include "cypher-parser.h"
+#include "vector.h"
+#include <stdint.h>
+
+
+struct cp_utf8_error
+{
+    struct cypher_input_position position;
+    unsigned char byte;
+};
+
+DECLARE_VECTOR(cp_utf8_errors, struct cp_utf8_error,
+        ((struct cp_utf8_error){ .byte = 0 }));
+
+
+/*
+ * Incrementally validates input as UTF-8, as it is read in chunks. The
+ * position of every invalid or truncated sequence is queued, along with
+ * its first byte, until taken by `cp_utf8_take_error`.
+ */
+struct cp_utf8_validator
+{
+    struct cypher_input_position position; // of the next byte
+    // continuation bytes still required, and the range of the next
+    unsigned int need;
+    unsigned char lo;
+    unsigned char hi;
+    struct cypher_input_position lead_position;
+    unsigned char lead;
+    cp_utf8_errors_t errors;
+    unsigned int next_error;
+};
+
+
+void cp_utf8_validator_init(struct cp_utf8_validator *v,
+        struct cypher_input_position position);
+
+void cp_utf8_validator_cleanup(struct cp_utf8_validator *v);
+
+/*
+ * Validate the next `n` bytes of input. Returns 0 on success, or -1 if
+ * an error could not be queued (and errno will be set).
+ */
+int cp_utf8_validate(struct cp_utf8_validator *v, const char *buf, size_t n);
+
+/*
+ * Mark the end of input, queueing an error for any truncated sequence.
+ * Returns 0 on success, or -1 on failure (and errno will be set).
+ */
+int cp_utf8_validate_end(struct cp_utf8_validator *v);
+
+/*
+ * Return the earliest queued error, or NULL if there are none.
+ */
+const struct cp_utf8_error *cp_utf8_peek_error(struct cp_utf8_validator *v);
+
+/*
+ * Remove the earliest queued error.
+ */
+void cp_utf8_take_error(struct cp_utf8_validator *v);
+
+/*
+ * Decode the code point at the start of `s`, returning the length of its
+ * encoding, 0 if more than `n` bytes are needed to decode it, or -1 if it
+ * is not valid UTF-8.
+ */
+int cp_utf8_decode(const unsigned char *s, size_t n, uint32_t *c);
+
+
+#endif/*CYPHER_PARSER_UTF8_H*/
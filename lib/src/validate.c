@@ -0,0 +1,1040 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "astnode.h"
+#include "catalog.h"
+#include "errors.h"
+#include "util.h"
+#include "vector.h"
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+
+struct cypher_validation
+{
+    cypher_parse_error_t *errors;
+    unsigned int nerrors;
+};
+
+
+enum variable_kind
+{
+    VARIABLE_UNKNOWN,
+    VARIABLE_ENTITY,
+    VARIABLE_VALUE
+};
+
+
+struct variable
+{
+    const char *name;
+    size_t length;
+    enum variable_kind kind;
+};
+
+
+static const struct variable null_variable =
+        { .name = NULL, .length = 0, .kind = VARIABLE_UNKNOWN };
+
+DECLARE_VECTOR(variables, struct variable, null_variable);
+
+
+struct grouping_key
+{
+    const cypher_astnode_t *expression;
+    uint64_t hash;
+};
+
+
+enum check_mode
+{
+    CHECK_REFERENCES,
+    CHECK_GROUPING
+};
+
+
+struct validator
+{
+    // the variables in scope, innermost last
+    struct variables scope;
+    // when checking grouping, the variables below this index are those in
+    // scope for the projection (rather than local to the expression)
+    unsigned int outer;
+    const struct grouping_key *keys;
+    unsigned int nkeys;
+    cp_error_tracking_t et;
+};
+
+
+static int validate_query(struct validator *v, const cypher_astnode_t *query);
+static int validate_clause(struct validator *v,
+        const cypher_astnode_t *clause);
+static int validate_projections(struct validator *v,
+        const cypher_astnode_t *clause);
+static int validate_grouping(struct validator *v,
+        const cypher_astnode_t *clause, unsigned int nprojections,
+        unsigned int outer, const cypher_astnode_t *order_by);
+static int validate_delete(struct validator *v,
+        const cypher_astnode_t *clause);
+static int validate_foreach(struct validator *v,
+        const cypher_astnode_t *clause);
+static int validate_call(struct validator *v, const cypher_astnode_t *clause);
+static int validate_start(struct validator *v,
+        const cypher_astnode_t *clause);
+static int check_node(struct validator *v, const cypher_astnode_t *node,
+        enum check_mode mode);
+static int check_identifier(struct validator *v,
+        const cypher_astnode_t *identifier, enum check_mode mode);
+static int check_list_comprehension(struct validator *v,
+        const cypher_astnode_t *node, enum check_mode mode);
+static int check_reduce(struct validator *v, const cypher_astnode_t *node,
+        enum check_mode mode);
+static int check_pattern_comprehension(struct validator *v,
+        const cypher_astnode_t *node, enum check_mode mode);
+static int is_grouping_key(struct validator *v, const cypher_astnode_t *node);
+static bool is_aggregate(const cypher_astnode_t *node);
+static bool contains_aggregate(const cypher_astnode_t *node);
+static enum variable_kind expression_kind(struct validator *v,
+        const cypher_astnode_t *expression, unsigned int limit);
+static int bind_pattern(struct validator *v, const cypher_astnode_t *pattern);
+static int bind_path(struct validator *v, const cypher_astnode_t *path);
+static int bind(struct validator *v, const cypher_astnode_t *identifier,
+        enum variable_kind kind);
+static int declare(struct validator *v, const cypher_astnode_t *identifier,
+        enum variable_kind kind);
+static int lookup(struct validator *v, const cypher_astnode_t *identifier,
+        unsigned int limit);
+static const cypher_astnode_t *get_projection(const cypher_astnode_t *clause,
+        unsigned int index);
+
+
+static inline int check_references(struct validator *v,
+        const cypher_astnode_t *node)
+{
+    return check_node(v, node, CHECK_REFERENCES);
+}
+
+
+int cypher_ast_validate(const cypher_parse_result_t *result,
+        cypher_validation_t **errors)
+{
+    REQUIRE(result != NULL, -1);
+    REQUIRE(errors != NULL, -1);
+    *errors = NULL;
+
+    struct validator v;
+    memset(&v, 0, sizeof(v));
+    variables_init(&(v.scope));
+    cp_et_init(&(v.et), cypher_parser_no_colorization);
+
+    int result_nerrors = -1;
+    unsigned int ndirectives = cypher_parse_result_ndirectives(result);
+    for (unsigned int i = 0; i < ndirectives; ++i)
+    {
+        const cypher_astnode_t *directive =
+                cypher_parse_result_get_directive(result, i);
+        if (directive == NULL)
+        {
+            goto cleanup;
+        }
+        if (directive->type != CYPHER_AST_STATEMENT)
+        {
+            continue;
+        }
+        const cypher_astnode_t *body = cypher_ast_statement_get_body(directive);
+        if (body->type == CYPHER_AST_QUERY && validate_query(&v, body))
+        {
+            goto cleanup;
+        }
+    }
+
+    unsigned int nerrors = cp_et_nerrors(&(v.et));
+    if (nerrors > 0)
+    {
+        cypher_validation_t *validation = malloc(sizeof(cypher_validation_t));
+        if (validation == NULL)
+        {
+            goto cleanup;
+        }
+        validation->errors = cp_et_errors(&(v.et));
+        validation->nerrors = nerrors;
+        v.et.errors = NULL;
+        v.et.errors_capacity = 0;
+        v.et.nerrors = 0;
+        *errors = validation;
+    }
+    result_nerrors = (int)nerrors;
+
+    int errsv;
+cleanup:
+    errsv = errno;
+    variables_cleanup(&(v.scope));
+    cp_et_cleanup(&(v.et));
+    errno = errsv;
+    return result_nerrors;
+}
+
+
+unsigned int cypher_validation_nerrors(const cypher_validation_t *errors)
+{
+    REQUIRE(errors != NULL, 0);
+    return errors->nerrors;
+}
+
+
+const cypher_parse_error_t *cypher_validation_get_error(
+        const cypher_validation_t *errors, unsigned int index)
+{
+    REQUIRE(errors != NULL, NULL);
+    if (index >= errors->nerrors)
+    {
+        return NULL;
+    }
+    return &(errors->errors[index]);
+}
+
+
+void cypher_validation_free(cypher_validation_t *errors)
+{
+    if (errors == NULL)
+    {
+        return;
+    }
+    cp_errors_vcleanup(errors->errors, errors->nerrors);
+    free(errors->errors);
+    free(errors);
+}
+
+
+int validate_query(struct validator *v, const cypher_astnode_t *query)
+{
+    variables_clear(&(v->scope));
+    unsigned int nclauses = cypher_ast_query_nclauses(query);
+    for (unsigned int i = 0; i < nclauses; ++i)
+    {
+        const cypher_astnode_t *clause = cypher_ast_query_get_clause(query, i);
+        if (clause->type == CYPHER_AST_UNION)
+        {
+            variables_clear(&(v->scope));
+            continue;
+        }
+        if (validate_clause(v, clause))
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+
+int validate_clause(struct validator *v, const cypher_astnode_t *clause)
+{
+    cypher_astnode_type_t type = clause->type;
+    if (type == CYPHER_AST_MATCH)
+    {
+        // every variable in the pattern is bound before property
+        // expressions and the predicate are checked
+        if (bind_pattern(v, cypher_ast_match_get_pattern(clause)))
+        {
+            return -1;
+        }
+        return check_references(v, clause);
+    }
+    if (type == CYPHER_AST_CREATE)
+    {
+        if (bind_pattern(v, cypher_ast_create_get_pattern(clause)))
+        {
+            return -1;
+        }
+        return check_references(v, clause);
+    }
+    if (type == CYPHER_AST_MERGE)
+    {
+        if (bind_path(v, cypher_ast_merge_get_pattern_path(clause)))
+        {
+            return -1;
+        }
+        return check_references(v, clause);
+    }
+    if (type == CYPHER_AST_UNWIND)
+    {
+        if (check_references(v, cypher_ast_unwind_get_expression(clause)))
+        {
+            return -1;
+        }
+        return declare(v, cypher_ast_unwind_get_alias(clause),
+                VARIABLE_UNKNOWN);
+    }
+    if (type == CYPHER_AST_WITH || type == CYPHER_AST_RETURN)
+    {
+        return validate_projections(v, clause);
+    }
+    if (type == CYPHER_AST_DELETE)
+    {
+        return validate_delete(v, clause);
+    }
+    if (type == CYPHER_AST_FOREACH)
+    {
+        return validate_foreach(v, clause);
+    }
+    if (type == CYPHER_AST_LOAD_CSV)
+    {
+        if (check_references(v, cypher_ast_load_csv_get_url(clause)))
+        {
+            return -1;
+        }
+        return declare(v, cypher_ast_load_csv_get_identifier(clause),
+                VARIABLE_VALUE);
+    }
+    if (type == CYPHER_AST_CALL)
+    {
+        return validate_call(v, clause);
+    }
+    if (type == CYPHER_AST_START)
+    {
+        return validate_start(v, clause);
+    }
+    // other clauses (SET, REMOVE, ...) only reference variables
+    return check_references(v, clause);
+}
+
+
+int validate_projections(struct validator *v, const cypher_astnode_t *clause)
+{
+    bool is_with = (clause->type == CYPHER_AST_WITH);
+    const char *name = is_with? "WITH" : "RETURN";
+    unsigned int nprojections;
+    bool include_existing;
+    if (is_with)
+    {
+        nprojections = cypher_ast_with_nprojections(clause);
+        include_existing = cypher_ast_with_has_include_existing(clause);
+    }
+    else
+    {
+        nprojections = cypher_ast_return_nprojections(clause);
+        include_existing = cypher_ast_return_has_include_existing(clause);
+    }
+
+    if (include_existing && variables_size(&(v->scope)) == 0 &&
+        cp_et_add_error(&(v->et), clause->range.start,
+                "%s * is not allowed when there are no variables in scope",
+                name))
+    {
+        return -1;
+    }
+
+    bool aggregating = false;
+    for (unsigned int i = 0; i < nprojections; ++i)
+    {
+        const cypher_astnode_t *expression =
+                cypher_ast_projection_get_expression(
+                        get_projection(clause, i));
+        if (check_references(v, expression))
+        {
+            return -1;
+        }
+        aggregating = aggregating || contains_aggregate(expression);
+    }
+
+    // with `*`, every variable in scope is a grouping key
+    bool grouping = aggregating && !include_existing;
+    unsigned int mark = variables_size(&(v->scope));
+    if (grouping && validate_grouping(v, clause, nprojections, mark, NULL))
+    {
+        return -1;
+    }
+
+    // the columns are added above the variables already in scope, which
+    // remain visible to ORDER BY
+    for (unsigned int i = 0; i < nprojections; ++i)
+    {
+        const cypher_astnode_t *projection = get_projection(clause, i);
+        const cypher_astnode_t *expression =
+                cypher_ast_projection_get_expression(projection);
+        const cypher_astnode_t *alias =
+                cypher_ast_projection_get_alias(projection);
+        if (alias == NULL && expression->type == CYPHER_AST_IDENTIFIER)
+        {
+            alias = expression;
+        }
+        if (alias == NULL)
+        {
+            if (is_with && cp_et_add_error(&(v->et), expression->range.start,
+                        "Expression in WITH must be aliased (use AS)"))
+            {
+                return -1;
+            }
+            continue;
+        }
+
+        int existing = lookup(v, alias, variables_size(&(v->scope)));
+        if (existing >= (int)mark)
+        {
+            if (cp_et_add_error(&(v->et), alias->range.start,
+                    "Multiple result columns with the same name '%s' "
+                    "are not supported",
+                    cypher_ast_identifier_get_name(alias)))
+            {
+                return -1;
+            }
+            continue;
+        }
+
+        struct variable column =
+            { .name = cypher_ast_identifier_get_name(alias),
+              .length = cypher_ast_identifier_get_name_len(alias),
+              .kind = expression_kind(v, expression, mark) };
+        if (variables_push(&(v->scope), column))
+        {
+            return -1;
+        }
+    }
+
+    const cypher_astnode_t *order_by = is_with?
+            cypher_ast_with_get_order_by(clause) :
+            cypher_ast_return_get_order_by(clause);
+    if (check_references(v, order_by))
+    {
+        return -1;
+    }
+    if (grouping && order_by != NULL &&
+        validate_grouping(v, clause, nprojections, mark, order_by))
+    {
+        return -1;
+    }
+
+    if (is_with && !include_existing)
+    {
+        unsigned int ncolumns = variables_size(&(v->scope)) - mark;
+        struct variable *vars = variables_elements(&(v->scope));
+        memmove(vars, vars + mark, ncolumns * sizeof(struct variable));
+        variables_npop(&(v->scope), mark);
+    }
+
+    if (is_with)
+    {
+        return (check_references(v, cypher_ast_with_get_predicate(clause)) ||
+                check_references(v, cypher_ast_with_get_skip(clause)) ||
+                check_references(v, cypher_ast_with_get_limit(clause)))?
+                -1 : 0;
+    }
+    return (check_references(v, cypher_ast_return_get_skip(clause)) ||
+            check_references(v, cypher_ast_return_get_limit(clause)))? -1 : 0;
+}
+
+
+/*
+ * Outside of aggregate function applications, an aggregating projection may
+ * only reference variables by way of the grouping keys (the projections
+ * that contain no aggregate). Variables below `outer` are those in scope
+ * before the projection. If `order_by` is given, its items are checked
+ * rather than the projections, and may also reference the columns.
+ */
+int validate_grouping(struct validator *v, const cypher_astnode_t *clause,
+        unsigned int nprojections, unsigned int outer,
+        const cypher_astnode_t *order_by)
+{
+    struct grouping_key *keys =
+            malloc(nprojections * sizeof(struct grouping_key));
+    if (keys == NULL)
+    {
+        return -1;
+    }
+
+    int err = -1;
+    unsigned int nkeys = 0;
+    for (unsigned int i = 0; i < nprojections; ++i)
+    {
+        const cypher_astnode_t *expression =
+                cypher_ast_projection_get_expression(
+                        get_projection(clause, i));
+        if (contains_aggregate(expression))
+        {
+            continue;
+        }
+        keys[nkeys].expression = expression;
+        keys[nkeys].hash = 0;
+        if (expression->type == CYPHER_AST_PROPERTY_OPERATOR &&
+            cypher_ast_canonical_hash(expression, &(keys[nkeys].hash)))
+        {
+            goto cleanup;
+        }
+        ++nkeys;
+    }
+
+    v->keys = keys;
+    v->nkeys = nkeys;
+    v->outer = outer;
+    unsigned int nitems =
+            (order_by != NULL)? cypher_ast_order_by_nitems(order_by) : 0;
+    for (unsigned int i = 0; i < nitems; ++i)
+    {
+        const cypher_astnode_t *expression =
+                cypher_ast_sort_item_get_expression(
+                        cypher_ast_order_by_get_item(order_by, i));
+        if (check_node(v, expression, CHECK_GROUPING))
+        {
+            goto cleanup;
+        }
+    }
+    for (unsigned int i = 0; order_by == NULL && i < nprojections; ++i)
+    {
+        const cypher_astnode_t *expression =
+                cypher_ast_projection_get_expression(
+                        get_projection(clause, i));
+        if (contains_aggregate(expression) &&
+            check_node(v, expression, CHECK_GROUPING))
+        {
+            goto cleanup;
+        }
+    }
+    err = 0;
+
+    int errsv;
+cleanup:
+    errsv = errno;
+    v->keys = NULL;
+    v->nkeys = 0;
+    free(keys);
+    errno = errsv;
+    return err;
+}
+
+
+int validate_delete(struct validator *v, const cypher_astnode_t *clause)
+{
+    unsigned int n = cypher_ast_delete_nexpressions(clause);
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        const cypher_astnode_t *expression =
+                cypher_ast_delete_get_expression(clause, i);
+        if (check_references(v, expression))
+        {
+            return -1;
+        }
+        if (expression_kind(v, expression, variables_size(&(v->scope))) ==
+                VARIABLE_VALUE &&
+            cp_et_add_error(&(v->et), expression->range.start,
+                "Expected a node, relationship or path to DELETE"))
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+
+int validate_foreach(struct validator *v, const cypher_astnode_t *clause)
+{
+    if (check_references(v, cypher_ast_foreach_get_expression(clause)))
+    {
+        return -1;
+    }
+
+    // variables bound within FOREACH are not visible after it
+    unsigned int mark = variables_size(&(v->scope));
+    int err = -1;
+    if (declare(v, cypher_ast_foreach_get_identifier(clause),
+                VARIABLE_UNKNOWN))
+    {
+        goto cleanup;
+    }
+    unsigned int nclauses = cypher_ast_foreach_nclauses(clause);
+    for (unsigned int i = 0; i < nclauses; ++i)
+    {
+        if (validate_clause(v, cypher_ast_foreach_get_clause(clause, i)))
+        {
+            goto cleanup;
+        }
+    }
+    err = 0;
+
+cleanup:
+    variables_npop(&(v->scope), variables_size(&(v->scope)) - mark);
+    return err;
+}
+
+
+int validate_call(struct validator *v, const cypher_astnode_t *clause)
+{
+    unsigned int nargs = cypher_ast_call_narguments(clause);
+    for (unsigned int i = 0; i < nargs; ++i)
+    {
+        if (check_references(v, cypher_ast_call_get_argument(clause, i)))
+        {
+            return -1;
+        }
+    }
+
+    // the expression of each projection names a procedure output, not a
+    // variable in scope
+    unsigned int nprojections = cypher_ast_call_nprojections(clause);
+    for (unsigned int i = 0; i < nprojections; ++i)
+    {
+        const cypher_astnode_t *projection =
+                cypher_ast_call_get_projection(clause, i);
+        const cypher_astnode_t *alias =
+                cypher_ast_projection_get_alias(projection);
+        if (alias == NULL)
+        {
+            alias = cypher_ast_projection_get_expression(projection);
+        }
+        if (alias->type == CYPHER_AST_IDENTIFIER &&
+            declare(v, alias, VARIABLE_UNKNOWN))
+        {
+            return -1;
+        }
+    }
+
+    return check_references(v, cypher_ast_call_get_predicate(clause));
+}
+
+
+int validate_start(struct validator *v, const cypher_astnode_t *clause)
+{
+    unsigned int npoints = cypher_ast_start_npoints(clause);
+    for (unsigned int i = 0; i < npoints; ++i)
+    {
+        const cypher_astnode_t *point = cypher_ast_start_get_point(clause, i);
+        for (unsigned int j = 0; j < point->nchildren; ++j)
+        {
+            const cypher_astnode_t *child = point->children[j];
+            int err = (child->type == CYPHER_AST_IDENTIFIER)?
+                    bind(v, child, VARIABLE_ENTITY) :
+                    check_references(v, child);
+            if (err)
+            {
+                return -1;
+            }
+        }
+    }
+    return check_references(v, cypher_ast_start_get_predicate(clause));
+}
+
+
+int check_node(struct validator *v, const cypher_astnode_t *node,
+        enum check_mode mode)
+{
+    if (node == NULL || !(node->attributes & CYPHER_AST_HAS_IDENTIFIER))
+    {
+        return 0;
+    }
+
+    if (mode == CHECK_GROUPING)
+    {
+        if (is_aggregate(node))
+        {
+            return 0;
+        }
+        int key = is_grouping_key(v, node);
+        if (key != 0)
+        {
+            return (key < 0)? -1 : 0;
+        }
+    }
+
+    if (node->type == CYPHER_AST_IDENTIFIER)
+    {
+        return check_identifier(v, node, mode);
+    }
+    if (cypher_astnode_instanceof(node, CYPHER_AST_LIST_COMPREHENSION))
+    {
+        return check_list_comprehension(v, node, mode);
+    }
+    if (node->type == CYPHER_AST_REDUCE)
+    {
+        return check_reduce(v, node, mode);
+    }
+    if (node->type == CYPHER_AST_PATTERN_COMPREHENSION)
+    {
+        return check_pattern_comprehension(v, node, mode);
+    }
+
+    for (unsigned int i = 0; i < node->nchildren; ++i)
+    {
+        if (check_node(v, node->children[i], mode))
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+
+int check_identifier(struct validator *v, const cypher_astnode_t *identifier,
+        enum check_mode mode)
+{
+    int index = lookup(v, identifier, variables_size(&(v->scope)));
+    if (mode == CHECK_REFERENCES)
+    {
+        if (index >= 0)
+        {
+            return 0;
+        }
+        return cp_et_add_error(&(v->et), identifier->range.start,
+                "Variable '%s' not defined",
+                cypher_ast_identifier_get_name(identifier));
+    }
+
+    // variables local to the expression, and undefined variables (which
+    // are reported when checking references), are not grouping errors
+    if (index < 0 || (unsigned int)index >= v->outer)
+    {
+        return 0;
+    }
+    return cp_et_add_error(&(v->et), identifier->range.start,
+            "Variable '%s' is neither grouped nor aggregated",
+            cypher_ast_identifier_get_name(identifier));
+}
+
+
+int check_list_comprehension(struct validator *v,
+        const cypher_astnode_t *node, enum check_mode mode)
+{
+    if (check_node(v, cypher_ast_list_comprehension_get_expression(node),
+                mode))
+    {
+        return -1;
+    }
+
+    unsigned int mark = variables_size(&(v->scope));
+    int err = (declare(v, cypher_ast_list_comprehension_get_identifier(node),
+                VARIABLE_UNKNOWN) ||
+            check_node(v, cypher_ast_list_comprehension_get_predicate(node),
+                mode) ||
+            check_node(v, cypher_ast_list_comprehension_get_eval(node),
+                mode))? -1 : 0;
+    variables_npop(&(v->scope), variables_size(&(v->scope)) - mark);
+    return err;
+}
+
+
+int check_reduce(struct validator *v, const cypher_astnode_t *node,
+        enum check_mode mode)
+{
+    if (check_node(v, cypher_ast_reduce_get_init(node), mode) ||
+        check_node(v, cypher_ast_reduce_get_expression(node), mode))
+    {
+        return -1;
+    }
+
+    unsigned int mark = variables_size(&(v->scope));
+    int err = (declare(v, cypher_ast_reduce_get_accumulator(node),
+                VARIABLE_UNKNOWN) ||
+            declare(v, cypher_ast_reduce_get_identifier(node),
+                VARIABLE_UNKNOWN) ||
+            check_node(v, cypher_ast_reduce_get_eval(node), mode))? -1 : 0;
+    variables_npop(&(v->scope), variables_size(&(v->scope)) - mark);
+    return err;
+}
+
+
+int check_pattern_comprehension(struct validator *v,
+        const cypher_astnode_t *node, enum check_mode mode)
+{
+    unsigned int mark = variables_size(&(v->scope));
+    int err = -1;
+
+    const cypher_astnode_t *identifier =
+            cypher_ast_pattern_comprehension_get_identifier(node);
+    if (identifier != NULL && declare(v, identifier, VARIABLE_ENTITY))
+    {
+        goto cleanup;
+    }
+    const cypher_astnode_t *pattern =
+            cypher_ast_pattern_comprehension_get_pattern(node);
+    if (bind_path(v, pattern) ||
+        check_node(v, pattern, mode) ||
+        check_node(v, cypher_ast_pattern_comprehension_get_predicate(node),
+            mode) ||
+        check_node(v, cypher_ast_pattern_comprehension_get_eval(node), mode))
+    {
+        goto cleanup;
+    }
+    err = 0;
+
+cleanup:
+    variables_npop(&(v->scope), variables_size(&(v->scope)) - mark);
+    return err;
+}
+
+
+/*
+ * Returns 1 if the node is an identifier or property lookup that is a
+ * grouping key, 0 if not, or -1 on error.
+ */
+int is_grouping_key(struct validator *v, const cypher_astnode_t *node)
+{
+    if (node->type == CYPHER_AST_IDENTIFIER)
+    {
+        const char *name = cypher_ast_identifier_get_name(node);
+        size_t n = cypher_ast_identifier_get_name_len(node);
+        for (unsigned int i = 0; i < v->nkeys; ++i)
+        {
+            const cypher_astnode_t *key = v->keys[i].expression;
+            if (key->type == CYPHER_AST_IDENTIFIER &&
+                cypher_ast_identifier_get_name_len(key) == n &&
+                memcmp(cypher_ast_identifier_get_name(key), name, n) == 0)
+            {
+                return 1;
+            }
+        }
+        return 0;
+    }
+
+    if (node->type != CYPHER_AST_PROPERTY_OPERATOR)
+    {
+        return 0;
+    }
+    bool hashed = false;
+    uint64_t hash = 0;
+    for (unsigned int i = 0; i < v->nkeys; ++i)
+    {
+        if (v->keys[i].expression->type != CYPHER_AST_PROPERTY_OPERATOR)
+        {
+            continue;
+        }
+        if (!hashed)
+        {
+            if (cypher_ast_canonical_hash(node, &hash))
+            {
+                return -1;
+            }
+            hashed = true;
+        }
+        if (v->keys[i].hash == hash)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+/*
+ * Aggregates are identified from the function flags resolved when parsing,
+ * or, when the name was not resolved against a catalog, the builtins.
+ */
+bool is_aggregate(const cypher_astnode_t *node)
+{
+    const cypher_astnode_t *func_name;
+    if (node->type == CYPHER_AST_APPLY_OPERATOR)
+    {
+        func_name = cypher_ast_apply_operator_get_func_name(node);
+    }
+    else if (node->type == CYPHER_AST_APPLY_ALL_OPERATOR)
+    {
+        func_name = cypher_ast_apply_all_operator_get_func_name(node);
+    }
+    else
+    {
+        return false;
+    }
+
+    uint_fast32_t flags;
+    if (cypher_ast_function_name_get_id(func_name) >= 0)
+    {
+        flags = cypher_ast_function_name_get_flags(func_name);
+    }
+    else
+    {
+        flags = cp_catalog_builtin_function_flags(
+                cypher_ast_function_name_get_value(func_name),
+                cypher_ast_function_name_get_value_len(func_name));
+    }
+    return (flags & CYPHER_CATALOG_AGGREGATE) != 0;
+}
+
+
+bool contains_aggregate(const cypher_astnode_t *node)
+{
+    if (node == NULL)
+    {
+        return false;
+    }
+    if ((node->attributes & CYPHER_AST_HAS_AGGREGATE) || is_aggregate(node))
+    {
+        return true;
+    }
+    for (unsigned int i = 0; i < node->nchildren; ++i)
+    {
+        if (contains_aggregate(node->children[i]))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/*
+ * Classify an expression as certainly an entity (node, relationship or
+ * path), certainly not an entity, or unknown, using the variables below
+ * `limit` in the scope.
+ */
+enum variable_kind expression_kind(struct validator *v,
+        const cypher_astnode_t *expression, unsigned int limit)
+{
+    cypher_astnode_type_t type = expression->type;
+    if (type == CYPHER_AST_IDENTIFIER)
+    {
+        int index = lookup(v, expression, limit);
+        return (index < 0)? VARIABLE_UNKNOWN :
+                variables_elements(&(v->scope))[index].kind;
+    }
+    if (type == CYPHER_AST_NULL)
+    {
+        return VARIABLE_UNKNOWN;
+    }
+    if ((expression->attributes & CYPHER_AST_IS_CONSTANT) ||
+        type == CYPHER_AST_BINARY_OPERATOR ||
+        type == CYPHER_AST_UNARY_OPERATOR ||
+        type == CYPHER_AST_COMPARISON ||
+        type == CYPHER_AST_COLLECTION ||
+        type == CYPHER_AST_MAP ||
+        type == CYPHER_AST_MAP_PROJECTION ||
+        type == CYPHER_AST_PATTERN_COMPREHENSION ||
+        type == CYPHER_AST_PROPERTY_OPERATOR ||
+        type == CYPHER_AST_LABELS_OPERATOR ||
+        type == CYPHER_AST_SLICE_OPERATOR ||
+        type == CYPHER_AST_APPLY_ALL_OPERATOR ||
+        cypher_astnode_instanceof(expression, CYPHER_AST_LIST_COMPREHENSION))
+    {
+        return VARIABLE_VALUE;
+    }
+    return VARIABLE_UNKNOWN;
+}
+
+
+int bind_pattern(struct validator *v, const cypher_astnode_t *pattern)
+{
+    unsigned int npaths = cypher_ast_pattern_npaths(pattern);
+    for (unsigned int i = 0; i < npaths; ++i)
+    {
+        if (bind_path(v, cypher_ast_pattern_get_path(pattern, i)))
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+
+int bind_path(struct validator *v, const cypher_astnode_t *path)
+{
+    if (path->type == CYPHER_AST_NAMED_PATH)
+    {
+        if (bind(v, cypher_ast_named_path_get_identifier(path),
+                    VARIABLE_ENTITY))
+        {
+            return -1;
+        }
+        path = cypher_ast_named_path_get_path(path);
+    }
+    if (path->type == CYPHER_AST_SHORTEST_PATH)
+    {
+        path = cypher_ast_shortest_path_get_path(path);
+    }
+
+    unsigned int nelements = cypher_ast_pattern_path_nelements(path);
+    for (unsigned int i = 0; i < nelements; ++i)
+    {
+        const cypher_astnode_t *element =
+                cypher_ast_pattern_path_get_element(path, i);
+        const cypher_astnode_t *identifier;
+        enum variable_kind kind = VARIABLE_ENTITY;
+        if (element->type == CYPHER_AST_NODE_PATTERN)
+        {
+            identifier = cypher_ast_node_pattern_get_identifier(element);
+        }
+        else
+        {
+            identifier = cypher_ast_rel_pattern_get_identifier(element);
+            // a variable length relationship is bound to a list
+            if (cypher_ast_rel_pattern_get_varlength(element) != NULL)
+            {
+                kind = VARIABLE_UNKNOWN;
+            }
+        }
+        if (identifier != NULL && bind(v, identifier, kind))
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+
+/*
+ * Bind a pattern variable, unless it is already in scope.
+ */
+int bind(struct validator *v, const cypher_astnode_t *identifier,
+        enum variable_kind kind)
+{
+    if (lookup(v, identifier, variables_size(&(v->scope))) >= 0)
+    {
+        return 0;
+    }
+    return declare(v, identifier, kind);
+}
+
+
+/*
+ * Declare a variable, shadowing any already in scope.
+ */
+int declare(struct validator *v, const cypher_astnode_t *identifier,
+        enum variable_kind kind)
+{
+    assert(identifier->type == CYPHER_AST_IDENTIFIER);
+    struct variable var =
+        { .name = cypher_ast_identifier_get_name(identifier),
+          .length = cypher_ast_identifier_get_name_len(identifier),
+          .kind = kind };
+    return variables_push(&(v->scope), var);
+}
+
+
+/*
+ * Find the innermost variable below `limit` with the name of the
+ * identifier, returning its index or -1.
+ */
+int lookup(struct validator *v, const cypher_astnode_t *identifier,
+        unsigned int limit)
+{
+    const char *name = cypher_ast_identifier_get_name(identifier);
+    size_t n = cypher_ast_identifier_get_name_len(identifier);
+    const struct variable *vars = variables_elements(&(v->scope));
+    for (unsigned int i = limit; i-- > 0; )
+    {
+        if (vars[i].length == n && memcmp(vars[i].name, name, n) == 0)
+        {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+
+const cypher_astnode_t *get_projection(const cypher_astnode_t *clause,
+        unsigned int index)
+{
+    return (clause->type == CYPHER_AST_WITH)?
+            cypher_ast_with_get_projection(clause, index) :
+            cypher_ast_return_get_projection(clause, index);
+}
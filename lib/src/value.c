@@ -0,0 +1,942 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "cypher-parser.h"
+#include "string_buffer.h"
+#include "util.h"
+#include "vector.h"
+#include <assert.h>
+#include <errno.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+#define VALUE_ARENA_MIN_CHUNK_SIZE 4096
+
+struct value_chunk
+{
+    struct value_chunk *next;
+    size_t size;
+    size_t used;
+};
+
+struct value_tree
+{
+    struct value_chunk *chunks;
+    cypher_value_t root;
+};
+
+struct value_key
+{
+    const char *key;
+    size_t length;
+};
+
+struct value_frame
+{
+    bool is_map;
+    unsigned int values_base;
+    unsigned int keys_base;
+};
+
+static const cypher_value_t null_value = { .type = CYPHER_VALUE_NULL };
+static const struct value_key null_key = { NULL, 0 };
+static const struct value_frame null_frame = { false, 0, 0 };
+
+DECLARE_VECTOR(value_stack, cypher_value_t, null_value);
+DECLARE_VECTOR(value_keys, struct value_key, null_key);
+DECLARE_VECTOR(value_frames, struct value_frame, null_frame);
+
+struct value_scanner
+{
+    const char *p;
+    const char *end;
+    struct value_tree *tree;
+    value_stack_t values;
+    value_keys_t keys;
+    value_frames_t frames;
+    struct cp_string_buffer sb;
+    struct cypher_value_map_entry *tmp;
+    unsigned int tmp_capacity;
+};
+
+
+static void *arena_alloc(struct value_tree *tree, size_t size);
+static char *arena_strdup(struct value_tree *tree, const char *s, size_t n);
+static int skip_ws(struct value_scanner *sc);
+static int scan_scalar(struct value_scanner *sc, cypher_value_t *value);
+static int scan_string(struct value_scanner *sc, cypher_value_t *value);
+static int scan_number(struct value_scanner *sc, bool negate,
+        cypher_value_t *value);
+static int scan_keyword(struct value_scanner *sc, cypher_value_t *value);
+static bool match_word(const char *p, const char *end, const char *word,
+        size_t n);
+static int scan_key(struct value_scanner *sc);
+static int close_list(struct value_scanner *sc, cypher_value_t *value);
+static int close_map(struct value_scanner *sc, cypher_value_t *value);
+static void sort_entries(struct cypher_value_map_entry *entries,
+        struct cypher_value_map_entry *tmp, unsigned int n);
+static int compare_keys(const char *a, size_t alen, const char *b, size_t blen);
+
+
+static inline bool is_sym_start(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+
+static inline bool is_sym_part(char c)
+{
+    return is_sym_start(c) || (c >= '0' && c <= '9') || c == '$';
+}
+
+
+static inline bool is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+
+int cypher_parse_value(const char *s, size_t n, const cypher_value_t **value)
+{
+    REQUIRE(s != NULL || n == 0, -1);
+    REQUIRE(value != NULL, -1);
+
+    struct value_tree *tree = calloc(1, sizeof(struct value_tree));
+    if (tree == NULL)
+    {
+        return -1;
+    }
+
+    struct value_scanner sc;
+    memset(&sc, 0, sizeof(sc));
+    sc.p = s;
+    sc.end = s + n;
+    sc.tree = tree;
+    value_stack_init(&(sc.values));
+    value_keys_init(&(sc.keys));
+    value_frames_init(&(sc.frames));
+
+    int err = -1;
+    if (skip_ws(&sc))
+    {
+        goto cleanup;
+    }
+
+    cypher_value_t v;
+    for (;;)
+    {
+        if (sc.p < sc.end && (*(sc.p) == '[' || *(sc.p) == '{'))
+        {
+            bool is_map = (*(sc.p) == '{');
+            ++(sc.p);
+            struct value_frame frame =
+                { .is_map = is_map,
+                  .values_base = value_stack_size(&(sc.values)),
+                  .keys_base = value_keys_size(&(sc.keys)) };
+            if (value_frames_push(&(sc.frames), frame) || skip_ws(&sc))
+            {
+                goto cleanup;
+            }
+            if (sc.p < sc.end && *(sc.p) == (is_map? '}' : ']'))
+            {
+                ++(sc.p);
+                if ((is_map? close_map(&sc, &v) : close_list(&sc, &v)))
+                {
+                    goto cleanup;
+                }
+            }
+            else if (is_map && scan_key(&sc))
+            {
+                goto cleanup;
+            }
+            else
+            {
+                continue;
+            }
+        }
+        else if (scan_scalar(&sc, &v))
+        {
+            goto cleanup;
+        }
+
+        // a value has been scanned: add it to the enclosing container,
+        // closing containers that are then complete
+        for (;;)
+        {
+            if (skip_ws(&sc))
+            {
+                goto cleanup;
+            }
+            if (value_frames_size(&(sc.frames)) == 0)
+            {
+                if (sc.p != sc.end)
+                {
+                    errno = EINVAL;
+                    goto cleanup;
+                }
+                tree->root = v;
+                *value = &(tree->root);
+                err = 0;
+                goto cleanup;
+            }
+            if (value_stack_push(&(sc.values), v))
+            {
+                goto cleanup;
+            }
+
+            struct value_frame frame = value_frames_last(&(sc.frames));
+            char close = frame.is_map? '}' : ']';
+            if (sc.p < sc.end && *(sc.p) == ',')
+            {
+                ++(sc.p);
+                if (skip_ws(&sc) || (frame.is_map && scan_key(&sc)))
+                {
+                    goto cleanup;
+                }
+                break;
+            }
+            if (sc.p >= sc.end || *(sc.p) != close)
+            {
+                errno = EINVAL;
+                goto cleanup;
+            }
+            ++(sc.p);
+            if ((frame.is_map? close_map(&sc, &v) : close_list(&sc, &v)))
+            {
+                goto cleanup;
+            }
+        }
+    }
+
+    int errsv;
+cleanup:
+    errsv = errno;
+    if (err)
+    {
+        cypher_value_free(&(tree->root));
+    }
+    value_stack_cleanup(&(sc.values));
+    value_keys_cleanup(&(sc.keys));
+    value_frames_cleanup(&(sc.frames));
+    cp_sb_cleanup(&(sc.sb));
+    free(sc.tmp);
+    errno = errsv;
+    return err;
+}
+
+
+void cypher_value_free(const cypher_value_t *value)
+{
+    if (value == NULL)
+    {
+        return;
+    }
+    struct value_tree *tree = container_of(value, struct value_tree, root);
+    struct value_chunk *chunk = tree->chunks;
+    while (chunk != NULL)
+    {
+        struct value_chunk *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    free(tree);
+}
+
+
+const cypher_value_t *cypher_value_map_get(const cypher_value_t *value,
+        const char *key, size_t n)
+{
+    REQUIRE(value != NULL, NULL);
+    REQUIRE(key != NULL || n == 0, NULL);
+    if (value->type != CYPHER_VALUE_MAP)
+    {
+        return NULL;
+    }
+
+    const struct cypher_value_map_entry *entries = value->u.map.entries;
+    unsigned int lo = 0;
+    unsigned int hi = value->u.map.n;
+    while (lo < hi)
+    {
+        unsigned int mid = lo + (hi - lo) / 2;
+        int c = compare_keys(entries[mid].key, entries[mid].key_length,
+                key, n);
+        if (c == 0)
+        {
+            return &(entries[mid].value);
+        }
+        if (c < 0)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return NULL;
+}
+
+
+void *arena_alloc(struct value_tree *tree, size_t size)
+{
+    size = (size + (sizeof(void *) - 1)) & ~(sizeof(void *) - 1);
+    struct value_chunk *chunk = tree->chunks;
+    if (chunk == NULL || (chunk->size - chunk->used) < size)
+    {
+        size_t csize = (chunk == NULL)?
+                VALUE_ARENA_MIN_CHUNK_SIZE : chunk->size * 2;
+        if (csize < size)
+        {
+            csize = size;
+        }
+        chunk = malloc(sizeof(struct value_chunk) + csize);
+        if (chunk == NULL)
+        {
+            return NULL;
+        }
+        chunk->next = tree->chunks;
+        chunk->size = csize;
+        chunk->used = 0;
+        tree->chunks = chunk;
+    }
+    void *p = (char *)(chunk + 1) + chunk->used;
+    chunk->used += size;
+    return p;
+}
+
+
+char *arena_strdup(struct value_tree *tree, const char *s, size_t n)
+{
+    char *d = arena_alloc(tree, n + 1);
+    if (d == NULL)
+    {
+        return NULL;
+    }
+    if (n > 0)
+    {
+        memcpy(d, s, n);
+    }
+    d[n] = '\0';
+    return d;
+}
+
+
+int skip_ws(struct value_scanner *sc)
+{
+    const char *p = sc->p;
+    const char *end = sc->end;
+    while (p < end)
+    {
+        switch (*p)
+        {
+        case ' ':
+        case '\t':
+        case '\n':
+            ++p;
+            continue;
+        case '\r':
+            if ((p + 1) < end && p[1] == '\n')
+            {
+                p += 2;
+                continue;
+            }
+            break;
+        case '/':
+            if ((p + 1) < end && p[1] == '/')
+            {
+                const char *eol = memchr(p + 2, '\n', end - (p + 2));
+                p = (eol == NULL)? end : eol + 1;
+                continue;
+            }
+            if ((p + 1) < end && p[1] == '*')
+            {
+                p += 2;
+                for (;;)
+                {
+                    const char *star = memchr(p, '*', end - p);
+                    if (star == NULL || (star + 1) >= end)
+                    {
+                        errno = EINVAL;
+                        return -1;
+                    }
+                    p = star + 1;
+                    if (*p == '/')
+                    {
+                        ++p;
+                        break;
+                    }
+                }
+                continue;
+            }
+            break;
+        }
+        break;
+    }
+    sc->p = p;
+    return 0;
+}
+
+
+int scan_scalar(struct value_scanner *sc, cypher_value_t *value)
+{
+    if (sc->p >= sc->end)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    char c = *(sc->p);
+    if (c == '\'' || c == '"')
+    {
+        return scan_string(sc, value);
+    }
+    if (is_digit(c) || c == '.')
+    {
+        return scan_number(sc, false, value);
+    }
+    if (c == '-')
+    {
+        bool negate = false;
+        while (sc->p < sc->end && *(sc->p) == '-')
+        {
+            negate = !negate;
+            ++(sc->p);
+            if (skip_ws(sc))
+            {
+                return -1;
+            }
+        }
+        if (sc->p >= sc->end || !(is_digit(*(sc->p)) || *(sc->p) == '.'))
+        {
+            errno = EINVAL;
+            return -1;
+        }
+        return scan_number(sc, negate, value);
+    }
+    return scan_keyword(sc, value);
+}
+
+
+int scan_string(struct value_scanner *sc, cypher_value_t *value)
+{
+    const char quote = *(sc->p);
+    const char *p = sc->p + 1;
+    const char *end = sc->end;
+
+    const char *close = memchr(p, quote, end - p);
+    if (close == NULL)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    const char *bs = memchr(p, '\\', close - p);
+    if (bs == NULL)
+    {
+        // no escapes: copy the content directly
+        char *s = arena_strdup(sc->tree, p, close - p);
+        if (s == NULL)
+        {
+            return -1;
+        }
+        value->type = CYPHER_VALUE_STRING;
+        value->u.string.s = s;
+        value->u.string.length = close - p;
+        sc->p = close + 1;
+        return 0;
+    }
+
+    cp_sb_reset(&(sc->sb));
+    for (;;)
+    {
+        if (close < p)
+        {
+            // the previous closing quote was escaped
+            close = memchr(p, quote, end - p);
+            if (close == NULL)
+            {
+                errno = EINVAL;
+                return -1;
+            }
+        }
+        bs = memchr(p, '\\', close - p);
+        if (bs == NULL)
+        {
+            if (cp_sb_append(&(sc->sb), p, close - p))
+            {
+                return -1;
+            }
+            break;
+        }
+
+        if (cp_sb_append(&(sc->sb), p, bs - p))
+        {
+            return -1;
+        }
+        p = bs + 1;
+        const char *replacement;
+        switch (*p)
+        {
+        case 'a': replacement = "\a"; break;
+        case 'b': replacement = "\b"; break;
+        case 'f': replacement = "\f"; break;
+        case 'n': replacement = "\n"; break;
+        case 'r': replacement = "\r"; break;
+        case 't': replacement = "\t"; break;
+        case 'v': replacement = "\v"; break;
+        case '\\': replacement = "\\"; break;
+        case '\'': replacement = "'"; break;
+        case '"': replacement = "\""; break;
+        case '?': replacement = "?"; break;
+        default:
+            // not an escape sequence, so the backslash is retained
+            replacement = NULL;
+            break;
+        }
+        if (replacement != NULL)
+        {
+            ++p;
+        }
+        if (cp_sb_append(&(sc->sb),
+                    (replacement != NULL)? replacement : "\\", 1))
+        {
+            return -1;
+        }
+    }
+
+    char *s = arena_strdup(sc->tree, cp_sb_data(&(sc->sb)),
+            cp_sb_length(&(sc->sb)));
+    if (s == NULL)
+    {
+        return -1;
+    }
+    value->type = CYPHER_VALUE_STRING;
+    value->u.string.s = s;
+    value->u.string.length = cp_sb_length(&(sc->sb));
+    sc->p = close + 1;
+    return 0;
+}
+
+
+int scan_number(struct value_scanner *sc, bool negate, cypher_value_t *value)
+{
+    const char *start = sc->p;
+    const char *p = start;
+    const char *end = sc->end;
+    uint64_t magnitude = 0;
+    bool overflow = false;
+
+    if ((p + 1) < end && p[0] == '0' && (p[1] == 'x' || p[1] == 'X'))
+    {
+        p += 2;
+        const char *digits = p;
+        for (; p < end; ++p)
+        {
+            unsigned int d;
+            if (is_digit(*p))
+            {
+                d = *p - '0';
+            }
+            else if (*p >= 'a' && *p <= 'f')
+            {
+                d = *p - 'a' + 10;
+            }
+            else if (*p >= 'A' && *p <= 'F')
+            {
+                d = *p - 'A' + 10;
+            }
+            else
+            {
+                break;
+            }
+            overflow |= (magnitude > (UINT64_MAX >> 4));
+            magnitude = (magnitude << 4) | d;
+        }
+        if (p == digits || (p < end && is_sym_part(*p)))
+        {
+            errno = EINVAL;
+            return -1;
+        }
+        goto integer;
+    }
+
+    unsigned int base = (*p == '0')? 8 : 10;
+    bool invalid_octal = false;
+    for (; p < end && is_digit(*p); ++p)
+    {
+        unsigned int d = *p - '0';
+        invalid_octal |= (d >= base);
+        overflow |= (magnitude > (UINT64_MAX - d) / base);
+        magnitude = magnitude * base + d;
+    }
+
+    if (p < end && (*p == '.' || *p == 'e' || *p == 'E'))
+    {
+        goto real;
+    }
+    if ((p < end && is_sym_part(*p)) || invalid_octal)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+integer:
+    if (overflow || magnitude > ((uint64_t)INT64_MAX + (negate? 1 : 0)))
+    {
+        errno = ERANGE;
+        return -1;
+    }
+    value->type = CYPHER_VALUE_INTEGER;
+    if (!negate)
+    {
+        value->u.integer = (int64_t)magnitude;
+    }
+    else if (magnitude > (uint64_t)INT64_MAX)
+    {
+        value->u.integer = INT64_MIN;
+    }
+    else
+    {
+        value->u.integer = -(int64_t)magnitude;
+    }
+    sc->p = p;
+    return 0;
+
+real:
+    // the decimal digits have been scanned, continue with the fraction
+    // and exponent
+    if (p < end && *p == '.')
+    {
+        ++p;
+        const char *fraction = p;
+        for (; p < end && is_digit(*p); ++p)
+            ;
+        if (p == fraction && !(p < end && (*p == 'e' || *p == 'E')))
+        {
+            errno = EINVAL;
+            return -1;
+        }
+    }
+    if (p < end && (*p == 'e' || *p == 'E'))
+    {
+        ++p;
+        if (p < end && (*p == '-' || *p == '+'))
+        {
+            ++p;
+        }
+        const char *exponent = p;
+        for (; p < end && is_digit(*p); ++p)
+            ;
+        if (p == exponent)
+        {
+            errno = EINVAL;
+            return -1;
+        }
+    }
+    if (p < end && is_sym_part(*p))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    // strtod requires a terminated string
+    char buf[64];
+    const char *s = buf;
+    size_t n = p - start;
+    if (n < sizeof(buf))
+    {
+        memcpy(buf, start, n);
+        buf[n] = '\0';
+    }
+    else
+    {
+        cp_sb_reset(&(sc->sb));
+        if (cp_sb_append(&(sc->sb), start, n) ||
+                cp_sb_append(&(sc->sb), "", 1))
+        {
+            return -1;
+        }
+        s = cp_sb_data(&(sc->sb));
+    }
+
+    char *endptr;
+    double d = strtod(s, &endptr);
+    if (endptr != s + n)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    if (d == HUGE_VAL)
+    {
+        errno = ERANGE;
+        return -1;
+    }
+    value->type = CYPHER_VALUE_FLOAT;
+    value->u.real = negate? -d : d;
+    sc->p = p;
+    return 0;
+}
+
+
+int scan_keyword(struct value_scanner *sc, cypher_value_t *value)
+{
+    const char *p = sc->p;
+    const char *end = sc->end;
+    if (match_word(p, end, "true", 4))
+    {
+        value->type = CYPHER_VALUE_BOOLEAN;
+        value->u.boolean = true;
+        sc->p = p + 4;
+    }
+    else if (match_word(p, end, "false", 5))
+    {
+        value->type = CYPHER_VALUE_BOOLEAN;
+        value->u.boolean = false;
+        sc->p = p + 5;
+    }
+    else if (match_word(p, end, "null", 4))
+    {
+        value->type = CYPHER_VALUE_NULL;
+        sc->p = p + 4;
+    }
+    else
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    return 0;
+}
+
+
+bool match_word(const char *p, const char *end, const char *word, size_t n)
+{
+    if ((size_t)(end - p) < n)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < n; ++i)
+    {
+        // only ascii letters are compared, so folding the case bit suffices
+        if ((p[i] | 0x20) != word[i])
+        {
+            return false;
+        }
+    }
+    return (p + n) == end || !is_sym_part(p[n]);
+}
+
+
+int scan_key(struct value_scanner *sc)
+{
+    const char *p = sc->p;
+    const char *end = sc->end;
+    const char *key;
+    size_t length;
+
+    if (p < end && *p == '`')
+    {
+        key = p + 1;
+        const char *close = memchr(key, '`', end - key);
+        if (close == NULL)
+        {
+            errno = EINVAL;
+            return -1;
+        }
+        length = close - key;
+        p = close + 1;
+    }
+    else if (p < end && is_sym_start(*p))
+    {
+        key = p;
+        for (++p; p < end && is_sym_part(*p); ++p)
+            ;
+        length = p - key;
+    }
+    else
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    struct value_key k = { arena_strdup(sc->tree, key, length), length };
+    if (k.key == NULL || value_keys_push(&(sc->keys), k))
+    {
+        return -1;
+    }
+
+    sc->p = p;
+    if (skip_ws(sc))
+    {
+        return -1;
+    }
+    if (sc->p >= end || *(sc->p) != ':')
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    ++(sc->p);
+    return skip_ws(sc);
+}
+
+
+int close_list(struct value_scanner *sc, cypher_value_t *value)
+{
+    struct value_frame frame = value_frames_pop(&(sc->frames));
+    assert(!frame.is_map);
+    unsigned int n = value_stack_size(&(sc->values)) - frame.values_base;
+
+    cypher_value_t *elements = NULL;
+    if (n > 0)
+    {
+        elements = arena_alloc(sc->tree, n * sizeof(cypher_value_t));
+        if (elements == NULL)
+        {
+            return -1;
+        }
+        memcpy(elements, value_stack_elements(&(sc->values)) +
+                frame.values_base, n * sizeof(cypher_value_t));
+        value_stack_npop(&(sc->values), n);
+    }
+
+    value->type = CYPHER_VALUE_LIST;
+    value->u.list.elements = elements;
+    value->u.list.n = n;
+    return 0;
+}
+
+
+int close_map(struct value_scanner *sc, cypher_value_t *value)
+{
+    struct value_frame frame = value_frames_pop(&(sc->frames));
+    assert(frame.is_map);
+    unsigned int n = value_stack_size(&(sc->values)) - frame.values_base;
+    assert(n == value_keys_size(&(sc->keys)) - frame.keys_base);
+
+    struct cypher_value_map_entry *entries = NULL;
+    if (n > 0)
+    {
+        entries = arena_alloc(sc->tree,
+                n * sizeof(struct cypher_value_map_entry));
+        if (entries == NULL)
+        {
+            return -1;
+        }
+        cypher_value_t *values = value_stack_elements(&(sc->values)) +
+                frame.values_base;
+        struct value_key *keys = value_keys_elements(&(sc->keys)) +
+                frame.keys_base;
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            entries[i].key = keys[i].key;
+            entries[i].key_length = keys[i].length;
+            entries[i].value = values[i];
+        }
+        value_stack_npop(&(sc->values), n);
+        value_keys_npop(&(sc->keys), n);
+
+        if (n > sc->tmp_capacity)
+        {
+            struct cypher_value_map_entry *tmp = realloc(sc->tmp,
+                    n * sizeof(struct cypher_value_map_entry));
+            if (tmp == NULL)
+            {
+                return -1;
+            }
+            sc->tmp = tmp;
+            sc->tmp_capacity = n;
+        }
+        sort_entries(entries, sc->tmp, n);
+
+        // where a key is repeated, the last entry is retained
+        unsigned int j = 0;
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            if ((i + 1) < n && compare_keys(entries[i].key,
+                        entries[i].key_length, entries[i+1].key,
+                        entries[i+1].key_length) == 0)
+            {
+                continue;
+            }
+            entries[j++] = entries[i];
+        }
+        n = j;
+    }
+
+    value->type = CYPHER_VALUE_MAP;
+    value->u.map.entries = entries;
+    value->u.map.n = n;
+    return 0;
+}
+
+
+void sort_entries(struct cypher_value_map_entry *entries,
+        struct cypher_value_map_entry *tmp, unsigned int n)
+{
+    // a stable bottom-up merge sort, so that the order of entries with
+    // repeated keys is preserved
+    struct cypher_value_map_entry *src = entries;
+    struct cypher_value_map_entry *dst = tmp;
+    for (unsigned int width = 1; width < n; width *= 2)
+    {
+        for (unsigned int lo = 0; lo < n; lo += 2 * width)
+        {
+            unsigned int mid = minu(lo + width, n);
+            unsigned int hi = minu(lo + 2 * width, n);
+            unsigned int i = lo, j = mid, k = lo;
+            while (i < mid && j < hi)
+            {
+                if (compare_keys(src[j].key, src[j].key_length,
+                            src[i].key, src[i].key_length) < 0)
+                {
+                    dst[k++] = src[j++];
+                }
+                else
+                {
+                    dst[k++] = src[i++];
+                }
+            }
+            while (i < mid)
+            {
+                dst[k++] = src[i++];
+            }
+            while (j < hi)
+            {
+                dst[k++] = src[j++];
+            }
+        }
+        struct cypher_value_map_entry *t = src;
+        src = dst;
+        dst = t;
+    }
+    if (src != entries)
+    {
+        memcpy(entries, src, n * sizeof(struct cypher_value_map_entry));
+    }
+}
+
+
+int compare_keys(const char *a, size_t alen, const char *b, size_t blen)
+{
+    int c = memcmp(a, b, minzu(alen, blen));
+    if (c != 0)
+    {
+        return c;
+    }
+    return (alen < blen)? -1 : (alen > blen)? 1 : 0;
+}
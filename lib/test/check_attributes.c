@@ -0,0 +1,263 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "../../lib/src/cypher-parser.h"
+#include <check.h>
+#include <errno.h>
+
+
+static cypher_catalog_t *catalog;
+static cypher_parser_config_t *config;
+static cypher_parse_result_t *result;
+
+
+static void setup(void)
+{
+    catalog = cypher_catalog_new(true);
+    ck_assert_ptr_ne(catalog, NULL);
+    config = cypher_parser_new_config();
+    ck_assert_ptr_ne(config, NULL);
+    cypher_parser_config_set_catalog(config, catalog);
+    result = NULL;
+}
+
+
+static void teardown(void)
+{
+    cypher_parse_result_free(result);
+    cypher_parser_config_free(config);
+    cypher_catalog_free(catalog);
+}
+
+
+static unsigned int count_nodes(const cypher_astnode_t *node)
+{
+    unsigned int n = 1;
+    for (unsigned int i = 0; i < cypher_astnode_nchildren(node); ++i)
+    {
+        n += count_nodes(cypher_astnode_get_child(node, i));
+    }
+    return n;
+}
+
+
+static unsigned int measure_depth(const cypher_astnode_t *node)
+{
+    unsigned int depth = 0;
+    for (unsigned int i = 0; i < cypher_astnode_nchildren(node); ++i)
+    {
+        unsigned int d = measure_depth(cypher_astnode_get_child(node, i));
+        if (d > depth)
+        {
+            depth = d;
+        }
+    }
+    return depth + 1;
+}
+
+
+static void check_sizes(const cypher_astnode_t *node)
+{
+    ck_assert_int_eq(cypher_astnode_subtree_size(node), count_nodes(node));
+    ck_assert_int_eq(cypher_astnode_depth(node), measure_depth(node));
+    for (unsigned int i = 0; i < cypher_astnode_nchildren(node); ++i)
+    {
+        check_sizes(cypher_astnode_get_child(node, i));
+    }
+}
+
+
+static const cypher_astnode_t *projection_expression(
+        const cypher_astnode_t *clause, unsigned int index)
+{
+    const cypher_astnode_t *proj =
+            cypher_ast_return_get_projection(clause, index);
+    ck_assert_ptr_ne(proj, NULL);
+    return cypher_ast_projection_get_expression(proj);
+}
+
+
+START_TEST (compute_subtree_size_and_depth)
+{
+    result = cypher_parse("MATCH (n)-[:R]->(m) WHERE n.x > 1 "
+            "RETURN [x IN range(1, 10) WHERE x % 2 = 0 | x * x] AS y;",
+            NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 0);
+
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 0);
+    check_sizes(ast);
+    ck_assert_int_gt(cypher_astnode_subtree_size(ast), 20);
+
+    const cypher_astnode_t *query = cypher_ast_statement_get_body(ast);
+    const cypher_astnode_t *match = cypher_ast_query_get_clause(query, 0);
+    const cypher_astnode_t *pred = cypher_ast_match_get_predicate(match);
+    // n.x > 1: comparison -> (property -> (identifier, prop_name), integer)
+    ck_assert_int_eq(cypher_astnode_subtree_size(pred), 5);
+    ck_assert_int_eq(cypher_astnode_depth(pred), 3);
+}
+END_TEST
+
+
+START_TEST (compute_expression_attributes)
+{
+    result = cypher_parse("RETURN 1 + 2 * 3, [1, 'a', {k: true}], n.x, $p, "
+            "count(*), sum(n.x) + 1, rand(), toUpper('a'), "
+            "[(n)-->(m) | m.x];", NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 0);
+
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 0);
+    const cypher_astnode_t *query = cypher_ast_statement_get_body(ast);
+    const cypher_astnode_t *clause = cypher_ast_query_get_clause(query, 0);
+    ck_assert_int_eq(cypher_astnode_type(clause), CYPHER_AST_RETURN);
+
+    const cypher_astnode_t *exp = projection_expression(clause, 0);
+    ck_assert_int_eq(cypher_astnode_attributes(exp), CYPHER_AST_IS_CONSTANT);
+
+    exp = projection_expression(clause, 1);
+    ck_assert_int_eq(cypher_astnode_attributes(exp), CYPHER_AST_IS_CONSTANT);
+
+    exp = projection_expression(clause, 2);
+    ck_assert_int_eq(cypher_astnode_attributes(exp),
+            CYPHER_AST_HAS_IDENTIFIER);
+
+    exp = projection_expression(clause, 3);
+    ck_assert_int_eq(cypher_astnode_attributes(exp),
+            CYPHER_AST_HAS_PARAMETER);
+
+    exp = projection_expression(clause, 4);
+    ck_assert_int_eq(cypher_astnode_attributes(exp),
+            CYPHER_AST_HAS_AGGREGATE);
+
+    exp = projection_expression(clause, 5);
+    ck_assert_int_eq(cypher_astnode_attributes(exp),
+            CYPHER_AST_HAS_AGGREGATE | CYPHER_AST_HAS_IDENTIFIER);
+
+    exp = projection_expression(clause, 6);
+    ck_assert_int_eq(cypher_astnode_attributes(exp),
+            CYPHER_AST_HAS_NONDETERMINISTIC);
+
+    exp = projection_expression(clause, 7);
+    ck_assert_int_eq(cypher_astnode_attributes(exp), CYPHER_AST_IS_CONSTANT);
+
+    exp = projection_expression(clause, 8);
+    ck_assert_int_eq(cypher_astnode_attributes(exp),
+            CYPHER_AST_HAS_PATTERN | CYPHER_AST_HAS_IDENTIFIER);
+}
+END_TEST
+
+
+START_TEST (unresolved_functions_are_not_aggregates)
+{
+    result = cypher_parse("RETURN count(*), rand();", NULL, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 0);
+
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 0);
+    const cypher_astnode_t *query = cypher_ast_statement_get_body(ast);
+    const cypher_astnode_t *clause = cypher_ast_query_get_clause(query, 0);
+
+    const cypher_astnode_t *exp = projection_expression(clause, 0);
+    ck_assert(!(cypher_astnode_attributes(exp) & CYPHER_AST_HAS_AGGREGATE));
+    ck_assert(cypher_astnode_attributes(exp) &
+            CYPHER_AST_HAS_UNRESOLVED_FUNCTION);
+    exp = projection_expression(clause, 1);
+    ck_assert(!(cypher_astnode_attributes(exp) &
+            CYPHER_AST_HAS_NONDETERMINISTIC));
+    ck_assert(!(cypher_astnode_attributes(exp) & CYPHER_AST_IS_CONSTANT));
+}
+END_TEST
+
+
+START_TEST (unknown_functions_are_not_constant)
+{
+    result = cypher_parse("RETURN myFunction(1) + 2, toUpper('a');",
+            NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 0);
+
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 0);
+    const cypher_astnode_t *query = cypher_ast_statement_get_body(ast);
+    const cypher_astnode_t *clause = cypher_ast_query_get_clause(query, 0);
+
+    const cypher_astnode_t *exp = projection_expression(clause, 0);
+    ck_assert_int_eq(cypher_astnode_attributes(exp),
+            CYPHER_AST_HAS_UNRESOLVED_FUNCTION);
+    exp = projection_expression(clause, 1);
+    ck_assert_int_eq(cypher_astnode_attributes(exp), CYPHER_AST_IS_CONSTANT);
+}
+END_TEST
+
+
+START_TEST (propagate_attributes_to_statement)
+{
+    result = cypher_parse("MATCH (n) WHERE n.x = $x SET n.y = 1 RETURN n;",
+            NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 0);
+
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 0);
+    ck_assert_int_eq(cypher_astnode_attributes(ast),
+            CYPHER_AST_HAS_PARAMETER | CYPHER_AST_HAS_PATTERN |
+            CYPHER_AST_HAS_UPDATE | CYPHER_AST_HAS_IDENTIFIER);
+
+    const cypher_astnode_t *query = cypher_ast_statement_get_body(ast);
+    const cypher_astnode_t *clause = cypher_ast_query_get_clause(query, 0);
+    ck_assert_int_eq(cypher_astnode_attributes(clause),
+            CYPHER_AST_HAS_PARAMETER | CYPHER_AST_HAS_PATTERN |
+            CYPHER_AST_HAS_IDENTIFIER);
+    clause = cypher_ast_query_get_clause(query, 1);
+    ck_assert_int_eq(cypher_astnode_attributes(clause),
+            CYPHER_AST_HAS_UPDATE | CYPHER_AST_HAS_IDENTIFIER);
+}
+END_TEST
+
+
+START_TEST (preserve_attributes_when_cloning)
+{
+    result = cypher_parse("MATCH (n) RETURN sum(n.x) + rand() AS s;",
+            NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 0);
+
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 0);
+    cypher_astnode_t *clone = cypher_ast_clone(ast);
+    ck_assert_ptr_ne(clone, NULL);
+    ck_assert_int_eq(cypher_astnode_attributes(clone),
+            cypher_astnode_attributes(ast));
+    ck_assert_int_eq(cypher_astnode_subtree_size(clone),
+            cypher_astnode_subtree_size(ast));
+    ck_assert_int_eq(cypher_astnode_depth(clone), cypher_astnode_depth(ast));
+    check_sizes(clone);
+    cypher_ast_free(clone);
+}
+END_TEST
+
+
+TCase* attributes_tcase(void)
+{
+    TCase *tc = tcase_create("attributes");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, compute_subtree_size_and_depth);
+    tcase_add_test(tc, compute_expression_attributes);
+    tcase_add_test(tc, unresolved_functions_are_not_aggregates);
+    tcase_add_test(tc, unknown_functions_are_not_constant);
+    tcase_add_test(tc, propagate_attributes_to_statement);
+    tcase_add_test(tc, preserve_attributes_when_cloning);
+    return tc;
+}
@@ -0,0 +1,264 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "../../lib/src/cypher-parser.h"
+#include <check.h>
+#include <errno.h>
+#include <string.h>
+
+
+static cypher_parse_result_t *result;
+static cypher_parse_result_t *expected_result;
+static const cypher_value_t *params;
+static cypher_bound_ast_t *bound;
+
+
+static void setup(void)
+{
+    result = NULL;
+    expected_result = NULL;
+    params = NULL;
+    bound = NULL;
+}
+
+
+static void teardown(void)
+{
+    cypher_bound_ast_free(bound);
+    cypher_value_free(params);
+    cypher_parse_result_free(result);
+    cypher_parse_result_free(expected_result);
+}
+
+
+static const cypher_astnode_t *parse(const char *s,
+        cypher_parse_result_t **result)
+{
+    *result = cypher_parse(s, NULL, NULL, CYPHER_PARSE_ONLY_STATEMENTS);
+    ck_assert_ptr_ne(*result, NULL);
+    ck_assert_int_eq(cypher_parse_result_nerrors(*result), 0);
+    ck_assert_int_eq(cypher_parse_result_ndirectives(*result), 1);
+    return cypher_parse_result_get_directive(*result, 0);
+}
+
+
+static void parse_params(const char *s)
+{
+    ck_assert_int_eq(cypher_parse_value(s, strlen(s), &params), 0);
+}
+
+
+static const cypher_value_t *lookup(void *userdata, const char *name,
+        size_t n)
+{
+    return cypher_value_map_get(userdata, name, n);
+}
+
+
+static uint64_t hash(const cypher_astnode_t *ast)
+{
+    uint64_t h;
+    ck_assert_int_eq(cypher_ast_canonical_hash(ast, &h), 0);
+    return h;
+}
+
+
+static void assert_shared(const cypher_astnode_t *node,
+        const cypher_astnode_t *original)
+{
+    if (!(cypher_astnode_attributes(original) & CYPHER_AST_HAS_PARAMETER))
+    {
+        ck_assert_ptr_eq(node, original);
+        return;
+    }
+    if (cypher_astnode_type(original) == CYPHER_AST_PARAMETER)
+    {
+        return;
+    }
+    ck_assert_ptr_ne(node, original);
+    unsigned int n = cypher_astnode_nchildren(original);
+    ck_assert_int_eq(cypher_astnode_nchildren(node), n);
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        assert_shared(cypher_astnode_get_child(node, i),
+                cypher_astnode_get_child(original, i));
+    }
+}
+
+
+START_TEST (bind_scalar_parameters)
+{
+    const cypher_astnode_t *ast = parse(
+            "RETURN $a + 1 AS x, $b AS y, $c AS z, $d AS w, $e AS v",
+            &result);
+    parse_params("{a: 5, b: 'hi', c: true, d: null, e: 3.0}");
+
+    bound = cypher_ast_bind_parameters(ast, lookup, (void *)params);
+    ck_assert_ptr_ne(bound, NULL);
+    ck_assert_int_eq(cypher_bound_ast_nbound(bound), 5);
+
+    const cypher_astnode_t *root = cypher_bound_ast_get_root(bound);
+    ck_assert(!(cypher_astnode_attributes(root) & CYPHER_AST_HAS_PARAMETER));
+    ck_assert(cypher_astnode_attributes(ast) & CYPHER_AST_HAS_PARAMETER);
+
+    const cypher_astnode_t *expected = parse(
+            "RETURN 5 + 1 AS x, 'hi' AS y, true AS z, null AS w, 3.0 AS v",
+            &expected_result);
+    ck_assert(hash(root) == hash(expected));
+}
+END_TEST
+
+
+START_TEST (bind_negative_numbers)
+{
+    const cypher_astnode_t *ast = parse(
+            "RETURN $a AS a, $b AS b, [$c] AS c", &result);
+    parse_params("{a: -5, b: -2.5, c: -1}");
+
+    bound = cypher_ast_bind_parameters(ast, lookup, (void *)params);
+    ck_assert_ptr_ne(bound, NULL);
+    ck_assert_int_eq(cypher_bound_ast_nbound(bound), 3);
+
+    // negative literals are parsed as a unary minus on the magnitude
+    const cypher_astnode_t *expected = parse(
+            "RETURN -5 AS a, -2.5 AS b, [-1] AS c", &expected_result);
+    ck_assert(hash(cypher_bound_ast_get_root(bound)) == hash(expected));
+}
+END_TEST
+
+
+START_TEST (share_subtrees_without_parameters)
+{
+    const cypher_astnode_t *ast = parse(
+            "MATCH (n:Foo)-[:BAR]->(m) WHERE n.x = $a "
+            "WITH n, m ORDER BY n.y RETURN m.z AS z, $b AS b", &result);
+    parse_params("{a: 1, b: [2, 3]}");
+
+    bound = cypher_ast_bind_parameters(ast, lookup, (void *)params);
+    ck_assert_ptr_ne(bound, NULL);
+    ck_assert_int_eq(cypher_bound_ast_nbound(bound), 2);
+    assert_shared(cypher_bound_ast_get_root(bound), ast);
+
+    // the copied path is small relative to the shared tree
+    const cypher_astnode_t *root = cypher_bound_ast_get_root(bound);
+    ck_assert_int_eq(cypher_astnode_subtree_size(root),
+            cypher_astnode_subtree_size(ast) + 2);
+}
+END_TEST
+
+
+START_TEST (leave_unknown_parameters_unbound)
+{
+    const cypher_astnode_t *ast = parse(
+            "MATCH (n) WHERE n.x = $a RETURN $b AS b", &result);
+    parse_params("{b: 'x'}");
+
+    bound = cypher_ast_bind_parameters(ast, lookup, (void *)params);
+    ck_assert_ptr_ne(bound, NULL);
+    ck_assert_int_eq(cypher_bound_ast_nbound(bound), 1);
+    const cypher_astnode_t *root = cypher_bound_ast_get_root(bound);
+    ck_assert(cypher_astnode_attributes(root) & CYPHER_AST_HAS_PARAMETER);
+
+    const cypher_astnode_t *expected = parse(
+            "MATCH (n) WHERE n.x = $a RETURN 'x' AS b", &expected_result);
+    ck_assert(hash(root) == hash(expected));
+
+    cypher_bound_ast_free(bound);
+    cypher_value_free(params);
+    parse_params("{}");
+    bound = cypher_ast_bind_parameters(ast, lookup, (void *)params);
+    ck_assert_ptr_ne(bound, NULL);
+    ck_assert_int_eq(cypher_bound_ast_nbound(bound), 0);
+    ck_assert_ptr_eq(cypher_bound_ast_get_root(bound), ast);
+}
+END_TEST
+
+
+START_TEST (bind_collection_and_map_values)
+{
+    const cypher_astnode_t *ast = parse(
+            "CREATE (n:Foo $props) RETURN $list AS l", &result);
+    parse_params("{props: {a: 1, b: 'two'}, list: [1, {k: 2.5}, [null]]}");
+
+    bound = cypher_ast_bind_parameters(ast, lookup, (void *)params);
+    ck_assert_ptr_ne(bound, NULL);
+    ck_assert_int_eq(cypher_bound_ast_nbound(bound), 2);
+
+    const cypher_astnode_t *expected = parse(
+            "CREATE (n:Foo {a: 1, b: 'two'}) RETURN [1, {k: 2.5}, [null]] AS l",
+            &expected_result);
+    ck_assert(hash(cypher_bound_ast_get_root(bound)) == hash(expected));
+}
+END_TEST
+
+
+START_TEST (bind_repeated_parameters)
+{
+    const cypher_astnode_t *ast = parse(
+            "MATCH (n) WHERE n.x = $a OR n.y = $a RETURN n", &result);
+    parse_params("{a: 'v'}");
+
+    bound = cypher_ast_bind_parameters(ast, lookup, (void *)params);
+    ck_assert_ptr_ne(bound, NULL);
+    ck_assert_int_eq(cypher_bound_ast_nbound(bound), 2);
+
+    const cypher_astnode_t *expected = parse(
+            "MATCH (n) WHERE n.x = 'v' OR n.y = 'v' RETURN n",
+            &expected_result);
+    ck_assert(hash(cypher_bound_ast_get_root(bound)) == hash(expected));
+}
+END_TEST
+
+
+START_TEST (fail_to_bind_value_in_invalid_position)
+{
+    const cypher_astnode_t *ast = parse(
+            "MATCH (n $props) WHERE n.x = $a RETURN n", &result);
+    parse_params("{a: 1, props: 1}");
+
+    ck_assert_ptr_eq(cypher_ast_bind_parameters(ast, lookup, (void *)params),
+            NULL);
+    ck_assert_int_eq(errno, EINVAL);
+}
+END_TEST
+
+
+START_TEST (fail_to_bind_null)
+{
+    const cypher_astnode_t *ast = parse("RETURN $a AS a", &result);
+    ck_assert_ptr_eq(cypher_ast_bind_parameters(NULL, lookup, NULL), NULL);
+    ck_assert_int_eq(errno, EINVAL);
+    ck_assert_ptr_eq(cypher_ast_bind_parameters(ast, NULL, NULL), NULL);
+    ck_assert_int_eq(errno, EINVAL);
+}
+END_TEST
+
+
+TCase* bind_tcase(void)
+{
+    TCase *tc = tcase_create("bind");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, bind_scalar_parameters);
+    tcase_add_test(tc, bind_negative_numbers);
+    tcase_add_test(tc, share_subtrees_without_parameters);
+    tcase_add_test(tc, leave_unknown_parameters_unbound);
+    tcase_add_test(tc, bind_collection_and_map_values);
+    tcase_add_test(tc, bind_repeated_parameters);
+    tcase_add_test(tc, fail_to_bind_value_in_invalid_position);
+    tcase_add_test(tc, fail_to_bind_null);
+    return tc;
+}
@@ -0,0 +1,235 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "../../lib/src/cypher-parser.h"
+#include <check.h>
+#include <errno.h>
+#include <string.h>
+
+
+static cypher_parse_result_t *result1;
+static cypher_parse_result_t *result2;
+static cypher_astnode_t *canonical1;
+static cypher_astnode_t *canonical2;
+
+
+static void setup(void)
+{
+    result1 = NULL;
+    result2 = NULL;
+    canonical1 = NULL;
+    canonical2 = NULL;
+}
+
+
+static void teardown(void)
+{
+    cypher_ast_free(canonical1);
+    cypher_ast_free(canonical2);
+    cypher_parse_result_free(result1);
+    cypher_parse_result_free(result2);
+}
+
+
+static const cypher_astnode_t *parse(const char *s,
+        cypher_parse_result_t **result)
+{
+    *result = cypher_parse(s, NULL, NULL, CYPHER_PARSE_ONLY_STATEMENTS);
+    ck_assert_ptr_ne(*result, NULL);
+    ck_assert_int_eq(cypher_parse_result_nerrors(*result), 0);
+    ck_assert_int_eq(cypher_parse_result_ndirectives(*result), 1);
+    return cypher_parse_result_get_directive(*result, 0);
+}
+
+
+static bool same_hash(const char *s1, const char *s2)
+{
+    uint64_t hash1;
+    uint64_t hash2;
+    ck_assert(cypher_ast_canonical_hash(parse(s1, &result1), &hash1) == 0);
+    ck_assert(cypher_ast_canonical_hash(parse(s2, &result2), &hash2) == 0);
+    cypher_parse_result_free(result1);
+    cypher_parse_result_free(result2);
+    result1 = NULL;
+    result2 = NULL;
+    return hash1 == hash2;
+}
+
+
+static void assert_same_structure(const cypher_astnode_t *node1,
+        const cypher_astnode_t *node2)
+{
+    ck_assert_int_eq(cypher_astnode_type(node1), cypher_astnode_type(node2));
+    unsigned int n = cypher_astnode_nchildren(node1);
+    ck_assert_int_eq(cypher_astnode_nchildren(node2), n);
+    if (n == 0)
+    {
+        // the hash of a leaf covers its value
+        uint64_t hash1;
+        uint64_t hash2;
+        ck_assert(cypher_ast_canonical_hash(node1, &hash1) == 0);
+        ck_assert(cypher_ast_canonical_hash(node2, &hash2) == 0);
+        ck_assert(hash1 == hash2);
+    }
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        assert_same_structure(cypher_astnode_get_child(node1, i),
+                cypher_astnode_get_child(node2, i));
+    }
+}
+
+
+START_TEST (hash_commutative_operands_in_any_order)
+{
+    ck_assert(same_hash("MATCH (n) WHERE n.x = 1 AND n.y = 2 RETURN n",
+                "MATCH (n) WHERE n.y = 2 AND 1 = n.x RETURN n"));
+    ck_assert(same_hash("RETURN a OR b XOR c AS x",
+                "RETURN (c XOR b) OR a AS x"));
+    ck_assert(same_hash("RETURN a <> b AS x", "RETURN b <> a AS x"));
+    ck_assert(same_hash("RETURN 1 + 2.5 AS x", "RETURN 2.5 + 1 AS x"));
+}
+END_TEST
+
+
+START_TEST (hash_non_commutative_operands_in_order)
+{
+    ck_assert(!same_hash("RETURN a - b AS x", "RETURN b - a AS x"));
+    ck_assert(!same_hash("RETURN a < b AS x", "RETURN b < a AS x"));
+    ck_assert(!same_hash("RETURN 'a' + 'b' AS x", "RETURN 'b' + 'a' AS x"));
+    ck_assert(!same_hash("RETURN a + 1 AS x", "RETURN 1 + a AS x"));
+    ck_assert(!same_hash("RETURN a = b = c AS x", "RETURN c = b = a AS x"));
+}
+END_TEST
+
+
+START_TEST (hash_distinguishes_operators_and_values)
+{
+    ck_assert(!same_hash("RETURN a AND b AS x", "RETURN a OR b AS x"));
+    ck_assert(!same_hash("RETURN a = 1 AS x", "RETURN a = 2 AS x"));
+    ck_assert(!same_hash("MATCH (n) RETURN n", "MATCH (m) RETURN m"));
+    ck_assert(!same_hash("RETURN 'a@1' AS x", "RETURN 'a@2' AS x"));
+    ck_assert(same_hash("RETURN  1 AS x", "RETURN 1   AS x"));
+}
+END_TEST
+
+
+START_TEST (hash_map_entries_in_any_order)
+{
+    ck_assert(same_hash("RETURN {a: 1, b: 'x', c: [1]} AS m",
+                "RETURN {c: [1], a: 1, b: 'x'} AS m"));
+    ck_assert(!same_hash("RETURN {a: 1, b: 2} AS m",
+                "RETURN {a: 2, b: 1} AS m"));
+    // the relative order of duplicate keys is significant
+    ck_assert(!same_hash("RETURN {a: 1, a: 2} AS m",
+                "RETURN {a: 2, a: 1} AS m"));
+}
+END_TEST
+
+
+START_TEST (hash_labels_and_reltypes_in_any_order)
+{
+    ck_assert(same_hash("MATCH (n:A:B:C) RETURN n",
+                "MATCH (n:C:A:B) RETURN n"));
+    ck_assert(same_hash("MATCH (n)-[:X|Y]->(m) RETURN n",
+                "MATCH (n)-[:Y|X]->(m) RETURN n"));
+    ck_assert(!same_hash("MATCH (n)-[:X|Y]->(m) RETURN n",
+                "MATCH (n)<-[:Y|X]-(m) RETURN n"));
+}
+END_TEST
+
+
+START_TEST (canonicalize_permuted_statements_identically)
+{
+    const cypher_astnode_t *ast1 = parse(
+            "MATCH (n:B:A {y: 2, x: 1})-[:S|R]-() "
+            "WHERE n.y = 2 AND 1 = n.x RETURN n", &result1);
+    const cypher_astnode_t *ast2 = parse(
+            "MATCH (n:A:B {x: 1, y: 2})-[:R|S]-() "
+            "WHERE n.x = 1 AND n.y = 2 RETURN n", &result2);
+
+    canonical1 = cypher_ast_canonicalize(ast1);
+    ck_assert_ptr_ne(canonical1, NULL);
+    canonical2 = cypher_ast_canonicalize(ast2);
+    ck_assert_ptr_ne(canonical2, NULL);
+    assert_same_structure(canonical1, canonical2);
+
+    uint64_t hash1;
+    uint64_t hash2;
+    ck_assert(cypher_ast_canonical_hash(ast1, &hash1) == 0);
+    ck_assert(cypher_ast_canonical_hash(canonical1, &hash2) == 0);
+    ck_assert(hash1 == hash2);
+}
+END_TEST
+
+
+START_TEST (canonicalize_retains_node_accessors)
+{
+    const cypher_astnode_t *ast = parse("RETURN {b: 2, a: 1} AS m",
+            &result1);
+    canonical1 = cypher_ast_canonicalize(ast);
+    ck_assert_ptr_ne(canonical1, NULL);
+
+    const cypher_astnode_t *query = cypher_ast_statement_get_body(canonical1);
+    const cypher_astnode_t *clause = cypher_ast_query_get_clause(query, 0);
+    const cypher_astnode_t *proj = cypher_ast_return_get_projection(clause, 0);
+    const cypher_astnode_t *map = cypher_ast_projection_get_expression(proj);
+    ck_assert_int_eq(cypher_astnode_type(map), CYPHER_AST_MAP);
+    ck_assert_int_eq(cypher_ast_map_nentries(map), 2);
+
+    const cypher_astnode_t *value = cypher_ast_map_find(map, "a", 1);
+    ck_assert_str_eq(cypher_ast_integer_get_valuestr(value), "1");
+    value = cypher_ast_map_find(map, "b", 1);
+    ck_assert_str_eq(cypher_ast_integer_get_valuestr(value), "2");
+
+    // keys and values are reordered together
+    for (unsigned int i = 0; i < 2; ++i)
+    {
+        const char *key = cypher_ast_prop_name_get_value(
+                cypher_ast_map_get_key(map, i));
+        value = cypher_ast_map_get_value(map, i);
+        ck_assert_str_eq(cypher_ast_integer_get_valuestr(value),
+                (strcmp(key, "a") == 0)? "1" : "2");
+    }
+}
+END_TEST
+
+
+START_TEST (fail_to_canonicalize_null)
+{
+    uint64_t hash;
+    ck_assert_ptr_eq(cypher_ast_canonicalize(NULL), NULL);
+    ck_assert_int_eq(errno, EINVAL);
+    ck_assert_int_eq(cypher_ast_canonical_hash(NULL, &hash), -1);
+    ck_assert_int_eq(errno, EINVAL);
+}
+END_TEST
+
+
+TCase* canonical_tcase(void)
+{
+    TCase *tc = tcase_create("canonical");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, hash_commutative_operands_in_any_order);
+    tcase_add_test(tc, hash_non_commutative_operands_in_order);
+    tcase_add_test(tc, hash_distinguishes_operators_and_values);
+    tcase_add_test(tc, hash_map_entries_in_any_order);
+    tcase_add_test(tc, hash_labels_and_reltypes_in_any_order);
+    tcase_add_test(tc, canonicalize_permuted_statements_identically);
+    tcase_add_test(tc, canonicalize_retains_node_accessors);
+    tcase_add_test(tc, fail_to_canonicalize_null);
+    return tc;
+}
@@ -0,0 +1,260 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "../../lib/src/cypher-parser.h"
+#include <check.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+
+static char path[32];
+static cypher_parser_config_t *config;
+static cypher_capture_t *capture;
+static cypher_parse_result_t *result;
+static char *data;
+static size_t size;
+
+
+static void setup(void)
+{
+    strcpy(path, "/tmp/check_capture_XXXXXX");
+    int fd = mkstemp(path);
+    ck_assert_int_ge(fd, 0);
+    close(fd);
+    config = cypher_parser_new_config();
+    ck_assert_ptr_ne(config, NULL);
+    capture = NULL;
+    result = NULL;
+    data = NULL;
+    size = 0;
+}
+
+
+static void teardown(void)
+{
+    cypher_quick_parser_set_capture(NULL);
+    cypher_parse_result_free(result);
+    cypher_parser_config_free(config);
+    ck_assert(cypher_capture_close(capture) == 0);
+    free(data);
+    unlink(path);
+}
+
+
+static void use_capture(double sample_rate, uint64_t max_size)
+{
+    capture = cypher_capture_open(path, sample_rate, max_size);
+    ck_assert_ptr_ne(capture, NULL);
+    cypher_parser_config_set_capture(config, capture);
+}
+
+
+static void read_capture(void)
+{
+    ck_assert(cypher_capture_close(capture) == 0);
+    capture = NULL;
+
+    FILE *stream = fopen(path, "rb");
+    ck_assert_ptr_ne(stream, NULL);
+    ck_assert(fseek(stream, 0, SEEK_END) == 0);
+    size = ftell(stream);
+    rewind(stream);
+    data = malloc(size);
+    ck_assert_ptr_ne(data, NULL);
+    ck_assert_int_eq(fread(data, 1, size, stream), size);
+    fclose(stream);
+
+    ck_assert_int_ge(size, CYPHER_CAPTURE_MAGIC_LENGTH);
+    ck_assert(memcmp(data, CYPHER_CAPTURE_MAGIC,
+                CYPHER_CAPTURE_MAGIC_LENGTH) == 0);
+}
+
+
+static size_t get_record(size_t offset, struct cypher_capture_record *record,
+        const char **input)
+{
+    ck_assert_int_le(offset + sizeof(*record), size);
+    memcpy(record, data + offset, sizeof(*record));
+    offset += sizeof(*record);
+    ck_assert_int_le(offset + record->length, size);
+    *input = data + offset;
+    return offset + record->length;
+}
+
+
+static int quick_callback(void *userdata,
+        const cypher_quick_parse_segment_t *segment)
+{
+    return 0;
+}
+
+
+START_TEST (capture_parse_inputs)
+{
+    use_capture(1, 0);
+    result = cypher_parse("RETURN 1;", NULL, config,
+            CYPHER_PARSE_ONLY_STATEMENTS);
+    ck_assert_ptr_ne(result, NULL);
+    cypher_parse_result_free(result);
+    result = cypher_parse("MATCH (n) RETURN n", NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_capture_nrecorded(capture), 2);
+    read_capture();
+
+    struct cypher_capture_record record;
+    const char *input;
+    size_t offset = get_record(CYPHER_CAPTURE_MAGIC_LENGTH, &record, &input);
+    ck_assert_int_eq(record.kind, CYPHER_CAPTURE_PARSE);
+    ck_assert_int_eq(record.flags, CYPHER_PARSE_ONLY_STATEMENTS);
+    ck_assert_int_eq(record.length, 9);
+    ck_assert(memcmp(input, "RETURN 1;", 9) == 0);
+    uint64_t time = record.time;
+
+    offset = get_record(offset, &record, &input);
+    ck_assert_int_eq(record.kind, CYPHER_CAPTURE_PARSE);
+    ck_assert_int_eq(record.flags, 0);
+    ck_assert_int_eq(record.length, 18);
+    ck_assert(memcmp(input, "MATCH (n) RETURN n", 18) == 0);
+    ck_assert(record.time >= time);
+    ck_assert_int_eq(offset, size);
+}
+END_TEST
+
+
+START_TEST (capture_quick_parse_inputs)
+{
+    use_capture(1, 0);
+    cypher_quick_parser_set_capture(capture);
+    ck_assert(cypher_quick_parse("RETURN 1; :help", quick_callback, NULL,
+                CYPHER_PARSE_SINGLE) == 0);
+    read_capture();
+
+    struct cypher_capture_record record;
+    const char *input;
+    size_t offset = get_record(CYPHER_CAPTURE_MAGIC_LENGTH, &record, &input);
+    ck_assert_int_eq(record.kind, CYPHER_CAPTURE_QUICK_PARSE);
+    ck_assert_int_eq(record.flags, CYPHER_PARSE_SINGLE);
+    ck_assert_int_eq(record.length, 15);
+    ck_assert(memcmp(input, "RETURN 1; :help", 15) == 0);
+    ck_assert_int_eq(offset, size);
+}
+END_TEST
+
+
+START_TEST (sample_inputs)
+{
+    use_capture(0.25, 0);
+    for (unsigned int i = 0; i < 20; ++i)
+    {
+        result = cypher_parse("RETURN 1;", NULL, config, 0);
+        ck_assert_ptr_ne(result, NULL);
+        cypher_parse_result_free(result);
+        result = NULL;
+    }
+    ck_assert_int_eq(cypher_capture_nrecorded(capture), 5);
+    ck_assert_int_eq(cypher_capture_ndropped(capture), 0);
+}
+END_TEST
+
+
+START_TEST (drop_inputs_exceeding_size_limit)
+{
+    size_t record_size = sizeof(struct cypher_capture_record) + 9;
+    use_capture(1, CYPHER_CAPTURE_MAGIC_LENGTH + 2 * record_size);
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        result = cypher_parse("RETURN 1;", NULL, config, 0);
+        ck_assert_ptr_ne(result, NULL);
+        cypher_parse_result_free(result);
+        result = NULL;
+    }
+    ck_assert_int_eq(cypher_capture_nrecorded(capture), 2);
+    ck_assert_int_eq(cypher_capture_ndropped(capture), 1);
+    read_capture();
+    ck_assert_int_eq(size, CYPHER_CAPTURE_MAGIC_LENGTH + 2 * record_size);
+}
+END_TEST
+
+
+START_TEST (append_to_existing_capture)
+{
+    use_capture(1, 0);
+    result = cypher_parse("RETURN 1;", NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert(cypher_capture_close(capture) == 0);
+
+    use_capture(1, 0);
+    cypher_parse_result_free(result);
+    result = cypher_parse("RETURN 2;", NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+    read_capture();
+
+    struct cypher_capture_record record;
+    const char *input;
+    size_t offset = get_record(CYPHER_CAPTURE_MAGIC_LENGTH, &record, &input);
+    ck_assert(memcmp(input, "RETURN 1;", 9) == 0);
+    offset = get_record(offset, &record, &input);
+    ck_assert(memcmp(input, "RETURN 2;", 9) == 0);
+    ck_assert_int_eq(offset, size);
+}
+END_TEST
+
+
+START_TEST (fail_to_append_to_non_capture_file)
+{
+    FILE *stream = fopen(path, "wb");
+    ck_assert_ptr_ne(stream, NULL);
+    fputs("not a capture", stream);
+    fclose(stream);
+
+    ck_assert_ptr_eq(cypher_capture_open(path, 1, 0), NULL);
+    ck_assert_int_eq(errno, EINVAL);
+
+    stream = fopen(path, "rb");
+    ck_assert_ptr_ne(stream, NULL);
+    ck_assert(fseek(stream, 0, SEEK_END) == 0);
+    ck_assert_int_eq(ftell(stream), 13);
+    fclose(stream);
+}
+END_TEST
+
+
+START_TEST (fail_to_open_with_invalid_sample_rate)
+{
+    ck_assert_ptr_eq(cypher_capture_open(path, 0, 0), NULL);
+    ck_assert_int_eq(errno, EINVAL);
+    ck_assert_ptr_eq(cypher_capture_open(path, 1.5, 0), NULL);
+    ck_assert_int_eq(errno, EINVAL);
+}
+END_TEST
+
+
+TCase* capture_tcase(void)
+{
+    TCase *tc = tcase_create("capture");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, capture_parse_inputs);
+    tcase_add_test(tc, capture_quick_parse_inputs);
+    tcase_add_test(tc, sample_inputs);
+    tcase_add_test(tc, drop_inputs_exceeding_size_limit);
+    tcase_add_test(tc, append_to_existing_capture);
+    tcase_add_test(tc, fail_to_append_to_non_capture_file);
+    tcase_add_test(tc, fail_to_open_with_invalid_sample_rate);
+    return tc;
+}
@@ -0,0 +1,227 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "../../lib/src/cypher-parser.h"
+#include <check.h>
+#include <errno.h>
+
+
+static cypher_catalog_t *catalog;
+static cypher_parser_config_t *config;
+static cypher_parse_result_t *result;
+
+
+static void setup(void)
+{
+    catalog = cypher_catalog_new(true);
+    ck_assert_ptr_ne(catalog, NULL);
+    config = cypher_parser_new_config();
+    ck_assert_ptr_ne(config, NULL);
+    cypher_parser_config_set_catalog(config, catalog);
+    result = NULL;
+}
+
+
+static void teardown(void)
+{
+    cypher_parse_result_free(result);
+    cypher_parser_config_free(config);
+    cypher_catalog_free(catalog);
+}
+
+
+START_TEST (find_builtins)
+{
+    ck_assert_int_eq(cypher_catalog_find_function(catalog, "count", 5),
+            CYPHER_FUNCTION_COUNT);
+    ck_assert_int_eq(cypher_catalog_find_function(catalog, "COUNT", 5),
+            CYPHER_FUNCTION_COUNT);
+    ck_assert_int_eq(cypher_catalog_find_function(catalog, "toUpper", 7),
+            CYPHER_FUNCTION_TO_UPPER);
+    ck_assert_int_eq(cypher_catalog_find_function(catalog, "counter", 7), -1);
+    ck_assert_int_eq(cypher_catalog_find_function(catalog, "coun", 4), -1);
+    ck_assert_int_eq(cypher_catalog_find_function(catalog, "", 0), -1);
+
+    for (int i = 0; i < CYPHER_NBUILTIN_FUNCTIONS; ++i)
+    {
+        const struct cypher_catalog_entry *e =
+                cypher_catalog_get_function(catalog, i);
+        ck_assert_ptr_ne(e, NULL);
+        ck_assert_int_eq(cypher_catalog_find_function(catalog, e->name,
+                    strlen(e->name)), i);
+    }
+    ck_assert_ptr_eq(cypher_catalog_get_function(catalog,
+                CYPHER_NBUILTIN_FUNCTIONS), NULL);
+    ck_assert_ptr_eq(cypher_catalog_get_function(catalog, -1), NULL);
+
+    const struct cypher_catalog_entry *e =
+            cypher_catalog_get_function(catalog, CYPHER_FUNCTION_SUM);
+    ck_assert_str_eq(e->name, "sum");
+    ck_assert_int_eq(e->min_args, 1);
+    ck_assert_int_eq(e->max_args, 1);
+    ck_assert(e->flags & CYPHER_CATALOG_AGGREGATE);
+    e = cypher_catalog_get_function(catalog, CYPHER_FUNCTION_ABS);
+    ck_assert(!(e->flags & CYPHER_CATALOG_AGGREGATE));
+
+    ck_assert_int_eq(cypher_catalog_find_procedure(catalog, "db.labels", 9),
+            CYPHER_PROCEDURE_DB_LABELS);
+    ck_assert_int_eq(cypher_catalog_find_procedure(catalog, "db.Labels", 9),
+            -1);
+}
+END_TEST
+
+
+START_TEST (add_functions_and_procedures)
+{
+    cypher_catalog_t *empty = cypher_catalog_new(false);
+    ck_assert_ptr_ne(empty, NULL);
+    ck_assert_int_eq(cypher_catalog_find_function(empty, "count", 5), -1);
+
+    char name[32];
+    for (int i = 0; i < 200; ++i)
+    {
+        snprintf(name, sizeof(name), "my.fn%d", i);
+        ck_assert_int_eq(cypher_catalog_add_function(empty, name, 0,
+                    CYPHER_CATALOG_UNBOUNDED, 0), i);
+    }
+    for (int i = 0; i < 200; ++i)
+    {
+        snprintf(name, sizeof(name), "MY.FN%d", i);
+        ck_assert_int_eq(cypher_catalog_find_function(empty, name,
+                    strlen(name)), i);
+    }
+
+    ck_assert_int_eq(cypher_catalog_add_function(empty, "My.Fn7", 1, 1, 0),
+            -1);
+    ck_assert_int_eq(errno, EEXIST);
+    ck_assert_int_eq(cypher_catalog_add_function(empty, "bad", 2, 1, 0), -1);
+    ck_assert_int_eq(errno, EINVAL);
+
+    ck_assert_int_eq(cypher_catalog_add_procedure(empty, "my.proc", 1, 2, 0),
+            0);
+    ck_assert_int_eq(cypher_catalog_add_procedure(empty, "my.Proc", 1, 2, 0),
+            1);
+    ck_assert_int_eq(cypher_catalog_find_procedure(empty, "my.Proc", 7), 1);
+    ck_assert_int_eq(cypher_catalog_find_function(empty, "my.proc", 7), -1);
+    cypher_catalog_free(empty);
+
+    ck_assert_int_eq(cypher_catalog_add_function(catalog, "myAgg", 1, 1,
+                CYPHER_CATALOG_AGGREGATE), CYPHER_NBUILTIN_FUNCTIONS);
+    ck_assert_int_eq(cypher_catalog_find_function(catalog, "count", 5),
+            CYPHER_FUNCTION_COUNT);
+}
+END_TEST
+
+
+START_TEST (resolve_function_names)
+{
+    ck_assert_int_eq(cypher_catalog_add_function(catalog, "myAgg", 1, 1,
+                CYPHER_CATALOG_AGGREGATE), CYPHER_NBUILTIN_FUNCTIONS);
+
+    result = cypher_parse("RETURN toUpper(n.name), Count(*), foo(1), "
+            "1 + myagg(n.x) AS s;", NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 0);
+
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 0);
+    const cypher_astnode_t *query = cypher_ast_statement_get_body(ast);
+    const cypher_astnode_t *clause = cypher_ast_query_get_clause(query, 0);
+    ck_assert_int_eq(cypher_astnode_type(clause), CYPHER_AST_RETURN);
+
+    const cypher_astnode_t *proj = cypher_ast_return_get_projection(clause, 0);
+    const cypher_astnode_t *exp = cypher_ast_projection_get_expression(proj);
+    const cypher_astnode_t *name =
+            cypher_ast_apply_operator_get_func_name(exp);
+    ck_assert_int_eq(cypher_ast_function_name_get_id(name),
+            CYPHER_FUNCTION_TO_UPPER);
+    ck_assert_int_eq(cypher_ast_function_name_get_flags(name), 0);
+    ck_assert(!cypher_ast_projection_has_aggregate(proj));
+
+    proj = cypher_ast_return_get_projection(clause, 1);
+    exp = cypher_ast_projection_get_expression(proj);
+    ck_assert_int_eq(cypher_astnode_type(exp), CYPHER_AST_APPLY_ALL_OPERATOR);
+    name = cypher_ast_apply_all_operator_get_func_name(exp);
+    ck_assert_int_eq(cypher_ast_function_name_get_id(name),
+            CYPHER_FUNCTION_COUNT);
+    ck_assert(cypher_ast_function_name_get_flags(name) &
+            CYPHER_CATALOG_AGGREGATE);
+    ck_assert(cypher_ast_projection_has_aggregate(proj));
+
+    proj = cypher_ast_return_get_projection(clause, 2);
+    exp = cypher_ast_projection_get_expression(proj);
+    name = cypher_ast_apply_operator_get_func_name(exp);
+    ck_assert_int_eq(cypher_ast_function_name_get_id(name), -1);
+    ck_assert(!cypher_ast_projection_has_aggregate(proj));
+
+    proj = cypher_ast_return_get_projection(clause, 3);
+    ck_assert(cypher_ast_projection_has_aggregate(proj));
+}
+END_TEST
+
+
+START_TEST (resolve_proc_names)
+{
+    result = cypher_parse("CALL db.labels(); CALL db.foo();",
+            NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 0);
+
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 0);
+    const cypher_astnode_t *query = cypher_ast_statement_get_body(ast);
+    const cypher_astnode_t *clause = cypher_ast_query_get_clause(query, 0);
+    const cypher_astnode_t *proc = cypher_ast_call_get_proc_name(clause);
+    ck_assert_int_eq(cypher_ast_proc_name_get_id(proc),
+            CYPHER_PROCEDURE_DB_LABELS);
+
+    ast = cypher_parse_result_get_directive(result, 1);
+    query = cypher_ast_statement_get_body(ast);
+    clause = cypher_ast_query_get_clause(query, 0);
+    proc = cypher_ast_call_get_proc_name(clause);
+    ck_assert_int_eq(cypher_ast_proc_name_get_id(proc), -1);
+}
+END_TEST
+
+
+START_TEST (unresolved_without_catalog)
+{
+    result = cypher_parse("RETURN count(*), sum(x);", NULL, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 0);
+    const cypher_astnode_t *query = cypher_ast_statement_get_body(ast);
+    const cypher_astnode_t *clause = cypher_ast_query_get_clause(query, 0);
+    const cypher_astnode_t *proj = cypher_ast_return_get_projection(clause, 1);
+    const cypher_astnode_t *exp = cypher_ast_projection_get_expression(proj);
+    const cypher_astnode_t *name =
+            cypher_ast_apply_operator_get_func_name(exp);
+    ck_assert_int_eq(cypher_ast_function_name_get_id(name), -1);
+    ck_assert(!cypher_ast_projection_has_aggregate(proj));
+}
+END_TEST
+
+
+TCase* catalog_tcase(void)
+{
+    TCase *tc = tcase_create("catalog");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, find_builtins);
+    tcase_add_test(tc, add_functions_and_procedures);
+    tcase_add_test(tc, resolve_function_names);
+    tcase_add_test(tc, resolve_proc_names);
+    tcase_add_test(tc, unresolved_without_catalog);
+    return tc;
+}
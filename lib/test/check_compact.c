@@ -0,0 +1,231 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "../../lib/src/cypher-parser.h"
+#include "memstream.h"
+#include <check.h>
+#include <errno.h>
+#include <unistd.h>
+
+
+static cypher_parse_result_t *result;
+static char *memstream_buffer;
+static size_t memstream_size;
+static FILE *memstream;
+static char *expected;
+static unsigned released;
+
+
+static void setup(void)
+{
+    result = NULL;
+    expected = NULL;
+    released = 0;
+    memstream = open_memstream(&memstream_buffer, &memstream_size);
+}
+
+
+static void teardown(void)
+{
+    cypher_parse_result_free(result);
+    fclose(memstream);
+    free(memstream_buffer);
+    free(expected);
+}
+
+
+static void print_and_reset(void)
+{
+    ck_assert(cypher_parse_result_fprint_ast(result, memstream, 0, NULL, 0) == 0);
+    fflush(memstream);
+    free(expected);
+    expected = strdup(memstream_buffer);
+    ck_assert_ptr_ne(expected, NULL);
+    rewind(memstream);
+    memset(memstream_buffer, 0, memstream_size);
+}
+
+
+static void release_handler(void *userdata, const cypher_astnode_t *node,
+        void *annotation)
+{
+    released++;
+    ck_assert_ptr_eq(annotation, userdata);
+}
+
+
+START_TEST (compact_preserves_ast)
+{
+    result = cypher_parse(
+            "/* first */ MATCH (n:Foo)-[:BAR*2..]->(m) WHERE n.x > 1 < m.y\n"
+            "RETURN n, count(*) AS c ORDER BY c SKIP 1; CALL foo.bar(1, 2);\n"
+            "MATCH (n) RETURN [x IN [1,2,3] WHERE x > 1 | x * 2], 'str'",
+            NULL, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+    print_and_reset();
+
+    ck_assert_int_eq(cypher_parse_result_compact(result), 0);
+
+    ck_assert(cypher_parse_result_fprint_ast(result, memstream, 0, NULL, 0) == 0);
+    fflush(memstream);
+    ck_assert_str_eq(memstream_buffer, expected);
+
+    ck_assert_int_eq(cypher_parse_result_ndirectives(result), 3);
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        const cypher_astnode_t *directive =
+                cypher_parse_result_get_directive(result, i);
+        ck_assert_int_eq(cypher_astnode_type(directive), CYPHER_AST_STATEMENT);
+    }
+    ck_assert_ptr_eq(cypher_parse_result_get_directive(result, 0),
+            cypher_parse_result_get_root(result, 1));
+
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 0);
+    const cypher_astnode_t *query = cypher_ast_statement_get_body(ast);
+    const cypher_astnode_t *match = cypher_ast_query_get_clause(query, 0);
+    const cypher_astnode_t *pattern = cypher_ast_match_get_pattern(match);
+    ck_assert_int_eq(cypher_astnode_type(pattern), CYPHER_AST_PATTERN);
+    ck_assert_ptr_eq(pattern, cypher_astnode_get_child(match, 0));
+    const cypher_astnode_t *predicate = cypher_ast_match_get_predicate(match);
+    ck_assert_int_eq(cypher_astnode_type(predicate), CYPHER_AST_COMPARISON);
+}
+END_TEST
+
+
+START_TEST (compact_map_literals)
+{
+    result = cypher_parse(
+            "MATCH (n {x: 1, y: 2}) RETURN {a: 1, b: 'two', c: {d: [true]}}, "
+            "n {.x, z: 3}", NULL, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 0);
+    print_and_reset();
+
+    ck_assert_int_eq(cypher_parse_result_compact(result), 0);
+
+    ck_assert(cypher_parse_result_fprint_ast(result, memstream, 0, NULL, 0) == 0);
+    fflush(memstream);
+    ck_assert_str_eq(memstream_buffer, expected);
+
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 0);
+    const cypher_astnode_t *query = cypher_ast_statement_get_body(ast);
+    const cypher_astnode_t *clause = cypher_ast_query_get_clause(query, 1);
+    const cypher_astnode_t *map = cypher_ast_projection_get_expression(
+            cypher_ast_return_get_projection(clause, 0));
+    ck_assert_int_eq(cypher_astnode_type(map), CYPHER_AST_MAP);
+    ck_assert_int_eq(cypher_ast_map_nentries(map), 3);
+    const cypher_astnode_t *value = cypher_ast_map_get_value(map, 2);
+    ck_assert_int_eq(cypher_astnode_type(value), CYPHER_AST_MAP);
+    ck_assert_ptr_eq(value, cypher_astnode_get_child(map, 5));
+}
+END_TEST
+
+
+START_TEST (compact_then_find_map_keys)
+{
+    result = cypher_parse("RETURN {k0: 0, k1: 1, k2: 2, k3: 3, k4: 4, k5: 5, "
+            "k6: 6, k7: 7, k8: 8, k9: 9}", NULL, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_compact(result), 0);
+
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 0);
+    const cypher_astnode_t *query = cypher_ast_statement_get_body(ast);
+    const cypher_astnode_t *clause = cypher_ast_query_get_clause(query, 0);
+    const cypher_astnode_t *map = cypher_ast_projection_get_expression(
+            cypher_ast_return_get_projection(clause, 0));
+    ck_assert_int_eq(cypher_astnode_type(map), CYPHER_AST_MAP);
+
+    // the key index is built by the first lookup, outside the arena
+    for (unsigned int i = 0; i < 10; ++i)
+    {
+        char key[3] = { 'k', '0' + i, '\0' };
+        ck_assert_ptr_eq(cypher_ast_map_find(map, key, 2),
+                cypher_ast_map_get_value(map, i));
+    }
+    ck_assert_ptr_eq(cypher_ast_map_find(map, "k10", 3), NULL);
+}
+END_TEST
+
+
+START_TEST (compact_twice)
+{
+    result = cypher_parse("RETURN 1; RETURN 'two';", NULL, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+    print_and_reset();
+
+    ck_assert_int_eq(cypher_parse_result_compact(result), 0);
+    ck_assert_int_eq(cypher_parse_result_compact(result), 0);
+
+    ck_assert(cypher_parse_result_fprint_ast(result, memstream, 0, NULL, 0) == 0);
+    fflush(memstream);
+    ck_assert_str_eq(memstream_buffer, expected);
+}
+END_TEST
+
+
+START_TEST (compact_empty_result)
+{
+    result = cypher_parse("", NULL, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_compact(result), 0);
+    ck_assert_int_eq(cypher_parse_result_nroots(result), 0);
+}
+END_TEST
+
+
+START_TEST (compact_preserves_annotations)
+{
+    result = cypher_parse("MATCH (n:Label) RETURN n", NULL, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+
+    cypher_ast_annotation_context_t *ctx = cypher_ast_annotation_context();
+    void *ptr = (void *)"foo";
+    cypher_ast_annotation_context_set_release_handler(ctx, release_handler, ptr);
+
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 0);
+    const cypher_astnode_t *query = cypher_ast_statement_get_body(ast);
+    const cypher_astnode_t *match = cypher_ast_query_get_clause(query, 0);
+    ck_assert_int_eq(cypher_astnode_attach_annotation(ctx, match, ptr, NULL), 0);
+
+    ck_assert_int_eq(cypher_parse_result_compact(result), 0);
+    ck_assert_int_eq(released, 0);
+
+    ast = cypher_parse_result_get_directive(result, 0);
+    query = cypher_ast_statement_get_body(ast);
+    match = cypher_ast_query_get_clause(query, 0);
+    ck_assert_ptr_eq(cypher_astnode_get_annotation(ctx, match), ptr);
+
+    cypher_parse_result_free(result);
+    result = NULL;
+    ck_assert_int_eq(released, 1);
+    cypher_ast_annotation_context_free(ctx);
+}
+END_TEST
+
+
+TCase* compact_tcase(void)
+{
+    TCase *tc = tcase_create("compact");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, compact_preserves_ast);
+    tcase_add_test(tc, compact_map_literals);
+    tcase_add_test(tc, compact_then_find_map_keys);
+    tcase_add_test(tc, compact_twice);
+    tcase_add_test(tc, compact_empty_result);
+    tcase_add_test(tc, compact_preserves_annotations);
+    return tc;
+}
@@ -0,0 +1,169 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "../../lib/src/cypher-parser.hpp"
+#include <check.h>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+
+namespace {
+
+/*
+ * Records the node types dispatched to, in visit order, along with the
+ * text of identifiers and labels.
+ */
+class recording_visitor : public cypher::visitor<recording_visitor>
+{
+public:
+    std::vector<cypher_astnode_type_t> types;
+    std::vector<std::string> names;
+    unsigned int nmatch = 0;
+    unsigned int nreturn = 0;
+    unsigned int ndefault = 0;
+
+    void visit_match(const cypher_astnode_t *node)
+    {
+        ++nmatch;
+        types.push_back(cypher_astnode_type(node));
+        visit_children(node);
+    }
+
+    void visit_return(const cypher_astnode_t *node)
+    {
+        ++nreturn;
+        types.push_back(cypher_astnode_type(node));
+        visit_children(node);
+    }
+
+    void visit_identifier(const cypher_astnode_t *node)
+    {
+        types.push_back(cypher_astnode_type(node));
+        names.emplace_back(cypher::identifier_get_name(node));
+    }
+
+    void visit_label(const cypher_astnode_t *node)
+    {
+        types.push_back(cypher_astnode_type(node));
+        names.emplace_back(cypher::label_get_name(node));
+    }
+
+    void visit_default(const cypher_astnode_t *node)
+    {
+        ++ndefault;
+        types.push_back(cypher_astnode_type(node));
+        visit_children(node);
+    }
+};
+
+
+/*
+ * Counts the nodes of a tree, returning the count from each visit.
+ */
+class counting_visitor : public cypher::visitor<counting_visitor, unsigned int>
+{
+public:
+    unsigned int visit_default(const cypher_astnode_t *node)
+    {
+        unsigned int count = 1;
+        unsigned int n = cypher_astnode_nchildren(node);
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            count += visit(cypher_astnode_get_child(node, i));
+        }
+        return count;
+    }
+};
+
+} // namespace
+
+
+START_TEST (visit_dispatches_on_node_type)
+{
+    cypher::parse_result result = cypher::parse_result::parse(
+            "MATCH (n:Person) RETURN n.name AS name");
+    ck_assert_int_eq(result.nerrors(), 0);
+    ck_assert_int_eq(result.ndirectives(), 1);
+
+    recording_visitor v;
+    v.visit(result.directive(0));
+
+    ck_assert_int_eq(v.nmatch, 1);
+    ck_assert_int_eq(v.nreturn, 1);
+
+    const std::vector<cypher_astnode_type_t> expected =
+        { CYPHER_AST_STATEMENT,
+          CYPHER_AST_QUERY,
+          CYPHER_AST_MATCH,
+          CYPHER_AST_PATTERN,
+          CYPHER_AST_PATTERN_PATH,
+          CYPHER_AST_NODE_PATTERN,
+          CYPHER_AST_IDENTIFIER,
+          CYPHER_AST_LABEL,
+          CYPHER_AST_RETURN,
+          CYPHER_AST_PROJECTION,
+          CYPHER_AST_PROPERTY_OPERATOR,
+          CYPHER_AST_IDENTIFIER,
+          CYPHER_AST_PROP_NAME,
+          CYPHER_AST_IDENTIFIER };
+    ck_assert_int_eq(v.types.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        ck_assert_int_eq(v.types[i], expected[i]);
+    }
+    ck_assert_int_eq(v.ndefault, expected.size() - 6);
+
+    const std::vector<std::string> names = { "n", "Person", "n", "name" };
+    ck_assert(v.names == names);
+}
+END_TEST
+
+
+START_TEST (visit_returns_values)
+{
+    cypher::parse_result result = cypher::parse_result::parse(
+            "RETURN [1, 2, 3] AS xs; MATCH (a)-[:R]->(b) RETURN a, b;");
+    ck_assert_int_eq(result.nerrors(), 0);
+    ck_assert_int_eq(result.ndirectives(), 2);
+
+    counting_visitor v;
+    for (unsigned int i = 0; i < result.ndirectives(); ++i)
+    {
+        const cypher_astnode_t *directive = result.directive(i);
+        ck_assert_int_eq(v.visit(directive),
+                cypher_astnode_subtree_size(directive));
+    }
+}
+END_TEST
+
+
+int main(void)
+{
+    Suite *s = suite_create("libcypher-parser C++");
+    TCase *tc = tcase_create("visitor");
+    tcase_add_test(tc, visit_dispatches_on_node_type);
+    tcase_add_test(tc, visit_returns_values);
+    suite_add_tcase(s, tc);
+
+    SRunner *sr = srunner_create(s);
+    srunner_run_all(sr, CK_NORMAL);
+    int number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+
+    return (number_failed == 0)? EXIT_SUCCESS : EXIT_FAILURE;
+}
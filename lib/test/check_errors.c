@@ -19,6 +19,7 @@
 #include "memstream.h"
 #include <check.h>
 #include <errno.h>
+#include <string.h>
 #include <unistd.h>
 
 
@@ -149,6 +150,36 @@ START_TEST (parse_invalid_clause)
 END_TEST
 
 
+START_TEST (parse_invalid_clause_from_iovec)
+{
+    char buf1[] = "MATCH (n)\n[1";
+    char buf2[] = ",2,3]\nRET";
+    char buf3[] = "URN n";
+    struct iovec iov[] =
+        { { .iov_base = buf1, .iov_len = sizeof(buf1) - 1 },
+          { .iov_base = buf2, .iov_len = sizeof(buf2) - 1 },
+          { .iov_base = buf3, .iov_len = sizeof(buf3) - 1 } };
+
+    struct cypher_input_position last = cypher_input_position_zero;
+    result = cypher_uparsev(iov, 3, &last, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(last.offset, 26);
+
+    ck_assert_int_eq(cypher_parse_result_ndirectives(result), 1);
+
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 1);
+    const cypher_parse_error_t *err = cypher_parse_result_get_error(result, 0);
+    struct cypher_input_position pos = cypher_parse_error_position(err);
+    ck_assert_int_eq(pos.line, 2);
+    ck_assert_int_eq(pos.column, 1);
+    ck_assert_int_eq(pos.offset, 10);
+
+    ck_assert_str_eq(cypher_parse_error_context(err), "[1,2,3]");
+    ck_assert_int_eq(cypher_parse_error_context_offset(err), 0);
+}
+END_TEST
+
+
 START_TEST (parse_invalid_query_and_resync)
 {
     struct cypher_input_position last = cypher_input_position_zero;
@@ -300,6 +331,107 @@ START_TEST (track_error_position_across_statements)
 END_TEST
 
 
+START_TEST (resync_after_comment_over_multiple_lines)
+{
+    struct cypher_input_position last = cypher_input_position_zero;
+    result = cypher_parse(
+            "MATCH (n)\n"
+            "[1,\n"
+            "2] /* skip\n"
+            " */MATCH (m) RETURN #",
+            &last, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(last.offset, 46);
+
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 2);
+    const cypher_parse_error_t *err = cypher_parse_result_get_error(result, 0);
+    struct cypher_input_position pos = cypher_parse_error_position(err);
+    ck_assert_int_eq(pos.line, 2);
+    ck_assert_int_eq(pos.column, 1);
+    ck_assert_int_eq(pos.offset, 10);
+
+    err = cypher_parse_result_get_error(result, 1);
+    pos = cypher_parse_error_position(err);
+    ck_assert_int_eq(pos.line, 4);
+    ck_assert_int_eq(pos.column, 21);
+    ck_assert_int_eq(pos.offset, 45);
+
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 0);
+    const cypher_astnode_t *query = cypher_ast_statement_get_body(ast);
+    ck_assert_int_eq(cypher_ast_query_nclauses(query), 2);
+    const cypher_astnode_t *clause = cypher_ast_query_get_clause(query, 1);
+    ck_assert_int_eq(cypher_astnode_type(clause), CYPHER_AST_MATCH);
+    struct cypher_input_range range = cypher_astnode_range(clause);
+    ck_assert_int_eq(range.start.offset, 28);
+}
+END_TEST
+
+
+START_TEST (track_positions_through_long_statement)
+{
+    // long enough that consumed input is discarded at clause boundaries
+    const unsigned int nmatches = 5000;
+    const char *tail = "[1,2,3]\nRETURN n";
+    size_t length = nmatches * 10 + strlen(tail);
+    char *query = malloc(length + 1);
+    ck_assert_ptr_ne(query, NULL);
+    for (unsigned int i = 0; i < nmatches; ++i)
+    {
+        memcpy(query + (i * 10), "MATCH (n)\n", 10);
+    }
+    strcpy(query + (nmatches * 10), tail);
+
+    struct cypher_input_position last = cypher_input_position_zero;
+    result = cypher_parse(query, &last, NULL, 0);
+    free(query);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(last.offset, length);
+    ck_assert_int_eq(last.line, nmatches + 2);
+
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 1);
+    const cypher_parse_error_t *err = cypher_parse_result_get_error(result, 0);
+    struct cypher_input_position pos = cypher_parse_error_position(err);
+    ck_assert_int_eq(pos.line, nmatches + 1);
+    ck_assert_int_eq(pos.column, 1);
+    ck_assert_int_eq(pos.offset, nmatches * 10);
+    ck_assert_str_eq(cypher_parse_error_context(err), "[1,2,3]");
+    ck_assert_int_eq(cypher_parse_error_context_offset(err), 0);
+
+    ck_assert_int_eq(cypher_parse_result_ndirectives(result), 1);
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 0);
+    const cypher_astnode_t *query_node = cypher_ast_statement_get_body(ast);
+    ck_assert_int_eq(cypher_ast_query_nclauses(query_node), nmatches + 1);
+
+    for (unsigned int i = 0; i < nmatches; i += 499)
+    {
+        const cypher_astnode_t *clause =
+                cypher_ast_query_get_clause(query_node, i);
+        ck_assert_int_eq(cypher_astnode_type(clause), CYPHER_AST_MATCH);
+        struct cypher_input_range range = cypher_astnode_range(clause);
+        ck_assert_int_eq(range.start.line, i + 1);
+        ck_assert_int_eq(range.start.column, 1);
+        ck_assert_int_eq(range.start.offset, i * 10);
+        ck_assert_int_eq(range.end.offset, (i + 1) * 10);
+
+        const cypher_astnode_t *pattern = cypher_ast_match_get_pattern(clause);
+        range = cypher_astnode_range(pattern);
+        ck_assert_int_eq(range.start.line, i + 1);
+        ck_assert_int_eq(range.start.column, 7);
+        ck_assert_int_eq(range.start.offset, i * 10 + 6);
+    }
+
+    const cypher_astnode_t *clause =
+            cypher_ast_query_get_clause(query_node, nmatches);
+    ck_assert_int_eq(cypher_astnode_type(clause), CYPHER_AST_RETURN);
+    struct cypher_input_range range = cypher_astnode_range(clause);
+    ck_assert_int_eq(range.start.line, nmatches + 2);
+    ck_assert_int_eq(range.start.column, 1);
+    ck_assert_int_eq(range.start.offset, nmatches * 10 + 8);
+    ck_assert_int_eq(range.end.offset, length);
+}
+END_TEST
+
+
 TCase* errors_tcase(void)
 {
     TCase *tc = tcase_create("errors");
@@ -307,9 +439,12 @@ TCase* errors_tcase(void)
     tcase_add_test(tc, parse_unterminated_string);
     tcase_add_test(tc, parse_invalid_directive);
     tcase_add_test(tc, parse_invalid_clause);
+    tcase_add_test(tc, parse_invalid_clause_from_iovec);
     tcase_add_test(tc, parse_invalid_query_and_resync);
     tcase_add_test(tc, parse_single_invalid_query);
     tcase_add_test(tc, track_error_position_over_embedded_newline);
     tcase_add_test(tc, track_error_position_across_statements);
+    tcase_add_test(tc, resync_after_comment_over_multiple_lines);
+    tcase_add_test(tc, track_positions_through_long_statement);
     return tc;
 }
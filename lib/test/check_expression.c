@@ -695,6 +695,131 @@ START_TEST (parse_subscript_list_with_in_operator)
 }
 END_TEST
 
+
+START_TEST (parse_map_find)
+{
+    result = cypher_parse("RETURN {a: 1, b: 2, `c d`: 3}, "
+            "{k0: 0, k1: 1, k2: 2, k3: 3, k4: 4, k5: 5, k6: 6, k7: 7, "
+            "k8: 8, k9: 9}", NULL, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 0);
+
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 0);
+    const cypher_astnode_t *query = cypher_ast_statement_get_body(ast);
+    const cypher_astnode_t *clause = cypher_ast_query_get_clause(query, 0);
+
+    const cypher_astnode_t *proj = cypher_ast_return_get_projection(clause, 0);
+    const cypher_astnode_t *map = cypher_ast_projection_get_expression(proj);
+    ck_assert_int_eq(cypher_astnode_type(map), CYPHER_AST_MAP);
+
+    const cypher_astnode_t *value = cypher_ast_map_find(map, "b", 1);
+    ck_assert_ptr_eq(value, cypher_ast_map_get_value(map, 1));
+    value = cypher_ast_map_find(map, "c d", 3);
+    ck_assert_ptr_eq(value, cypher_ast_map_get_value(map, 2));
+    ck_assert_ptr_eq(cypher_ast_map_find(map, "c", 1), NULL);
+    ck_assert_ptr_eq(cypher_ast_map_find(map, "bb", 2), NULL);
+
+    proj = cypher_ast_return_get_projection(clause, 1);
+    map = cypher_ast_projection_get_expression(proj);
+    ck_assert_int_eq(cypher_astnode_type(map), CYPHER_AST_MAP);
+    ck_assert_int_eq(cypher_ast_map_nentries(map), 10);
+
+    for (unsigned int i = 0; i < 10; ++i)
+    {
+        char key[3] = { 'k', '0' + i, '\0' };
+        value = cypher_ast_map_find(map, key, 2);
+        ck_assert_ptr_eq(value, cypher_ast_map_get_value(map, i));
+    }
+    ck_assert_ptr_eq(cypher_ast_map_find(map, "k10", 3), NULL);
+    ck_assert_ptr_eq(cypher_ast_map_find(map, "k", 1), NULL);
+}
+END_TEST
+
+
+START_TEST (parse_map_with_duplicate_keys)
+{
+    result = cypher_parse("RETURN {a: 1, b: 2, a: 3}", NULL, NULL,
+            CYPHER_PARSE_REJECT_DUPLICATE_KEYS);
+    ck_assert_ptr_ne(result, NULL);
+
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 1);
+    const cypher_parse_error_t *err = cypher_parse_result_get_error(result, 0);
+    struct cypher_input_position pos = cypher_parse_error_position(err);
+    ck_assert_int_eq(pos.line, 1);
+    ck_assert_int_eq(pos.column, 21);
+    ck_assert_int_eq(pos.offset, 20);
+    ck_assert_str_eq(cypher_parse_error_message(err), "Duplicate key 'a'");
+    ck_assert_str_eq(cypher_parse_error_context(err),
+            "RETURN {a: 1, b: 2, a: 3}");
+    ck_assert_int_eq(cypher_parse_error_context_offset(err), 20);
+
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 0);
+    const cypher_astnode_t *query = cypher_ast_statement_get_body(ast);
+    const cypher_astnode_t *clause = cypher_ast_query_get_clause(query, 0);
+    const cypher_astnode_t *proj = cypher_ast_return_get_projection(clause, 0);
+    const cypher_astnode_t *map = cypher_ast_projection_get_expression(proj);
+    ck_assert_int_eq(cypher_ast_map_nentries(map), 3);
+
+    const cypher_astnode_t *value = cypher_ast_map_find(map, "a", 1);
+    ck_assert_ptr_eq(value, cypher_ast_map_get_value(map, 2));
+}
+END_TEST
+
+
+START_TEST (parse_map_with_duplicate_keys_accepted)
+{
+    result = cypher_parse("RETURN {a: 1, b: 2, a: 3}", NULL, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 0);
+
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 0);
+    const cypher_astnode_t *query = cypher_ast_statement_get_body(ast);
+    const cypher_astnode_t *clause = cypher_ast_query_get_clause(query, 0);
+    const cypher_astnode_t *proj = cypher_ast_return_get_projection(clause, 0);
+    const cypher_astnode_t *map = cypher_ast_projection_get_expression(proj);
+    ck_assert_int_eq(cypher_ast_map_nentries(map), 3);
+
+    const cypher_astnode_t *value = cypher_ast_map_find(map, "a", 1);
+    ck_assert_ptr_eq(value, cypher_ast_map_get_value(map, 2));
+}
+END_TEST
+
+
+START_TEST (parse_string_lengths)
+{
+    result = cypher_parse("RETURN 'foo\\'s', n.`a b` AS x", NULL, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 0);
+    const cypher_astnode_t *query = cypher_ast_statement_get_body(ast);
+    const cypher_astnode_t *clause = cypher_ast_query_get_clause(query, 0);
+    const cypher_astnode_t *proj = cypher_ast_return_get_projection(clause, 0);
+    const cypher_astnode_t *str = cypher_ast_projection_get_expression(proj);
+    ck_assert_int_eq(cypher_astnode_type(str), CYPHER_AST_STRING);
+    ck_assert_str_eq(cypher_ast_string_get_value(str), "foo's");
+    ck_assert_int_eq(cypher_ast_string_get_value_len(str), 5);
+
+    proj = cypher_ast_return_get_projection(clause, 1);
+    const cypher_astnode_t *prop = cypher_ast_projection_get_expression(proj);
+    const cypher_astnode_t *name =
+            cypher_ast_property_operator_get_prop_name(prop);
+    ck_assert_int_eq(cypher_ast_prop_name_get_value_len(name), 3);
+    const cypher_astnode_t *alias = cypher_ast_projection_get_alias(proj);
+    ck_assert_int_eq(cypher_ast_identifier_get_name_len(alias), 1);
+
+    cypher_astnode_t *embedded = cypher_ast_string("a\0b", 3,
+            cypher_astnode_range(str));
+    ck_assert_ptr_ne(embedded, NULL);
+    cypher_astnode_t *clone = cypher_ast_clone(embedded);
+    ck_assert_ptr_ne(clone, NULL);
+    ck_assert_int_eq(cypher_ast_string_get_value_len(clone), 3);
+    ck_assert(memcmp(cypher_ast_string_get_value(clone), "a\0b", 3) == 0);
+    cypher_ast_free(clone);
+    cypher_ast_free(embedded);
+}
+END_TEST
+
+
 TCase* expression_tcase(void)
 {
     TCase *tc = tcase_create("expression");
@@ -708,5 +833,9 @@ TCase* expression_tcase(void)
     tcase_add_test(tc, parse_subscript);
     tcase_add_test(tc, parse_slice);
     tcase_add_test(tc, parse_subscript_list_with_in_operator);
+    tcase_add_test(tc, parse_map_find);
+    tcase_add_test(tc, parse_map_with_duplicate_keys);
+    tcase_add_test(tc, parse_map_with_duplicate_keys_accepted);
+    tcase_add_test(tc, parse_string_lengths);
     return tc;
 }
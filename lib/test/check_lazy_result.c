@@ -0,0 +1,185 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "../../lib/src/cypher-parser.h"
+#include "memstream.h"
+#include <check.h>
+#include <errno.h>
+#include <unistd.h>
+
+
+static const char *input =
+    "/* first */ MATCH (n:Foo) RETURN n;\n"
+    "RETURN 1 + 2 AS three; ;\n"
+    "// a comment\n"
+    "MATCH (n) RETRUN n;\n"
+    "CREATE (m:Bar {x: [1, 2, 3]}) RETURN m";
+
+static cypher_parser_config_t *config;
+static cypher_parse_result_t *full;
+static cypher_parse_result_t *result;
+static char *memstream_buffer;
+static size_t memstream_size;
+static FILE *memstream;
+
+
+static void setup(void)
+{
+    result = NULL;
+    full = cypher_parse(input, NULL, NULL, 0);
+    ck_assert_ptr_ne(full, NULL);
+    config = cypher_parser_new_config();
+    ck_assert_ptr_ne(config, NULL);
+    memstream = open_memstream(&memstream_buffer, &memstream_size);
+}
+
+
+static void teardown(void)
+{
+    cypher_parse_result_free(result);
+    cypher_parse_result_free(full);
+    cypher_parser_config_free(config);
+    fclose(memstream);
+    free(memstream_buffer);
+}
+
+
+static char *print_result(const cypher_parse_result_t *r)
+{
+    rewind(memstream);
+    memset(memstream_buffer, 0, memstream_size);
+    ck_assert(cypher_parse_result_fprint_ast(r, memstream, 0, NULL, 0) == 0);
+    fflush(memstream);
+    char *s = strdup(memstream_buffer);
+    ck_assert_ptr_ne(s, NULL);
+    return s;
+}
+
+
+static void check_matches_full(void)
+{
+    ck_assert_int_eq(cypher_parse_result_nnodes(result),
+            cypher_parse_result_nnodes(full));
+    ck_assert_int_eq(cypher_parse_result_nroots(result),
+            cypher_parse_result_nroots(full));
+    ck_assert_int_eq(cypher_parse_result_ndirectives(result),
+            cypher_parse_result_ndirectives(full));
+    ck_assert_int_eq(cypher_parse_result_nerrors(result),
+            cypher_parse_result_nerrors(full));
+    ck_assert(cypher_parse_result_eof(result) ==
+            cypher_parse_result_eof(full));
+
+    for (unsigned int i = 0; i < cypher_parse_result_nerrors(full); ++i)
+    {
+        const cypher_parse_error_t *err =
+                cypher_parse_result_get_error(result, i);
+        const cypher_parse_error_t *expected =
+                cypher_parse_result_get_error(full, i);
+        ck_assert_int_eq(cypher_parse_error_position(err).offset,
+                cypher_parse_error_position(expected).offset);
+        ck_assert_str_eq(cypher_parse_error_message(err),
+                cypher_parse_error_message(expected));
+    }
+
+    // access out of order, so that segments are evicted and reloaded
+    unsigned int n = cypher_parse_result_ndirectives(full);
+    for (unsigned int i = n; i-- > 0; )
+    {
+        const cypher_astnode_t *d = cypher_parse_result_get_directive(result, i);
+        const cypher_astnode_t *e = cypher_parse_result_get_directive(full, i);
+        ck_assert_ptr_ne(d, NULL);
+        ck_assert_int_eq(cypher_astnode_type(d), cypher_astnode_type(e));
+        ck_assert_int_eq(cypher_astnode_range(d).start.offset,
+                cypher_astnode_range(e).start.offset);
+        ck_assert_int_eq(cypher_astnode_range(d).end.offset,
+                cypher_astnode_range(e).end.offset);
+    }
+    ck_assert_ptr_eq(cypher_parse_result_get_directive(result, n), NULL);
+
+    for (unsigned int i = 0; i < cypher_parse_result_nroots(full); ++i)
+    {
+        const cypher_astnode_t *r = cypher_parse_result_get_root(result, i);
+        const cypher_astnode_t *e = cypher_parse_result_get_root(full, i);
+        ck_assert_ptr_ne(r, NULL);
+        ck_assert_int_eq(cypher_astnode_type(r), cypher_astnode_type(e));
+        ck_assert_int_eq(cypher_astnode_range(r).start.offset,
+                cypher_astnode_range(e).start.offset);
+    }
+
+    char *expected = print_result(full);
+    char *actual = print_result(result);
+    ck_assert_str_eq(actual, expected);
+    free(expected);
+    free(actual);
+}
+
+
+START_TEST (lazy_parse_from_buffer)
+{
+    cypher_parser_config_set_lazy_segments(config, 1);
+    result = cypher_parse(input, NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+    check_matches_full();
+}
+END_TEST
+
+
+START_TEST (lazy_parse_from_stream)
+{
+    FILE *stream = tmpfile();
+    ck_assert_ptr_ne(stream, NULL);
+    fputs(input, stream);
+    rewind(stream);
+
+    cypher_parser_config_set_lazy_segments(config, 2);
+    result = cypher_fparse(stream, NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+    check_matches_full();
+
+    cypher_parse_result_free(result);
+    result = NULL;
+    fclose(stream);
+}
+END_TEST
+
+
+START_TEST (lazy_parse_with_initial_position)
+{
+    struct cypher_input_position position = { 3, 5, 20 };
+    cypher_parser_config_set_initial_position(config, position);
+    cypher_parser_config_set_initial_ordinal(config, 7);
+    cypher_parse_result_free(full);
+    full = cypher_parse(input, NULL, config, 0);
+    ck_assert_ptr_ne(full, NULL);
+
+    cypher_parser_config_set_lazy_segments(config, 1);
+    result = cypher_parse(input, NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+    check_matches_full();
+}
+END_TEST
+
+
+TCase* lazy_result_tcase(void)
+{
+    TCase *tc = tcase_create("lazy result");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, lazy_parse_from_buffer);
+    tcase_add_test(tc, lazy_parse_from_stream);
+    tcase_add_test(tc, lazy_parse_with_initial_position);
+    return tc;
+}
@@ -166,11 +166,42 @@ START_TEST (parse_map_project_multiple_selectors)
 END_TEST
 
 
+START_TEST (parse_map_project_find)
+{
+    result = cypher_parse("RETURN map{x: 1, .y, z, .*, x: 2}", NULL, NULL,
+            CYPHER_PARSE_REJECT_DUPLICATE_KEYS);
+    ck_assert_ptr_ne(result, NULL);
+
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 1);
+    const cypher_parse_error_t *err = cypher_parse_result_get_error(result, 0);
+    ck_assert_int_eq(cypher_parse_error_position(err).offset, 28);
+    ck_assert_str_eq(cypher_parse_error_message(err), "Duplicate key 'x'");
+
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 0);
+    const cypher_astnode_t *query = cypher_ast_statement_get_body(ast);
+    const cypher_astnode_t *clause = cypher_ast_query_get_clause(query, 0);
+    const cypher_astnode_t *proj = cypher_ast_return_get_projection(clause, 0);
+    const cypher_astnode_t *exp = cypher_ast_projection_get_expression(proj);
+    ck_assert_int_eq(cypher_astnode_type(exp), CYPHER_AST_MAP_PROJECTION);
+
+    ck_assert_ptr_eq(cypher_ast_map_projection_find(exp, "x", 1),
+            cypher_ast_map_projection_get_selector(exp, 4));
+    ck_assert_ptr_eq(cypher_ast_map_projection_find(exp, "y", 1),
+            cypher_ast_map_projection_get_selector(exp, 1));
+    ck_assert_ptr_eq(cypher_ast_map_projection_find(exp, "z", 1),
+            cypher_ast_map_projection_get_selector(exp, 2));
+    ck_assert_ptr_eq(cypher_ast_map_projection_find(exp, "*", 1), NULL);
+    ck_assert_ptr_eq(cypher_ast_map_projection_find(exp, "map", 3), NULL);
+}
+END_TEST
+
+
 TCase* map_projection_tcase(void)
 {
     TCase *tc = tcase_create("map projection");
     tcase_add_checked_fixture(tc, setup, teardown);
     tcase_add_test(tc, parse_map_project_none);
     tcase_add_test(tc, parse_map_project_multiple_selectors);
+    tcase_add_test(tc, parse_map_project_find);
     return tc;
 }
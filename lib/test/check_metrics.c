@@ -0,0 +1,195 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "../../lib/src/cypher-parser.h"
+#include "memstream.h"
+#include <check.h>
+#include <errno.h>
+#include <string.h>
+
+
+static cypher_parse_result_t *result;
+static char *memstream_buffer;
+static size_t memstream_size;
+static FILE *memstream;
+
+
+static void setup(void)
+{
+    cypher_parser_metrics_reset();
+    cypher_parser_metrics_enable();
+    result = NULL;
+    memstream = open_memstream(&memstream_buffer, &memstream_size);
+}
+
+
+static void teardown(void)
+{
+    cypher_parser_metrics_disable();
+    cypher_parse_result_free(result);
+    fclose(memstream);
+    free(memstream_buffer);
+}
+
+
+static const char *write_metrics(void)
+{
+    ck_assert(cypher_parser_metrics_write(memstream) == 0);
+    fflush(memstream);
+    return memstream_buffer;
+}
+
+
+static int count_segment(void *userdata,
+        const cypher_quick_parse_segment_t *segment)
+{
+    return 0;
+}
+
+
+START_TEST (count_parses_and_segments)
+{
+    result = cypher_parse("RETURN 1;\nRETURN 2;", NULL, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+
+    const char *metrics = write_metrics();
+    ck_assert_ptr_ne(strstr(metrics,
+                "# HELP cypher_parser_parses_total Number of calls to parse "
+                "input.\n"
+                "# TYPE cypher_parser_parses_total counter\n"
+                "cypher_parser_parses_total 1\n"), NULL);
+    ck_assert_ptr_ne(strstr(metrics, "\ncypher_parser_segments_total 2\n"),
+            NULL);
+    ck_assert_ptr_ne(strstr(metrics, "\ncypher_parser_bytes_total 19\n"),
+            NULL);
+    ck_assert_ptr_ne(strstr(metrics, "\ncypher_parser_errors_total 0\n"),
+            NULL);
+    ck_assert_ptr_eq(strstr(metrics, "\ncypher_parser_ast_nodes_total 0\n"),
+            NULL);
+}
+END_TEST
+
+
+START_TEST (count_errors)
+{
+    result = cypher_parse("RETURN 1 +;", NULL, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_gt(cypher_parse_result_nerrors(result), 0);
+
+    const char *metrics = write_metrics();
+    ck_assert_ptr_eq(strstr(metrics, "\ncypher_parser_errors_total 0\n"),
+            NULL);
+}
+END_TEST
+
+
+START_TEST (record_size_histogram)
+{
+    result = cypher_parse("RETURN 1;\nRETURN 2;", NULL, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+
+    const char *metrics = write_metrics();
+    ck_assert_ptr_ne(strstr(metrics,
+                "# TYPE cypher_parser_statement_size_bytes histogram\n"
+                "cypher_parser_statement_size_bytes_bucket{le=\"16\"} 2\n"
+                "cypher_parser_statement_size_bytes_bucket{le=\"32\"} 2\n"),
+            NULL);
+    ck_assert_ptr_ne(strstr(metrics,
+                "cypher_parser_statement_size_bytes_bucket{le=\"1048576\"} 2\n"
+                "cypher_parser_statement_size_bytes_bucket{le=\"+Inf\"} 2\n"
+                "cypher_parser_statement_size_bytes_sum 19\n"
+                "cypher_parser_statement_size_bytes_count 2\n"), NULL);
+}
+END_TEST
+
+
+START_TEST (record_latency_histogram)
+{
+    result = cypher_parse("RETURN 1;\nRETURN 2;", NULL, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+
+    const char *metrics = write_metrics();
+    ck_assert_ptr_ne(strstr(metrics,
+                "# TYPE cypher_parser_parse_duration_seconds histogram\n"
+                "cypher_parser_parse_duration_seconds_bucket{le=\"1e-06\"} "),
+            NULL);
+    ck_assert_ptr_ne(strstr(metrics,
+                "cypher_parser_parse_duration_seconds_bucket{le=\"+Inf\"} 2\n"),
+            NULL);
+    ck_assert_ptr_ne(strstr(metrics,
+                "cypher_parser_parse_duration_seconds_count 2\n"), NULL);
+}
+END_TEST
+
+
+START_TEST (count_quick_parse_segments)
+{
+    ck_assert(cypher_quick_parse("RETURN 1;\nRETURN 2;\n:help",
+                count_segment, NULL, 0) == 0);
+
+    const char *metrics = write_metrics();
+    ck_assert_ptr_ne(strstr(metrics,
+                "\ncypher_parser_quick_segments_total 3\n"), NULL);
+    ck_assert_ptr_ne(strstr(metrics, "\ncypher_parser_parses_total 0\n"),
+            NULL);
+}
+END_TEST
+
+
+START_TEST (ignore_parses_whilst_disabled)
+{
+    cypher_parser_metrics_disable();
+    result = cypher_parse("RETURN 1;", NULL, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+
+    const char *metrics = write_metrics();
+    ck_assert_ptr_ne(strstr(metrics, "\ncypher_parser_parses_total 0\n"),
+            NULL);
+    ck_assert_ptr_ne(strstr(metrics, "\ncypher_parser_segments_total 0\n"),
+            NULL);
+}
+END_TEST
+
+
+START_TEST (reset_values)
+{
+    result = cypher_parse("RETURN 1;", NULL, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+    cypher_parser_metrics_reset();
+
+    const char *metrics = write_metrics();
+    ck_assert_ptr_ne(strstr(metrics, "\ncypher_parser_parses_total 0\n"),
+            NULL);
+    ck_assert_ptr_ne(strstr(metrics,
+                "cypher_parser_parse_duration_seconds_count 0\n"), NULL);
+}
+END_TEST
+
+
+TCase* metrics_tcase(void)
+{
+    TCase *tc = tcase_create("metrics");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, count_parses_and_segments);
+    tcase_add_test(tc, count_errors);
+    tcase_add_test(tc, record_size_histogram);
+    tcase_add_test(tc, record_latency_histogram);
+    tcase_add_test(tc, count_quick_parse_segments);
+    tcase_add_test(tc, ignore_parses_whilst_disabled);
+    tcase_add_test(tc, reset_values);
+    return tc;
+}
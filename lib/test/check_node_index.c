@@ -0,0 +1,251 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "../../lib/src/cypher-parser.h"
+#include <check.h>
+#include <errno.h>
+#include <unistd.h>
+
+
+static const char *input =
+    "/* first */ MATCH (a)-[:X]->(b)-[r]-(c) WHERE a.x > 1 RETURN a, r;\n"
+    "MATCH ()-[s]->() RETURN [x IN [1, 2] | x * 2] AS y // last\n";
+
+static cypher_parse_result_t *result;
+static const cypher_astnode_t *found[64];
+static unsigned int nfound;
+
+
+static void setup(void)
+{
+    result = NULL;
+    nfound = 0;
+}
+
+
+static void teardown(void)
+{
+    cypher_parse_result_free(result);
+}
+
+
+static void find_all(const cypher_astnode_t *node, cypher_astnode_type_t type)
+{
+    if (cypher_astnode_instanceof(node, type))
+    {
+        ck_assert_int_lt(nfound, 64);
+        found[nfound++] = node;
+    }
+    for (unsigned int i = 0; i < cypher_astnode_nchildren(node); ++i)
+    {
+        find_all(cypher_astnode_get_child(node, i), type);
+    }
+}
+
+
+static void check_against_traversal(cypher_astnode_type_t type)
+{
+    nfound = 0;
+    for (unsigned int i = 0; i < cypher_parse_result_nroots(result); ++i)
+    {
+        find_all(cypher_parse_result_get_root(result, i), type);
+    }
+
+    unsigned int n;
+    const cypher_astnode_t * const *nodes =
+            cypher_parse_result_nodes_of_type(result, type, &n);
+    ck_assert_int_eq(n, nfound);
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        ck_assert_ptr_eq(nodes[i], found[i]);
+    }
+}
+
+
+START_TEST (list_nodes_of_concrete_type)
+{
+    result = cypher_parse(input, NULL, NULL, CYPHER_PARSE_NODE_INDEX);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 0);
+
+    unsigned int n;
+    const cypher_astnode_t * const *nodes =
+            cypher_parse_result_nodes_of_type(result, CYPHER_AST_REL_PATTERN,
+                    &n);
+    ck_assert_int_eq(n, 3);
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        ck_assert_int_eq(cypher_astnode_type(nodes[i]),
+                CYPHER_AST_REL_PATTERN);
+    }
+    ck_assert_int_lt(cypher_astnode_range(nodes[0]).start.offset,
+            cypher_astnode_range(nodes[1]).start.offset);
+    ck_assert_int_lt(cypher_astnode_range(nodes[1]).start.offset,
+            cypher_astnode_range(nodes[2]).start.offset);
+
+    check_against_traversal(CYPHER_AST_REL_PATTERN);
+    check_against_traversal(CYPHER_AST_IDENTIFIER);
+    check_against_traversal(CYPHER_AST_INTEGER);
+    check_against_traversal(CYPHER_AST_STATEMENT);
+}
+END_TEST
+
+
+START_TEST (list_nodes_of_abstract_type)
+{
+    result = cypher_parse(input, NULL, NULL, CYPHER_PARSE_NODE_INDEX);
+    ck_assert_ptr_ne(result, NULL);
+
+    unsigned int n;
+    const cypher_astnode_t * const *nodes =
+            cypher_parse_result_nodes_of_type(result, CYPHER_AST_QUERY_CLAUSE,
+                    &n);
+    ck_assert_int_eq(n, 4);
+    ck_assert_int_eq(cypher_astnode_type(nodes[0]), CYPHER_AST_MATCH);
+    ck_assert_int_eq(cypher_astnode_type(nodes[1]), CYPHER_AST_RETURN);
+    ck_assert_int_eq(cypher_astnode_type(nodes[2]), CYPHER_AST_MATCH);
+    ck_assert_int_eq(cypher_astnode_type(nodes[3]), CYPHER_AST_RETURN);
+
+    nodes = cypher_parse_result_nodes_of_type(result, CYPHER_AST_COMMENT, &n);
+    ck_assert_int_eq(n, 2);
+    ck_assert_int_eq(cypher_astnode_type(nodes[0]), CYPHER_AST_BLOCK_COMMENT);
+    ck_assert_int_eq(cypher_astnode_type(nodes[1]), CYPHER_AST_LINE_COMMENT);
+
+    check_against_traversal(CYPHER_AST_QUERY_CLAUSE);
+    check_against_traversal(CYPHER_AST_EXPRESSION);
+    check_against_traversal(CYPHER_AST_PATTERN_PATH);
+    check_against_traversal(CYPHER_AST_LIST_COMPREHENSION);
+}
+END_TEST
+
+
+START_TEST (list_no_nodes_of_absent_type)
+{
+    result = cypher_parse(input, NULL, NULL, CYPHER_PARSE_NODE_INDEX);
+    ck_assert_ptr_ne(result, NULL);
+
+    unsigned int n = 1;
+    ck_assert_ptr_eq(cypher_parse_result_nodes_of_type(result,
+                CYPHER_AST_UNWIND, &n), NULL);
+    ck_assert_int_eq(n, 0);
+}
+END_TEST
+
+
+START_TEST (no_nodes_listed_without_flag)
+{
+    result = cypher_parse(input, NULL, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+
+    unsigned int n = 1;
+    ck_assert_ptr_eq(cypher_parse_result_nodes_of_type(result,
+                CYPHER_AST_QUERY_CLAUSE, &n), NULL);
+    ck_assert_int_eq(n, 0);
+}
+END_TEST
+
+
+START_TEST (fail_to_list_nodes_of_invalid_type)
+{
+    result = cypher_parse(input, NULL, NULL, CYPHER_PARSE_NODE_INDEX);
+    ck_assert_ptr_ne(result, NULL);
+
+    unsigned int n = 1;
+    errno = 0;
+    ck_assert_ptr_eq(cypher_parse_result_nodes_of_type(result,
+                UINT8_MAX, &n), NULL);
+    ck_assert_int_eq(errno, EINVAL);
+    ck_assert_int_eq(n, 0);
+}
+END_TEST
+
+
+START_TEST (list_nodes_after_compaction)
+{
+    result = cypher_parse(input, NULL, NULL, CYPHER_PARSE_NODE_INDEX);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_compact(result), 0);
+
+    check_against_traversal(CYPHER_AST_REL_PATTERN);
+    check_against_traversal(CYPHER_AST_EXPRESSION);
+    check_against_traversal(CYPHER_AST_QUERY_CLAUSE);
+}
+END_TEST
+
+
+static int segment_callback(void *userdata, cypher_parse_segment_t *segment)
+{
+    unsigned int *nclauses = userdata;
+    unsigned int n;
+    const cypher_astnode_t * const *nodes =
+            cypher_parse_segment_nodes_of_type(segment,
+                    CYPHER_AST_QUERY_CLAUSE, &n);
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        ck_assert(cypher_astnode_instanceof(nodes[i],
+                    CYPHER_AST_QUERY_CLAUSE));
+    }
+    if (cypher_parse_segment_get_directive(segment) != NULL)
+    {
+        ck_assert_int_eq(n, 2);
+    }
+    *nclauses += n;
+    return 0;
+}
+
+
+START_TEST (list_nodes_of_type_in_segments)
+{
+    unsigned int nclauses = 0;
+    ck_assert_int_eq(cypher_parse_each(input, segment_callback, &nclauses,
+                NULL, NULL, CYPHER_PARSE_NODE_INDEX), 0);
+    ck_assert_int_eq(nclauses, 4);
+}
+END_TEST
+
+
+START_TEST (no_nodes_listed_for_lazy_result)
+{
+    cypher_parser_config_t *config = cypher_parser_new_config();
+    ck_assert_ptr_ne(config, NULL);
+    cypher_parser_config_set_lazy_segments(config, 1);
+    result = cypher_parse(input, NULL, config, CYPHER_PARSE_NODE_INDEX);
+    cypher_parser_config_free(config);
+    ck_assert_ptr_ne(result, NULL);
+
+    unsigned int n = 1;
+    ck_assert_ptr_eq(cypher_parse_result_nodes_of_type(result,
+                CYPHER_AST_QUERY_CLAUSE, &n), NULL);
+    ck_assert_int_eq(n, 0);
+}
+END_TEST
+
+
+TCase* node_index_tcase(void)
+{
+    TCase *tc = tcase_create("node_index");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, list_nodes_of_concrete_type);
+    tcase_add_test(tc, list_nodes_of_abstract_type);
+    tcase_add_test(tc, no_nodes_listed_without_flag);
+    tcase_add_test(tc, list_no_nodes_of_absent_type);
+    tcase_add_test(tc, fail_to_list_nodes_of_invalid_type);
+    tcase_add_test(tc, list_nodes_after_compaction);
+    tcase_add_test(tc, list_nodes_of_type_in_segments);
+    tcase_add_test(tc, no_nodes_listed_for_lazy_result);
+    return tc;
+}
@@ -0,0 +1,152 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "../../lib/src/cypher-parser.h"
+#include "memstream.h"
+#include <check.h>
+#include <errno.h>
+#include <unistd.h>
+
+
+static cypher_parser_config_t *config;
+static cypher_parse_result_t *result;
+static char *memstream_buffer;
+static size_t memstream_size;
+static FILE *memstream;
+static char *expected;
+
+
+static void setup(void)
+{
+    result = NULL;
+    expected = NULL;
+    config = cypher_parser_new_config();
+    ck_assert_ptr_ne(config, NULL);
+    memstream = open_memstream(&memstream_buffer, &memstream_size);
+}
+
+
+static void teardown(void)
+{
+    cypher_parse_result_free(result);
+    cypher_parser_config_free(config);
+    fclose(memstream);
+    free(memstream_buffer);
+    free(expected);
+}
+
+
+static void parse_and_print(const char *query, cypher_parser_config_t *cfg)
+{
+    cypher_parse_result_free(result);
+    result = cypher_parse(query, NULL, cfg, 0);
+    ck_assert_ptr_ne(result, NULL);
+    rewind(memstream);
+    memset(memstream_buffer, 0, memstream_size);
+    ck_assert(cypher_parse_result_fprint_ast(result, memstream, 0, NULL, 0) == 0);
+    fflush(memstream);
+}
+
+
+static void check_matches_serial(const char *query)
+{
+    parse_and_print(query, NULL);
+    unsigned int nerrors = cypher_parse_result_nerrors(result);
+    unsigned int nnodes = cypher_parse_result_nnodes(result);
+    free(expected);
+    expected = strdup(memstream_buffer);
+    ck_assert_ptr_ne(expected, NULL);
+
+    cypher_parser_config_set_parallel_literals(config, 8, 3);
+    parse_and_print(query, config);
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), nerrors);
+    ck_assert_int_eq(cypher_parse_result_nnodes(result), nnodes);
+    ck_assert_str_eq(memstream_buffer, expected);
+}
+
+
+START_TEST (parse_large_collection_literal)
+{
+    check_matches_serial(
+            "UNWIND [1, 2.5, 'three', [4, 5], {six: 6}, seven, 8 + 9,\n"
+            "        'a,b', \"c]d\", `e,f`, /* g, ] */ 10, 11, 12, 13]\n"
+            "   AS x RETURN x;");
+}
+END_TEST
+
+
+START_TEST (parse_large_map_literal)
+{
+    check_matches_serial(
+            "RETURN {alpha: 1, beta: 'two', gamma: [3, 4],\n"
+            "        delta: {epsilon: 5}, zeta: 6 * 7, eta: 'x}y'} AS m;\n"
+            "CREATE (n:Foo {name: 'a long enough name', age: 42, x: [1, 2]});");
+}
+END_TEST
+
+
+START_TEST (parse_multiple_large_literals)
+{
+    check_matches_serial(
+            "RETURN [1, 2, 3, 4, 5, 6, 7, 8, 9, 10], 'between',\n"
+            "       [11, 12, 13, 14, 15, 16, 17, 18, 19, 20];\n"
+            "UNWIND [21, 22, 23, 24, 25, 26] AS y RETURN y");
+}
+END_TEST
+
+
+START_TEST (parse_non_literal_brackets_serially)
+{
+    check_matches_serial(
+            "MATCH (a)-[relationship*1..3]->(b)\n"
+            "RETURN [x IN range(0, 100) WHERE x % 2 = 0 | x * x],\n"
+            "       a{.name, .age, .location}, [(a)-->(c) | c.name]");
+}
+END_TEST
+
+
+START_TEST (parse_comprehensions_over_large_literals)
+{
+    check_matches_serial(
+            "RETURN [x IN [1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12]] AS a,\n"
+            "       [ /* c */ y in [13, 14, 15, 16, 17, 18, 19, 20]] AS b,\n"
+            "       [p = (n)-->(m) | [21, 22, 23, 24, 25, 26, 27]] AS c;");
+}
+END_TEST
+
+
+START_TEST (parse_invalid_literal_serially)
+{
+    check_matches_serial(
+            "RETURN [1, 2, 3, 4, 5, 6, 7, 8 9, 10, 11, 12, 13, 14];\n"
+            "RETURN [1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14];");
+}
+END_TEST
+
+
+TCase* parallel_literals_tcase(void)
+{
+    TCase *tc = tcase_create("parallel literals");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, parse_large_collection_literal);
+    tcase_add_test(tc, parse_large_map_literal);
+    tcase_add_test(tc, parse_multiple_large_literals);
+    tcase_add_test(tc, parse_non_literal_brackets_serially);
+    tcase_add_test(tc, parse_comprehensions_over_large_literals);
+    tcase_add_test(tc, parse_invalid_literal_serially);
+    return tc;
+}
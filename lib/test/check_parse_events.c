@@ -0,0 +1,236 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "../../lib/src/cypher-parser.h"
+#include "memstream.h"
+#include <check.h>
+#include <errno.h>
+#include <string.h>
+
+
+static char *memstream_buffer;
+static size_t memstream_size;
+static FILE *memstream;
+static char *expected_buffer;
+static size_t expected_size;
+static FILE *expected;
+static char scalars[256];
+static unsigned int depth;
+static unsigned int nsegments;
+static unsigned int nerrors;
+
+
+static void setup(void)
+{
+    depth = 0;
+    nsegments = 0;
+    nerrors = 0;
+    scalars[0] = '\0';
+    memstream = open_memstream(&memstream_buffer, &memstream_size);
+    expected = open_memstream(&expected_buffer, &expected_size);
+}
+
+
+static void teardown(void)
+{
+    fclose(memstream);
+    free(memstream_buffer);
+    fclose(expected);
+    free(expected_buffer);
+}
+
+
+static void print_open(FILE *stream, unsigned int level, unsigned int index,
+        cypher_astnode_type_t type, struct cypher_input_range range)
+{
+    fprintf(stream, "%*s%u:%s %zu..%zu {\n", level * 2, "", index,
+            cypher_astnode_typestr(type), range.start.offset,
+            range.end.offset);
+}
+
+
+static void print_close(FILE *stream, unsigned int level)
+{
+    fprintf(stream, "%*s}\n", level * 2, "");
+}
+
+
+static void print_tree(FILE *stream, const cypher_astnode_t *node,
+        unsigned int level, unsigned int index)
+{
+    print_open(stream, level, index, cypher_astnode_type(node),
+            cypher_astnode_range(node));
+    unsigned int n = cypher_astnode_nchildren(node);
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        print_tree(stream, cypher_astnode_get_child(node, i), level + 1, i);
+    }
+    print_close(stream, level);
+}
+
+
+static int on_node_begin(void *userdata, const cypher_astnode_t *node,
+        cypher_astnode_type_t type, struct cypher_input_range range,
+        const cypher_astnode_t *parent, unsigned int index)
+{
+    ck_assert(cypher_astnode_type(node) == type);
+    print_open(memstream, depth, index, type, range);
+    ++depth;
+    return 0;
+}
+
+
+static int on_scalar(void *userdata, const cypher_astnode_t *node,
+        cypher_astnode_type_t type, struct cypher_input_range range,
+        const char *text, size_t length, const cypher_astnode_t *parent,
+        unsigned int index)
+{
+    ck_assert(cypher_astnode_type(node) == type);
+    ck_assert_int_eq(cypher_astnode_nchildren(node), 0);
+    print_open(memstream, depth, index, type, range);
+    print_close(memstream, depth);
+    size_t used = strlen(scalars);
+    snprintf(scalars + used, sizeof(scalars) - used, "%.*s|",
+            (int)length, text);
+    return 0;
+}
+
+
+static int on_node_end(void *userdata, const cypher_astnode_t *node,
+        cypher_astnode_type_t type, const cypher_astnode_t *parent,
+        unsigned int index)
+{
+    ck_assert(depth > 0);
+    --depth;
+    print_close(memstream, depth);
+    return 0;
+}
+
+
+static int on_error(void *userdata, const cypher_parse_error_t *error)
+{
+    ++nerrors;
+    return 0;
+}
+
+
+static int on_segment_end(void *userdata, struct cypher_input_range range,
+        const cypher_astnode_t *directive, bool eof)
+{
+    ck_assert_int_eq(depth, 0);
+    ++nsegments;
+    return (userdata != NULL)? 1 : 0;
+}
+
+
+static const struct cypher_parser_event_handlers handlers =
+    { .on_node_begin = on_node_begin,
+      .on_scalar = on_scalar,
+      .on_node_end = on_node_end,
+      .on_error = on_error,
+      .on_segment_end = on_segment_end };
+
+
+static void print_expected(const char *query)
+{
+    cypher_parse_result_t *result = cypher_parse(query, NULL, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+    unsigned int n = cypher_parse_result_nroots(result);
+    for (unsigned int i = 0; i < n; ++i)
+    {
+        print_tree(expected, cypher_parse_result_get_root(result, i), 0, i);
+    }
+    cypher_parse_result_free(result);
+    fflush(expected);
+}
+
+
+START_TEST (emit_events_for_each_segment)
+{
+    const char *query =
+            "MATCH (n:Foo)-[:BAR]->(m) RETURN n.x AS y, 'str', 1.5;\n"
+            "/* c */ RETURN 1;";
+    int result = cypher_parse_events(query, &handlers, NULL, NULL, NULL, 0);
+    ck_assert_int_eq(result, 0);
+    fflush(memstream);
+
+    print_expected(query);
+    ck_assert_str_eq(memstream_buffer, expected_buffer);
+    ck_assert_int_eq(nsegments, 2);
+    ck_assert_int_eq(nerrors, 0);
+    ck_assert_ptr_ne(strstr(scalars, "n|Foo|BAR|m|"), NULL);
+    ck_assert_ptr_ne(strstr(scalars, "|x|y|"), NULL);
+    ck_assert_ptr_ne(strstr(scalars, "|str|"), NULL);
+    ck_assert_ptr_ne(strstr(scalars, "|1.5|"), NULL);
+    ck_assert_ptr_ne(strstr(scalars, "| c |"), NULL);
+}
+END_TEST
+
+
+START_TEST (emit_errors)
+{
+    int result = cypher_parse_events("MATCH (n) RETRUN n; RETURN 1;",
+            &handlers, NULL, NULL, NULL, 0);
+    ck_assert_int_eq(result, 0);
+    ck_assert_int_eq(nsegments, 2);
+    ck_assert_int_eq(nerrors, 1);
+}
+END_TEST
+
+
+START_TEST (stop_from_handler)
+{
+    struct cypher_input_position last = cypher_input_position_zero;
+    int result = cypher_parse_events("RETURN 1; RETURN 2; RETURN 3;",
+            &handlers, (void *)1, &last, NULL, 0);
+    ck_assert_int_eq(result, 0);
+    ck_assert_int_eq(nsegments, 1);
+    ck_assert_int_eq(last.offset, 9);
+}
+END_TEST
+
+
+START_TEST (emit_events_from_stream)
+{
+    const char *query = "MATCH (n) RETURN n; RETURN 1;";
+    FILE *stream = tmpfile();
+    ck_assert_ptr_ne(stream, NULL);
+    fputs(query, stream);
+    rewind(stream);
+
+    int result = cypher_fparse_events(stream, &handlers, NULL, NULL, NULL, 0);
+    ck_assert_int_eq(result, 0);
+    fclose(stream);
+    fflush(memstream);
+
+    print_expected(query);
+    ck_assert_str_eq(memstream_buffer, expected_buffer);
+    ck_assert_int_eq(nsegments, 2);
+}
+END_TEST
+
+
+TCase* parse_events_tcase(void)
+{
+    TCase *tc = tcase_create("parse events");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, emit_events_for_each_segment);
+    tcase_add_test(tc, emit_errors);
+    tcase_add_test(tc, stop_from_handler);
+    tcase_add_test(tc, emit_events_from_stream);
+    return tc;
+}
@@ -651,6 +651,131 @@ START_TEST (parse_command_with_unclosed_quote)
 END_TEST
 
 
+START_TEST (parse_multiple_from_iovec)
+{
+    char buf1[] = "return 1; re";
+    char buf2[] = "";
+    char buf3[] = "turn 2;\n   return 3    ;";
+    struct iovec iov[] =
+        { { .iov_base = buf1, .iov_len = sizeof(buf1) - 1 },
+          { .iov_base = buf2, .iov_len = sizeof(buf2) - 1 },
+          { .iov_base = buf3, .iov_len = sizeof(buf3) - 1 } };
+
+    int result = cypher_quick_uparsev(iov, 3, segment_callback, NULL, 0);
+    ck_assert_int_eq(result, 0);
+    ck_assert_int_eq(nsegments, 3);
+
+    ck_assert(is_statement[0]);
+    ck_assert_str_eq(segments[0], "return 1");
+    ck_assert_int_eq(ranges[0].start.offset, 0);
+    ck_assert_int_eq(ranges[0].end.offset, 8);
+
+    ck_assert(is_statement[1]);
+    ck_assert_str_eq(segments[1], "return 2");
+    ck_assert_int_eq(ranges[1].start.line, 1);
+    ck_assert_int_eq(ranges[1].start.column, 11);
+    ck_assert_int_eq(ranges[1].start.offset, 10);
+    ck_assert_int_eq(ranges[1].end.line, 1);
+    ck_assert_int_eq(ranges[1].end.column, 19);
+    ck_assert_int_eq(ranges[1].end.offset, 18);
+
+    ck_assert(is_statement[2]);
+    ck_assert_str_eq(segments[2], "return 3");
+    ck_assert_int_eq(ranges[2].start.line, 2);
+    ck_assert_int_eq(ranges[2].start.column, 4);
+    ck_assert_int_eq(ranges[2].start.offset, 23);
+    ck_assert_int_eq(ranges[2].end.line, 2);
+    ck_assert_int_eq(ranges[2].end.column, 12);
+    ck_assert_int_eq(ranges[2].end.offset, 31);
+}
+END_TEST
+
+
+START_TEST (follow_segments_across_chunks)
+{
+    cypher_quick_follow_t *follow = cypher_quick_follow_new();
+    ck_assert_ptr_ne(follow, NULL);
+
+    ck_assert_int_eq(cypher_quick_ufollow(follow, "MATCH (n) RE", 12,
+                segment_callback, NULL, 0), 0);
+    ck_assert_int_eq(nsegments, 0);
+    ck_assert_int_eq(cypher_quick_follow_position(follow).offset, 0);
+
+    ck_assert_int_eq(cypher_quick_ufollow(follow, "TURN n; MATCH (m)", 17,
+                segment_callback, NULL, 0), 0);
+    ck_assert_int_eq(nsegments, 1);
+    ck_assert_int_eq(cypher_quick_follow_position(follow).offset, 19);
+
+    ck_assert_int_eq(cypher_quick_ufollow(follow, " RETURN m;\n:sch", 15,
+                segment_callback, NULL, 0), 0);
+    ck_assert_int_eq(nsegments, 2);
+
+    ck_assert_int_eq(cypher_quick_ufollow(follow, "ema\n", 4,
+                segment_callback, NULL, 0), 0);
+    ck_assert_int_eq(nsegments, 3);
+    cypher_quick_follow_free(follow);
+
+    ck_assert(is_statement[0]);
+    ck_assert_str_eq(segments[0], "MATCH (n) RETURN n");
+    ck_assert_int_eq(ranges[0].start.offset, 0);
+    ck_assert_int_eq(ranges[0].end.offset, 18);
+    ck_assert_int_eq(nexts[0].column, 20);
+    ck_assert_int_eq(nexts[0].offset, 19);
+    ck_assert(!eofs[0]);
+
+    ck_assert(is_statement[1]);
+    ck_assert_str_eq(segments[1], "MATCH (m) RETURN m");
+    ck_assert_int_eq(ranges[1].start.line, 1);
+    ck_assert_int_eq(ranges[1].start.column, 21);
+    ck_assert_int_eq(ranges[1].start.offset, 20);
+    ck_assert_int_eq(ranges[1].end.offset, 38);
+    ck_assert_int_eq(nexts[1].offset, 39);
+    ck_assert(!eofs[1]);
+
+    ck_assert(!is_statement[2]);
+    ck_assert_str_eq(segments[2], ":schema");
+    ck_assert_int_eq(ranges[2].start.line, 2);
+    ck_assert_int_eq(ranges[2].start.column, 1);
+    ck_assert_int_eq(ranges[2].start.offset, 40);
+    ck_assert_int_eq(ranges[2].end.offset, 47);
+    ck_assert_int_eq(nexts[2].line, 3);
+    ck_assert_int_eq(nexts[2].column, 1);
+    ck_assert_int_eq(nexts[2].offset, 48);
+    ck_assert(!eofs[2]);
+}
+END_TEST
+
+
+START_TEST (follow_quote_and_comment_across_chunks)
+{
+    cypher_quick_follow_t *follow = cypher_quick_follow_new();
+    ck_assert_ptr_ne(follow, NULL);
+
+    ck_assert_int_eq(cypher_quick_ufollow(follow, "RETURN 'a;", 10,
+                segment_callback, NULL, 0), 0);
+    ck_assert_int_eq(cypher_quick_ufollow(follow, "b' /", 4,
+                segment_callback, NULL, 0), 0);
+    ck_assert_int_eq(cypher_quick_ufollow(follow, "* ; */;", 7,
+                segment_callback, NULL, 0), 0);
+    ck_assert_int_eq(nsegments, 1);
+    ck_assert_str_eq(segments[0], "RETURN 'a;b'");
+    ck_assert_int_eq(nexts[0].offset, 21);
+
+    ck_assert_int_eq(cypher_quick_ufollow(follow, " RETURN 1", 9,
+                segment_callback, NULL, 0), 0);
+    ck_assert_int_eq(nsegments, 1);
+    ck_assert_int_eq(cypher_quick_follow_finish(follow, segment_callback,
+                NULL, 0), 0);
+    ck_assert_int_eq(nsegments, 2);
+    ck_assert_str_eq(segments[1], "RETURN 1");
+    ck_assert_int_eq(ranges[1].start.offset, 22);
+    ck_assert(eofs[1]);
+    ck_assert_int_eq(cypher_quick_follow_position(follow).offset, 30);
+    cypher_quick_follow_free(follow);
+}
+END_TEST
+
+
 TCase* quick_parse_tcase(void)
 {
     TCase *tc = tcase_create("quick_parse");
@@ -660,6 +785,7 @@ TCase* quick_parse_tcase(void)
     tcase_add_test(tc, parse_whitespace_statement);
     tcase_add_test(tc, parse_single);
     tcase_add_test(tc, parse_multiple);
+    tcase_add_test(tc, parse_multiple_from_iovec);
     tcase_add_test(tc, parse_commands);
     tcase_add_test(tc, parse_statements_only);
     tcase_add_test(tc, parse_eof_statement);
@@ -675,5 +801,7 @@ TCase* quick_parse_tcase(void)
     tcase_add_test(tc, parse_command_with_unclosed_block_comment);
     tcase_add_test(tc, parse_statement_with_unclosed_quote);
     tcase_add_test(tc, parse_command_with_unclosed_quote);
+    tcase_add_test(tc, follow_segments_across_chunks);
+    tcase_add_test(tc, follow_quote_and_comment_across_chunks);
     return tc;
 }
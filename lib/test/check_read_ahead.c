@@ -0,0 +1,173 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "../../lib/src/cypher-parser.h"
+#include "memstream.h"
+#include <check.h>
+#include <errno.h>
+#include <unistd.h>
+
+
+static const char *input =
+    "/* first */ MATCH (n:Foo) RETURN n;\n"
+    "RETURN 1 + 2 AS three; ;\n"
+    "// a comment\n"
+    "MATCH (n) RETRUN n;\n"
+    "CREATE (m:Bar {x: [1, 2, 3]}) RETURN m";
+
+static cypher_parser_config_t *config;
+static cypher_parse_result_t *result;
+static FILE *stream;
+static char *memstream_buffer;
+static size_t memstream_size;
+static FILE *memstream;
+
+
+static void setup(void)
+{
+    result = NULL;
+    config = cypher_parser_new_config();
+    ck_assert_ptr_ne(config, NULL);
+    stream = tmpfile();
+    ck_assert_ptr_ne(stream, NULL);
+    fputs(input, stream);
+    rewind(stream);
+    memstream = open_memstream(&memstream_buffer, &memstream_size);
+}
+
+
+static void teardown(void)
+{
+    cypher_parse_result_free(result);
+    cypher_parser_config_free(config);
+    fclose(stream);
+    fclose(memstream);
+    free(memstream_buffer);
+}
+
+
+static char *print_result(const cypher_parse_result_t *r)
+{
+    rewind(memstream);
+    memset(memstream_buffer, 0, memstream_size);
+    ck_assert(cypher_parse_result_fprint_ast(r, memstream, 0, NULL, 0) == 0);
+    fflush(memstream);
+    char *s = strdup(memstream_buffer);
+    ck_assert_ptr_ne(s, NULL);
+    return s;
+}
+
+
+static void check_matches_buffer_parse(void)
+{
+    cypher_parse_result_t *full = cypher_parse(input, NULL, NULL, 0);
+    ck_assert_ptr_ne(full, NULL);
+
+    ck_assert_int_eq(cypher_parse_result_nnodes(result),
+            cypher_parse_result_nnodes(full));
+    ck_assert_int_eq(cypher_parse_result_nerrors(result),
+            cypher_parse_result_nerrors(full));
+    ck_assert(cypher_parse_result_eof(result) ==
+            cypher_parse_result_eof(full));
+
+    char *expected = print_result(full);
+    char *actual = print_result(result);
+    ck_assert_str_eq(actual, expected);
+    free(expected);
+    free(actual);
+    cypher_parse_result_free(full);
+}
+
+
+START_TEST (parse_stream_with_read_ahead)
+{
+    // blocks smaller than a statement, so many are exchanged
+    cypher_parser_config_set_read_ahead(config, 7);
+    struct cypher_input_position last = cypher_input_position_zero;
+    result = cypher_fparse(stream, &last, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(last.offset, strlen(input));
+    check_matches_buffer_parse();
+}
+END_TEST
+
+
+START_TEST (parse_stream_with_large_read_ahead_block)
+{
+    cypher_parser_config_set_read_ahead(config, 65536);
+    result = cypher_fparse(stream, NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+    check_matches_buffer_parse();
+}
+END_TEST
+
+
+static int count_segments(void *userdata, cypher_parse_segment_t *segment)
+{
+    unsigned int *n = userdata;
+    ++(*n);
+    return 0;
+}
+
+
+START_TEST (parse_each_segment_with_read_ahead)
+{
+    unsigned int expected = 0;
+    ck_assert_int_eq(cypher_parse_each(input, count_segments, &expected,
+                NULL, NULL, 0), 0);
+    ck_assert_int_gt(expected, 1);
+
+    cypher_parser_config_set_read_ahead(config, 16);
+    unsigned int nsegments = 0;
+    struct cypher_input_position last = cypher_input_position_zero;
+    ck_assert_int_eq(cypher_fparse_each(stream, count_segments, &nsegments,
+                &last, config, 0), 0);
+    ck_assert_int_eq(nsegments, expected);
+    ck_assert_int_eq(last.offset, strlen(input));
+}
+END_TEST
+
+
+static int stop_after_first(void *userdata, cypher_parse_segment_t *segment)
+{
+    unsigned int *n = userdata;
+    ++(*n);
+    return 1;
+}
+
+
+START_TEST (stop_parse_each_with_read_ahead)
+{
+    cypher_parser_config_set_read_ahead(config, 8);
+    unsigned int nsegments = 0;
+    ck_assert_int_eq(cypher_fparse_each(stream, stop_after_first, &nsegments,
+                NULL, config, 0), 0);
+    ck_assert_int_eq(nsegments, 1);
+}
+END_TEST
+
+
+TCase* read_ahead_tcase(void)
+{
+    TCase *tc = tcase_create("read ahead");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, parse_stream_with_read_ahead);
+    tcase_add_test(tc, parse_stream_with_large_read_ahead_block);
+    tcase_add_test(tc, parse_each_segment_with_read_ahead);
+    tcase_add_test(tc, stop_parse_each_with_read_ahead);
+    return tc;
+}
@@ -0,0 +1,172 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "../../lib/src/cypher-parser.h"
+#include <check.h>
+#include <errno.h>
+
+
+static const char *input = "MATCH (n) RETURN n; MATCH (m) RETURN m;";
+
+static cypher_ast_annotation_context_t *ctx;
+static unsigned int released;
+static cypher_parse_segment_t *segments[8];
+static unsigned int nsegments;
+
+
+static void release_handler(void *userdata, const cypher_astnode_t *node,
+        void *annotation)
+{
+    released++;
+    ck_assert_ptr_eq(annotation, userdata);
+}
+
+
+static void setup(void)
+{
+    ctx = cypher_ast_annotation_context();
+    ck_assert_ptr_ne(ctx, NULL);
+    released = 0;
+    nsegments = 0;
+    ck_assert_int_eq(cypher_parser_reclaim(), 0);
+}
+
+
+static void teardown(void)
+{
+    cypher_parser_stop_reclaimer();
+    cypher_parser_reclaim();
+    cypher_ast_annotation_context_free(ctx);
+}
+
+
+static int retain_segment(void *data, cypher_parse_segment_t *segment)
+{
+    ck_assert_int_lt(nsegments, 8);
+    cypher_parse_segment_retain(segment);
+    segments[nsegments++] = segment;
+    return 0;
+}
+
+
+START_TEST (free_result_when_reclaimed)
+{
+    void *ptr = (void *)"foo";
+    cypher_ast_annotation_context_set_release_handler(ctx, release_handler,
+            ptr);
+
+    cypher_parse_result_t *result = cypher_parse(input, NULL, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 1);
+    ck_assert_int_eq(cypher_astnode_attach_annotation(ctx, ast, ptr, NULL), 0);
+
+    cypher_parse_result_free_deferred(result);
+    // release handlers are invoked before the result is queued
+    ck_assert_int_eq(released, 1);
+    ck_assert_int_eq(cypher_parser_reclaim(), 1);
+    ck_assert_int_eq(cypher_parser_reclaim(), 0);
+
+    cypher_ast_annotation_context_free(ctx);
+    ctx = NULL;
+    ck_assert_int_eq(released, 1);
+}
+END_TEST
+
+
+START_TEST (release_segment_when_reclaimed)
+{
+    void *ptr = (void *)"foo";
+    cypher_ast_annotation_context_set_release_handler(ctx, release_handler,
+            ptr);
+
+    ck_assert_int_eq(cypher_parse_each(input, retain_segment, NULL, NULL,
+                NULL, 0), 0);
+    ck_assert_int_eq(nsegments, 2);
+    const cypher_astnode_t *ast = cypher_parse_segment_get_directive(
+            segments[0]);
+    ck_assert_int_eq(cypher_astnode_attach_annotation(ctx, ast, ptr, NULL), 0);
+
+    // a retained segment is not queued until its last reference is released
+    cypher_parse_segment_retain(segments[0]);
+    cypher_parse_segment_release_deferred(segments[0]);
+    ck_assert_int_eq(released, 0);
+    ck_assert_int_eq(cypher_parser_reclaim(), 0);
+    ck_assert_ptr_eq(cypher_astnode_get_annotation(ctx, ast), ptr);
+
+    cypher_parse_segment_release_deferred(segments[0]);
+    ck_assert_int_eq(released, 1);
+    cypher_parse_segment_release_deferred(segments[1]);
+    ck_assert_int_eq(cypher_parser_reclaim(), 2);
+}
+END_TEST
+
+
+START_TEST (free_lazy_result_when_reclaimed)
+{
+    cypher_parser_config_t *config = cypher_parser_new_config();
+    ck_assert_ptr_ne(config, NULL);
+    cypher_parser_config_set_lazy_segments(config, 1);
+    cypher_parse_result_t *result = cypher_parse(input, NULL, config, 0);
+    cypher_parser_config_free(config);
+    ck_assert_ptr_ne(result, NULL);
+
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 0);
+    ck_assert_ptr_ne(ast, NULL);
+    ck_assert_int_eq(cypher_astnode_attach_annotation(ctx, ast, ctx, NULL), 0);
+
+    cypher_parse_result_free_deferred(result);
+    ck_assert_ptr_eq(cypher_astnode_get_annotation(ctx, ast), NULL);
+    // the materialized segment is queued along with the result
+    ck_assert_int_eq(cypher_parser_reclaim(), 2);
+}
+END_TEST
+
+
+START_TEST (reclaim_on_background_thread)
+{
+#ifdef HAVE_PTHREADS
+    ck_assert_int_eq(cypher_parser_start_reclaimer(), 0);
+    ck_assert_int_eq(cypher_parser_start_reclaimer(), 0);
+
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+        cypher_parse_result_t *result = cypher_parse(input, NULL, NULL, 0);
+        ck_assert_ptr_ne(result, NULL);
+        cypher_parse_result_free_deferred(result);
+    }
+
+    // stopping reclaims everything already queued
+    cypher_parser_stop_reclaimer();
+    ck_assert_int_eq(cypher_parser_reclaim(), 0);
+#else
+    ck_assert_int_eq(cypher_parser_start_reclaimer(), -1);
+    ck_assert_int_eq(errno, ENOTSUP);
+#endif
+}
+END_TEST
+
+
+TCase* reclaim_tcase(void)
+{
+    TCase *tc = tcase_create("reclaim");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, free_result_when_reclaimed);
+    tcase_add_test(tc, release_segment_when_reclaimed);
+    tcase_add_test(tc, free_lazy_result_when_reclaimed);
+    tcase_add_test(tc, reclaim_on_background_thread);
+    return tc;
+}
@@ -227,6 +227,67 @@ START_TEST (segments_with_directives)
 END_TEST
 
 
+START_TEST (segments_validate_only)
+{
+    retain = true;
+
+    const char *input = " return 1; /* foo */; retrun 2; return [3 4";
+    cypher_parse_result_t *full = cypher_parse(input, NULL, NULL, 0);
+    ck_assert_ptr_ne(full, NULL);
+
+    struct cypher_input_position last = cypher_input_position_zero;
+    int result = cypher_parse_each(input, segment_callback, NULL, &last, NULL,
+            CYPHER_PARSE_VALIDATE_ONLY);
+    ck_assert_int_eq(result, 0);
+    ck_assert_int_eq(last.offset, 43);
+
+    fflush(memstream);
+    const char *expected = "\n"
+"--1--\n"
+"--2--\n"
+"--3--\n"
+"--4--\n";
+    ck_assert_str_eq(memstream_buffer, expected);
+
+    ck_assert_int_eq(nsegments, 4);
+    ck_assert_int_eq(ranges[0].end.offset, 10);
+    ck_assert_int_eq(ranges[1].end.offset, 21);
+    ck_assert_int_eq(ranges[2].end.offset, 31);
+    ck_assert_int_eq(ranges[3].end.offset, 43);
+
+    unsigned int nerrors = 0;
+    for (unsigned int i = 0; i < nsegments; ++i)
+    {
+        ck_assert_ptr_eq(directives[i], NULL);
+        ck_assert_int_eq(cypher_parse_segment_nnodes(segments[i]), 0);
+        for (unsigned int j = 0;
+                j < cypher_parse_segment_nerrors(segments[i]); ++j, ++nerrors)
+        {
+            const cypher_parse_error_t *err =
+                    cypher_parse_segment_get_error(segments[i], j);
+            const cypher_parse_error_t *expected_err =
+                    cypher_parse_result_get_error(full, nerrors);
+            ck_assert_ptr_ne(expected_err, NULL);
+            struct cypher_input_position pos =
+                    cypher_parse_error_position(err);
+            struct cypher_input_position expected_pos =
+                    cypher_parse_error_position(expected_err);
+            ck_assert_int_eq(pos.offset, expected_pos.offset);
+            ck_assert_str_eq(cypher_parse_error_message(err),
+                    cypher_parse_error_message(expected_err));
+            ck_assert_str_eq(cypher_parse_error_context(err),
+                    cypher_parse_error_context(expected_err));
+        }
+    }
+    ck_assert_int_eq(nerrors, cypher_parse_result_nerrors(full));
+    ck_assert(nerrors >= 2);
+    ck_assert(cypher_parse_segment_is_eof(segments[3]));
+
+    cypher_parse_result_free(full);
+}
+END_TEST
+
+
 TCase* segments_tcase(void)
 {
     TCase *tc = tcase_create("segments");
@@ -235,5 +296,6 @@ TCase* segments_tcase(void)
     tcase_add_test(tc, single_segment_without_directive);
     tcase_add_test(tc, single_segment_with_only_a_comment);
     tcase_add_test(tc, segments_with_directives);
+    tcase_add_test(tc, segments_validate_only);
     return tc;
 }
@@ -0,0 +1,195 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "../../lib/src/cypher-parser.h"
+#include "memstream.h"
+#include <check.h>
+#include <errno.h>
+#include <string.h>
+
+
+static cypher_parser_config_t *config;
+static cypher_slowlog_t *slowlog;
+static cypher_parse_result_t *result;
+static char *memstream_buffer;
+static size_t memstream_size;
+static FILE *memstream;
+
+
+static void setup(void)
+{
+    config = cypher_parser_new_config();
+    ck_assert_ptr_ne(config, NULL);
+    slowlog = NULL;
+    result = NULL;
+    memstream = open_memstream(&memstream_buffer, &memstream_size);
+}
+
+
+static void teardown(void)
+{
+    cypher_parse_result_free(result);
+    cypher_parser_config_free(config);
+    cypher_slowlog_free(slowlog);
+    fclose(memstream);
+    free(memstream_buffer);
+}
+
+
+static void use_slowlog(unsigned int capacity, uint64_t duration_threshold,
+        unsigned int nodes_threshold)
+{
+    slowlog = cypher_slowlog_new(capacity, duration_threshold,
+            nodes_threshold);
+    ck_assert_ptr_ne(slowlog, NULL);
+    cypher_parser_config_set_slowlog(config, slowlog);
+}
+
+
+START_TEST (record_parses_over_node_threshold)
+{
+    use_slowlog(4, 0, 10);
+    result = cypher_parse("RETURN 1;\nMATCH (n) WHERE n.x > 1 RETURN n;",
+            NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+
+    struct cypher_slowlog_entry entries[4];
+    ck_assert_int_eq(cypher_slowlog_get_entries(slowlog, entries, 4), 1);
+    ck_assert_int_eq(entries[0].sequence, 0);
+    ck_assert_int_ge(entries[0].nnodes, 10);
+    ck_assert_int_eq(entries[0].nerrors, 0);
+    ck_assert_int_gt(entries[0].nallocations, entries[0].nnodes);
+    ck_assert_int_eq(entries[0].range.start.offset, 9);
+    ck_assert_int_eq(entries[0].range.end.offset, 43);
+    ck_assert_str_eq(entries[0].prefix, "\nMATCH (n) WHERE n.x > 1 RETURN n;");
+    ck_assert_int_eq(entries[0].prefix_length, 34);
+}
+END_TEST
+
+
+START_TEST (record_errors)
+{
+    use_slowlog(4, 1, 0);
+    result = cypher_parse("MATCH (n) RETURN n; MATCH (n) RETRUN n;",
+            NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+
+    struct cypher_slowlog_entry entries[4];
+    ck_assert_int_eq(cypher_slowlog_get_entries(slowlog, entries, 4), 2);
+    ck_assert_int_eq(entries[0].nerrors, 0);
+    ck_assert_int_eq(entries[1].nerrors, 1);
+}
+END_TEST
+
+
+START_TEST (record_nothing_under_thresholds)
+{
+    use_slowlog(4, UINT64_MAX, 1000);
+    result = cypher_parse("MATCH (n) RETURN n; MATCH (m) RETURN m;",
+            NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+
+    struct cypher_slowlog_entry entries[4];
+    ck_assert_int_eq(cypher_slowlog_get_entries(slowlog, entries, 4), 0);
+    ck_assert_int_eq(cypher_slowlog_ndropped(slowlog), 0);
+}
+END_TEST
+
+
+START_TEST (retain_most_recent_entries)
+{
+    use_slowlog(2, 0, 1);
+    result = cypher_parse("RETURN 1; RETURN 2; RETURN 3;", NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+
+    struct cypher_slowlog_entry entries[4];
+    ck_assert_int_eq(cypher_slowlog_get_entries(slowlog, entries, 4), 2);
+    ck_assert_int_eq(entries[0].sequence, 1);
+    ck_assert_str_eq(entries[0].prefix, " RETURN 2;");
+    ck_assert_int_eq(entries[1].sequence, 2);
+    ck_assert_str_eq(entries[1].prefix, " RETURN 3;");
+
+    ck_assert_int_eq(cypher_slowlog_get_entries(slowlog, entries, 1), 1);
+    ck_assert_int_eq(entries[0].sequence, 2);
+}
+END_TEST
+
+
+START_TEST (truncate_long_input)
+{
+    char input[512];
+    strcpy(input, "RETURN [");
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+        strcat(input, "1,");
+    }
+    strcat(input, "2];");
+
+    use_slowlog(4, 0, 1);
+    result = cypher_parse(input, NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+
+    struct cypher_slowlog_entry entries[4];
+    ck_assert_int_eq(cypher_slowlog_get_entries(slowlog, entries, 4), 1);
+    ck_assert_int_eq(entries[0].prefix_length, CYPHER_SLOWLOG_PREFIX_LENGTH);
+    ck_assert_int_eq(strlen(entries[0].prefix), CYPHER_SLOWLOG_PREFIX_LENGTH);
+    ck_assert(strncmp(entries[0].prefix, input,
+                CYPHER_SLOWLOG_PREFIX_LENGTH) == 0);
+    ck_assert_int_eq(entries[0].range.end.offset, strlen(input));
+}
+END_TEST
+
+
+START_TEST (print_entries)
+{
+    use_slowlog(4, 0, 1);
+    result = cypher_parse("RETURN 1;\nRETURN\t2;", NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+
+    ck_assert_int_eq(cypher_slowlog_fprint(slowlog, memstream), 0);
+    fflush(memstream);
+    ck_assert_ptr_ne(strstr(memstream_buffer, "#0 @1:1 "), NULL);
+    ck_assert_ptr_ne(strstr(memstream_buffer, " 9 bytes "), NULL);
+    ck_assert_ptr_ne(strstr(memstream_buffer, "errors: RETURN 1;\n"), NULL);
+    ck_assert_ptr_ne(strstr(memstream_buffer, "#1 @1:10 "), NULL);
+    ck_assert_ptr_ne(strstr(memstream_buffer, "errors:  RETURN 2;\n"), NULL);
+}
+END_TEST
+
+
+START_TEST (fail_to_create_empty_slowlog)
+{
+    errno = 0;
+    ck_assert_ptr_eq(cypher_slowlog_new(0, 1, 1), NULL);
+    ck_assert_int_eq(errno, EINVAL);
+}
+END_TEST
+
+
+TCase* slowlog_tcase(void)
+{
+    TCase *tc = tcase_create("slowlog");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, record_parses_over_node_threshold);
+    tcase_add_test(tc, record_errors);
+    tcase_add_test(tc, record_nothing_under_thresholds);
+    tcase_add_test(tc, retain_most_recent_entries);
+    tcase_add_test(tc, truncate_long_input);
+    tcase_add_test(tc, print_entries);
+    tcase_add_test(tc, fail_to_create_empty_slowlog);
+    return tc;
+}
@@ -388,6 +388,43 @@ START_TEST (parse_params_only_without_params)
 END_TEST
 
 
+START_TEST (parse_params_with_statement)
+{
+    result = cypher_parse("CYPHER a=1 b='str' RETURN $a, $b", NULL, NULL,
+            CYPHER_PARSE_WITH_PARAMETERS);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 0);
+    ck_assert_int_eq(cypher_parse_result_ndirectives(result), 1);
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 0);
+    ck_assert_int_eq(cypher_astnode_type(ast), CYPHER_AST_STATEMENT);
+
+    const cypher_astnode_t *body = cypher_ast_statement_get_body(ast);
+    ck_assert_int_eq(cypher_astnode_type(body), CYPHER_AST_QUERY);
+    struct cypher_input_range r = cypher_astnode_range(body);
+    ck_assert_int_eq(r.start.offset, 19);
+
+    ck_assert_int_eq(cypher_ast_statement_nparams(ast), 2);
+    const cypher_astnode_t *param = cypher_ast_statement_get_param(ast, 0);
+    ck_assert_int_eq(cypher_astnode_type(param),
+            CYPHER_AST_CYPHER_OPTION_PARAM);
+    const cypher_astnode_t *name =
+            cypher_ast_cypher_option_param_get_name(param);
+    ck_assert_str_eq(cypher_ast_string_get_value(name), "a");
+    const cypher_astnode_t *value =
+            cypher_ast_cypher_option_param_get_value(param);
+    ck_assert_str_eq(cypher_ast_integer_get_valuestr(value), "1");
+
+    param = cypher_ast_statement_get_param(ast, 1);
+    name = cypher_ast_cypher_option_param_get_name(param);
+    ck_assert_str_eq(cypher_ast_string_get_value(name), "b");
+    value = cypher_ast_cypher_option_param_get_value(param);
+    ck_assert_str_eq(cypher_ast_string_get_value(value), "str");
+
+    ck_assert_ptr_eq(cypher_ast_statement_get_param(ast, 2), NULL);
+}
+END_TEST
+
+
 START_TEST (parse_statement_with_cypher_option_containing_params)
 {
     result = cypher_parse("CYPHER runtime=\"fast\" RETURN 1;",
@@ -613,5 +650,6 @@ TCase* statement_tcase(void)
     tcase_add_test(tc, parse_statement_params_types);
     tcase_add_test(tc, parse_params_only);
     tcase_add_test(tc, parse_params_only_without_params);
+    tcase_add_test(tc, parse_params_with_statement);
     return tc;
 }
@@ -0,0 +1,233 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "../../lib/src/cypher-parser.h"
+#include <check.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+
+static cypher_parser_config_t *config;
+static cypher_parse_result_t *result;
+
+
+static void setup(void)
+{
+    result = NULL;
+    config = cypher_parser_new_config();
+    ck_assert_ptr_ne(config, NULL);
+    cypher_parser_config_set_utf8_validation(config, true);
+}
+
+
+static void teardown(void)
+{
+    cypher_parse_result_free(result);
+    cypher_parser_config_free(config);
+}
+
+
+START_TEST (accept_valid_utf8)
+{
+    result = cypher_parse("RETURN '\xC3\xB1\xE2\x82\xAC\xF0\x9F\x98\x80' AS s",
+            NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 0);
+    ck_assert_int_eq(cypher_parse_result_ndirectives(result), 1);
+}
+END_TEST
+
+
+START_TEST (report_invalid_byte)
+{
+    result = cypher_parse("RETURN 'a\xFF" "b'", NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_ndirectives(result), 1);
+
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 1);
+    const cypher_parse_error_t *err = cypher_parse_result_get_error(result, 0);
+    struct cypher_input_position pos = cypher_parse_error_position(err);
+    ck_assert_int_eq(pos.line, 1);
+    ck_assert_int_eq(pos.column, 10);
+    ck_assert_int_eq(pos.offset, 9);
+    ck_assert_str_eq(cypher_parse_error_message(err),
+            "Invalid input '\\xFF': not valid UTF-8");
+}
+END_TEST
+
+
+START_TEST (not_validated_by_default)
+{
+    result = cypher_parse("RETURN 'a\xFF" "b'", NULL, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_ndirectives(result), 1);
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 0);
+}
+END_TEST
+
+
+START_TEST (report_truncated_sequences_in_each_statement)
+{
+    result = cypher_parse(
+            "RETURN '\xE2\x82" "x';\n"
+            "RETURN '\xC3';",
+            NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_ndirectives(result), 2);
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 2);
+
+    const cypher_parse_error_t *err = cypher_parse_result_get_error(result, 0);
+    struct cypher_input_position pos = cypher_parse_error_position(err);
+    ck_assert_int_eq(pos.line, 1);
+    ck_assert_int_eq(pos.column, 9);
+    ck_assert_int_eq(pos.offset, 8);
+    ck_assert_str_eq(cypher_parse_error_message(err),
+            "Invalid input '\\xE2': not valid UTF-8");
+
+    err = cypher_parse_result_get_error(result, 1);
+    pos = cypher_parse_error_position(err);
+    ck_assert_int_eq(pos.line, 2);
+    ck_assert_int_eq(pos.column, 9);
+    ck_assert_int_eq(pos.offset, 22);
+    ck_assert_str_eq(cypher_parse_error_message(err),
+            "Invalid input '\\xC3': not valid UTF-8");
+}
+END_TEST
+
+
+START_TEST (report_truncated_sequence_at_end_of_input)
+{
+    result = cypher_parse("RETURN 1 // \xF0\x9F", NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_ndirectives(result), 1);
+
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 1);
+    const cypher_parse_error_t *err = cypher_parse_result_get_error(result, 0);
+    struct cypher_input_position pos = cypher_parse_error_position(err);
+    ck_assert_int_eq(pos.line, 1);
+    ck_assert_int_eq(pos.column, 13);
+    ck_assert_int_eq(pos.offset, 12);
+    ck_assert_str_eq(cypher_parse_error_message(err),
+            "Invalid input '\\xF0': not valid UTF-8");
+}
+END_TEST
+
+
+START_TEST (report_overlong_and_surrogate_encodings)
+{
+    result = cypher_parse("RETURN '\xC0\xAF', '\xED\xA0\x80'", NULL, config, 0);
+    ck_assert_ptr_ne(result, NULL);
+
+    // neither an overlong encoding nor an encoded surrogate can begin a
+    // valid sequence, so each of their bytes is reported
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 5);
+    const unsigned int offsets[] = { 8, 9, 14, 15, 16 };
+    for (unsigned int i = 0; i < 5; ++i)
+    {
+        const cypher_parse_error_t *err =
+                cypher_parse_result_get_error(result, i);
+        ck_assert_int_eq(cypher_parse_error_position(err).offset, offsets[i]);
+    }
+}
+END_TEST
+
+
+START_TEST (report_invalid_byte_in_long_statement_from_stream)
+{
+    FILE *stream = tmpfile();
+    ck_assert_ptr_ne(stream, NULL);
+    fputs("UNWIND ['\xFF'] AS x\n", stream);
+    for (unsigned int i = 0; i < 2000; ++i)
+    {
+        fputs("WITH x\n", stream);
+    }
+    fputs("RETURN x", stream);
+    rewind(stream);
+
+    result = cypher_fparse(stream, NULL, config, 0);
+    fclose(stream);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_ndirectives(result), 1);
+
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 1);
+    const cypher_parse_error_t *err = cypher_parse_result_get_error(result, 0);
+    struct cypher_input_position pos = cypher_parse_error_position(err);
+    ck_assert_int_eq(pos.line, 1);
+    ck_assert_int_eq(pos.column, 10);
+    ck_assert_int_eq(pos.offset, 9);
+    ck_assert_str_eq(cypher_parse_error_context(err), "UNWIND ['\xFF'] AS x");
+}
+END_TEST
+
+
+START_TEST (parse_unicode_symbolic_names)
+{
+    result = cypher_parse("MATCH (\xC3\xB1" "and\xC3\xBA:\xC3\x89tiquette) "
+            "RETURN \xC3\xB1" "and\xC3\xBA" "2, \xE5\x90\x8D\xE5\x89\x8D",
+            NULL, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 0);
+    ck_assert_int_eq(cypher_parse_result_ndirectives(result), 1);
+
+    const cypher_astnode_t *ast = cypher_parse_result_get_directive(result, 0);
+    const cypher_astnode_t *query = cypher_ast_statement_get_body(ast);
+    const cypher_astnode_t *clause = cypher_ast_query_get_clause(query, 1);
+    ck_assert_int_eq(cypher_astnode_type(clause), CYPHER_AST_RETURN);
+
+    const cypher_astnode_t *proj = cypher_ast_return_get_projection(clause, 0);
+    const cypher_astnode_t *id = cypher_ast_projection_get_expression(proj);
+    ck_assert_int_eq(cypher_astnode_type(id), CYPHER_AST_IDENTIFIER);
+    ck_assert_str_eq(cypher_ast_identifier_get_name(id),
+            "\xC3\xB1" "and\xC3\xBA" "2");
+
+    proj = cypher_ast_return_get_projection(clause, 1);
+    id = cypher_ast_projection_get_expression(proj);
+    ck_assert_int_eq(cypher_astnode_type(id), CYPHER_AST_IDENTIFIER);
+    ck_assert_str_eq(cypher_ast_identifier_get_name(id),
+            "\xE5\x90\x8D\xE5\x89\x8D");
+}
+END_TEST
+
+
+START_TEST (reject_non_identifier_characters_in_symbolic_names)
+{
+    // U+20AC (euro sign) is not a letter
+    result = cypher_parse("RETURN a\xE2\x82\xAC", NULL, NULL, 0);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 1);
+    const cypher_parse_error_t *err = cypher_parse_result_get_error(result, 0);
+    ck_assert_int_eq(cypher_parse_error_position(err).offset, 8);
+}
+END_TEST
+
+
+TCase* utf8_tcase(void)
+{
+    TCase *tc = tcase_create("utf8");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, accept_valid_utf8);
+    tcase_add_test(tc, report_invalid_byte);
+    tcase_add_test(tc, not_validated_by_default);
+    tcase_add_test(tc, report_truncated_sequences_in_each_statement);
+    tcase_add_test(tc, report_truncated_sequence_at_end_of_input);
+    tcase_add_test(tc, report_overlong_and_surrogate_encodings);
+    tcase_add_test(tc, report_invalid_byte_in_long_statement_from_stream);
+    tcase_add_test(tc, parse_unicode_symbolic_names);
+    tcase_add_test(tc, reject_non_identifier_characters_in_symbolic_names);
+    return tc;
+}
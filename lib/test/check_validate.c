@@ -0,0 +1,221 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "../../lib/src/cypher-parser.h"
+#include <check.h>
+#include <errno.h>
+#include <string.h>
+
+
+static cypher_parse_result_t *result;
+static cypher_validation_t *errors;
+
+
+static void setup(void)
+{
+    result = NULL;
+    errors = NULL;
+}
+
+
+static void teardown(void)
+{
+    cypher_validation_free(errors);
+    cypher_parse_result_free(result);
+}
+
+
+static int validate(const char *s)
+{
+    cypher_validation_free(errors);
+    errors = NULL;
+    cypher_parse_result_free(result);
+    result = cypher_parse(s, NULL, NULL, CYPHER_PARSE_ONLY_STATEMENTS);
+    ck_assert_ptr_ne(result, NULL);
+    ck_assert_int_eq(cypher_parse_result_nerrors(result), 0);
+
+    int n = cypher_ast_validate(result, &errors);
+    ck_assert_int_ge(n, 0);
+    if (n == 0)
+    {
+        ck_assert_ptr_eq(errors, NULL);
+    }
+    else
+    {
+        ck_assert_ptr_ne(errors, NULL);
+        ck_assert_int_eq(cypher_validation_nerrors(errors), n);
+    }
+    return n;
+}
+
+
+static void assert_error(unsigned int index, size_t offset, const char *msg)
+{
+    const cypher_parse_error_t *err =
+            cypher_validation_get_error(errors, index);
+    ck_assert_ptr_ne(err, NULL);
+    ck_assert_int_eq(cypher_parse_error_position(err).offset, offset);
+    ck_assert_str_eq(cypher_parse_error_message(err), msg);
+}
+
+
+START_TEST (accept_valid_queries)
+{
+    ck_assert_int_eq(validate("MATCH (n)-[r:R]->(m) WHERE n.x = $p "
+                "RETURN n, r, m.y AS y ORDER BY y"), 0);
+    ck_assert_int_eq(validate("MATCH (n) WITH n, count(*) AS c WHERE c > 1 "
+                "RETURN n.x AS x, sum(c) AS total"), 0);
+    ck_assert_int_eq(validate("UNWIND [1, 2] AS x "
+                "RETURN [y IN range(0, x) WHERE y > 0 | y * 2] AS l"), 0);
+    ck_assert_int_eq(validate("MATCH p = (n)-->() "
+                "FOREACH (m IN nodes(p) | SET m.seen = true) DELETE p"), 0);
+    ck_assert_int_eq(validate("MATCH (n) RETURN n.x AS x, count(*) AS c "
+                "UNION MATCH (m) RETURN m.x AS x, count(*) AS c"), 0);
+    ck_assert_int_eq(validate("RETURN reduce(acc = 0, x IN [1, 2] | acc + x) "
+                "AS total"), 0);
+    ck_assert_int_eq(validate("MATCH (n) RETURN [(n)-->(m) | m.name] AS names"),
+            0);
+    ck_assert_int_eq(validate("CALL db.labels() YIELD label RETURN label"), 0);
+    ck_assert_int_eq(validate("MATCH (n) WITH * RETURN *"), 0);
+}
+END_TEST
+
+
+START_TEST (report_undefined_variables)
+{
+    ck_assert_int_eq(validate("MATCH (n) RETURN m"), 1);
+    assert_error(0, 17, "Variable 'm' not defined");
+
+    ck_assert_int_eq(validate("MATCH (n), (m) WITH n RETURN m"), 1);
+    assert_error(0, 29, "Variable 'm' not defined");
+
+    ck_assert_int_eq(validate("RETURN [x IN [1] | x] AS l, x"), 1);
+    assert_error(0, 28, "Variable 'x' not defined");
+
+    ck_assert_int_eq(validate("MATCH (n) WHERE (n)-->(m) RETURN n"), 1);
+    assert_error(0, 23, "Variable 'm' not defined");
+}
+END_TEST
+
+
+START_TEST (report_ungrouped_variables_in_aggregates)
+{
+    ck_assert_int_eq(validate("MATCH (n) RETURN n.x + count(*) AS c"), 1);
+    assert_error(0, 17, "Variable 'n' is neither grouped nor aggregated");
+
+    ck_assert_int_eq(validate("MATCH (n) RETURN n.x, n.x + count(*) AS c"), 0);
+    ck_assert_int_eq(validate("MATCH (n) RETURN n AS m, n.y + COUNT(*) AS c"),
+            0);
+    ck_assert_int_eq(validate("MATCH (n) WITH *, n.x + count(*) AS c "
+                "RETURN c"), 0);
+}
+END_TEST
+
+
+START_TEST (report_ungrouped_variables_in_order_by)
+{
+    ck_assert_int_eq(validate("MATCH (n) RETURN n.x AS x, count(*) AS c "
+                "ORDER BY n.y"), 1);
+    assert_error(0, 50, "Variable 'n' is neither grouped nor aggregated");
+
+    ck_assert_int_eq(validate("MATCH (n) WITH n.x AS x, count(*) AS c "
+                "ORDER BY n.y DESC RETURN x"), 1);
+    assert_error(0, 48, "Variable 'n' is neither grouped nor aggregated");
+
+    ck_assert_int_eq(validate("MATCH (n) RETURN n.x, count(*) AS c "
+                "ORDER BY n.x, c"), 0);
+    ck_assert_int_eq(validate("MATCH (n) RETURN n, count(*) AS c "
+                "ORDER BY n.y, max(n.z)"), 0);
+    ck_assert_int_eq(validate("MATCH (n) RETURN n.x AS x "
+                "ORDER BY n.y"), 0);
+}
+END_TEST
+
+
+START_TEST (report_star_without_variables)
+{
+    ck_assert_int_eq(validate("RETURN *"), 1);
+    assert_error(0, 0,
+            "RETURN * is not allowed when there are no variables in scope");
+
+    ck_assert_int_eq(validate("UNWIND [1] AS x WITH x AS y WITH * RETURN y"),
+            0);
+}
+END_TEST
+
+
+START_TEST (report_duplicate_and_unaliased_columns)
+{
+    ck_assert_int_eq(validate("MATCH (n) RETURN n.x AS a, n.y AS a"), 1);
+    assert_error(0, 34,
+            "Multiple result columns with the same name 'a' are not "
+            "supported");
+
+    ck_assert_int_eq(validate("MATCH (n) WITH n, n.x RETURN n"), 1);
+    assert_error(0, 18, "Expression in WITH must be aliased (use AS)");
+}
+END_TEST
+
+
+START_TEST (report_delete_of_non_entities)
+{
+    ck_assert_int_eq(validate("MATCH (n) DELETE n.x"), 1);
+    assert_error(0, 17, "Expected a node, relationship or path to DELETE");
+
+    ck_assert_int_eq(validate("WITH 1 AS x DELETE x, [x]"), 2);
+    assert_error(0, 19, "Expected a node, relationship or path to DELETE");
+    assert_error(1, 22, "Expected a node, relationship or path to DELETE");
+
+    ck_assert_int_eq(validate("MATCH (n) OPTIONAL MATCH (n)-[r]-() "
+                "WITH n AS m, r DELETE r, m"), 0);
+}
+END_TEST
+
+
+START_TEST (order_errors_by_position)
+{
+    ck_assert_int_eq(validate("MATCH (n) WITH a AS x RETURN b, 1 AS x"), 2);
+    assert_error(0, 15, "Variable 'a' not defined");
+    assert_error(1, 29, "Variable 'b' not defined");
+    ck_assert_ptr_eq(cypher_validation_get_error(errors, 2), NULL);
+}
+END_TEST
+
+
+START_TEST (fail_to_validate_null)
+{
+    ck_assert_int_eq(cypher_ast_validate(NULL, &errors), -1);
+    ck_assert_int_eq(errno, EINVAL);
+}
+END_TEST
+
+
+TCase* validate_tcase(void)
+{
+    TCase *tc = tcase_create("validate");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, accept_valid_queries);
+    tcase_add_test(tc, report_undefined_variables);
+    tcase_add_test(tc, report_ungrouped_variables_in_aggregates);
+    tcase_add_test(tc, report_ungrouped_variables_in_order_by);
+    tcase_add_test(tc, report_star_without_variables);
+    tcase_add_test(tc, report_duplicate_and_unaliased_columns);
+    tcase_add_test(tc, report_delete_of_non_entities);
+    tcase_add_test(tc, order_errors_by_position);
+    tcase_add_test(tc, fail_to_validate_null);
+    return tc;
+}
@@ -0,0 +1,209 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "../../lib/src/cypher-parser.h"
+#include <check.h>
+#include <errno.h>
+#include <stdint.h>
+
+
+static const cypher_value_t *value;
+
+
+static void setup(void)
+{
+    value = NULL;
+}
+
+
+static void teardown(void)
+{
+    cypher_value_free(value);
+}
+
+
+static int parse(const char *s)
+{
+    return cypher_parse_value(s, strlen(s), &value);
+}
+
+
+START_TEST (parse_scalars)
+{
+    ck_assert_int_eq(parse(" 42 "), 0);
+    ck_assert_int_eq(value->type, CYPHER_VALUE_INTEGER);
+    ck_assert(value->u.integer == 42);
+    cypher_value_free(value);
+
+    ck_assert_int_eq(parse("-9223372036854775808"), 0);
+    ck_assert_int_eq(value->type, CYPHER_VALUE_INTEGER);
+    ck_assert(value->u.integer == INT64_MIN);
+    cypher_value_free(value);
+
+    ck_assert_int_eq(parse("0x1F"), 0);
+    ck_assert(value->u.integer == 31);
+    cypher_value_free(value);
+
+    ck_assert_int_eq(parse("- /* neg */ 1.5e3"), 0);
+    ck_assert_int_eq(value->type, CYPHER_VALUE_FLOAT);
+    ck_assert(value->u.real == -1500.0);
+    cypher_value_free(value);
+
+    ck_assert_int_eq(parse(".25"), 0);
+    ck_assert(value->u.real == 0.25);
+    cypher_value_free(value);
+
+    ck_assert_int_eq(parse("True"), 0);
+    ck_assert_int_eq(value->type, CYPHER_VALUE_BOOLEAN);
+    ck_assert(value->u.boolean);
+    cypher_value_free(value);
+
+    ck_assert_int_eq(parse("false"), 0);
+    ck_assert_int_eq(value->type, CYPHER_VALUE_BOOLEAN);
+    ck_assert(!value->u.boolean);
+    cypher_value_free(value);
+
+    ck_assert_int_eq(parse("NULL // nothing"), 0);
+    ck_assert_int_eq(value->type, CYPHER_VALUE_NULL);
+}
+END_TEST
+
+
+START_TEST (parse_strings)
+{
+    ck_assert_int_eq(parse("'hello world'"), 0);
+    ck_assert_int_eq(value->type, CYPHER_VALUE_STRING);
+    ck_assert_str_eq(value->u.string.s, "hello world");
+    ck_assert_int_eq(value->u.string.length, 11);
+    cypher_value_free(value);
+
+    ck_assert_int_eq(parse("\"it\\'s\\t\\\"quoted\\\" \\q\""), 0);
+    ck_assert_int_eq(value->type, CYPHER_VALUE_STRING);
+    ck_assert_str_eq(value->u.string.s, "it's\t\"quoted\" \\q");
+    cypher_value_free(value);
+
+    ck_assert_int_eq(parse("'\\''"), 0);
+    ck_assert_str_eq(value->u.string.s, "'");
+}
+END_TEST
+
+
+START_TEST (parse_collections)
+{
+    ck_assert_int_eq(parse("[1, 'two', [3.0, []], {}]"), 0);
+    ck_assert_int_eq(value->type, CYPHER_VALUE_LIST);
+    ck_assert_int_eq(value->u.list.n, 4);
+
+    const cypher_value_t *elements = value->u.list.elements;
+    ck_assert_int_eq(elements[0].type, CYPHER_VALUE_INTEGER);
+    ck_assert(elements[0].u.integer == 1);
+    ck_assert_int_eq(elements[1].type, CYPHER_VALUE_STRING);
+    ck_assert_str_eq(elements[1].u.string.s, "two");
+    ck_assert_int_eq(elements[2].type, CYPHER_VALUE_LIST);
+    ck_assert_int_eq(elements[2].u.list.n, 2);
+    ck_assert_int_eq(elements[2].u.list.elements[0].type, CYPHER_VALUE_FLOAT);
+    ck_assert_int_eq(elements[2].u.list.elements[1].type, CYPHER_VALUE_LIST);
+    ck_assert_int_eq(elements[2].u.list.elements[1].u.list.n, 0);
+    ck_assert_int_eq(elements[3].type, CYPHER_VALUE_MAP);
+    ck_assert_int_eq(elements[3].u.map.n, 0);
+}
+END_TEST
+
+
+START_TEST (parse_maps)
+{
+    ck_assert_int_eq(parse(
+            "{zeta: 1, alpha: [true], `with space`: 'x', zeta: 2}"), 0);
+    ck_assert_int_eq(value->type, CYPHER_VALUE_MAP);
+    ck_assert_int_eq(value->u.map.n, 3);
+
+    const struct cypher_value_map_entry *entries = value->u.map.entries;
+    ck_assert_str_eq(entries[0].key, "alpha");
+    ck_assert_str_eq(entries[1].key, "with space");
+    ck_assert_str_eq(entries[2].key, "zeta");
+
+    const cypher_value_t *v = cypher_value_map_get(value, "zeta", 4);
+    ck_assert_ptr_ne(v, NULL);
+    ck_assert_int_eq(v->type, CYPHER_VALUE_INTEGER);
+    ck_assert(v->u.integer == 2);
+
+    v = cypher_value_map_get(value, "alpha", 5);
+    ck_assert_ptr_ne(v, NULL);
+    ck_assert_int_eq(v->type, CYPHER_VALUE_LIST);
+    ck_assert_int_eq(v->u.list.n, 1);
+
+    ck_assert_ptr_eq(cypher_value_map_get(value, "alph", 4), NULL);
+    ck_assert_ptr_eq(cypher_value_map_get(value, "beta", 4), NULL);
+}
+END_TEST
+
+
+START_TEST (parse_large_collection)
+{
+    char buf[65536];
+    size_t n = 0;
+    buf[n++] = '[';
+    for (unsigned int i = 0; i < 5000; ++i)
+    {
+        n += snprintf(buf + n, sizeof(buf) - n, "%s{k%u: 'v'}",
+                (i > 0)? "," : "", i);
+    }
+    buf[n++] = ']';
+    buf[n] = '\0';
+
+    ck_assert_int_eq(parse(buf), 0);
+    ck_assert_int_eq(value->type, CYPHER_VALUE_LIST);
+    ck_assert_int_eq(value->u.list.n, 5000);
+    const cypher_value_t *last = &(value->u.list.elements[4999]);
+    ck_assert_int_eq(last->type, CYPHER_VALUE_MAP);
+    ck_assert_str_eq(last->u.map.entries[0].key, "k4999");
+}
+END_TEST
+
+
+START_TEST (fail_on_invalid_values)
+{
+    const char *invalid[] =
+        { "", "1.", "12abc", "08", "[1, 2,]", "[1 2]", "{a 1}", "{1: 2}",
+          "'unterminated", "/* unterminated", "nulls", "n.x", "1; 2",
+          "[1", "-", "$param" };
+    for (unsigned int i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i)
+    {
+        errno = 0;
+        ck_assert_int_eq(parse(invalid[i]), -1);
+        ck_assert_int_eq(errno, EINVAL);
+    }
+
+    errno = 0;
+    ck_assert_int_eq(parse("9223372036854775808"), -1);
+    ck_assert_int_eq(errno, ERANGE);
+}
+END_TEST
+
+
+TCase* value_tcase(void)
+{
+    TCase *tc = tcase_create("value");
+    tcase_add_checked_fixture(tc, setup, teardown);
+    tcase_add_test(tc, parse_scalars);
+    tcase_add_test(tc, parse_strings);
+    tcase_add_test(tc, parse_collections);
+    tcase_add_test(tc, parse_maps);
+    tcase_add_test(tc, parse_large_collection);
+    tcase_add_test(tc, fail_on_invalid_values);
+    return tc;
+}
@@ -35,6 +35,9 @@ const char *shortopts = "1ahv";
 #define OUTPUT_WIDTH_OPT 1007
 #define STREAM_OPT 1008
 #define VERSION_OPT 1009
+#define SLOWLOG_OPT 1010
+
+#define SLOWLOG_CAPACITY 100
 
 static struct option longopts[] =
     { { "ast", no_argument, NULL, 'a' },
@@ -47,6 +50,7 @@ static struct option longopts[] =
       { "help", no_argument, NULL, 'h' },
       { "only-statements", no_argument, NULL, ONLY_STATEMENTS_OPT },
       { "output-width", required_argument, NULL, OUTPUT_WIDTH_OPT },
+      { "slowlog", required_argument, NULL, SLOWLOG_OPT },
       { "stream", no_argument, NULL, STREAM_OPT },
       { "version", no_argument, NULL, VERSION_OPT },
       { NULL, 0, NULL, 0 } };
@@ -63,6 +67,8 @@ static void usage(FILE *s, const char *prog_name)
 " --help, -h          Output this usage information.\n"
 " --only-statements   Only parse statements (and not client commands).\n"
 " --output-width <n>  Attempt to limit output to the specified width.\n"
+" --slowlog <ms>      Report statements that take at least the specified\n"
+"                     number of milliseconds to parse.\n"
 " --stream            Output each statement as it is read, rather than parsing\n"
 "                     the entire input first (note: will result in inconsistent\n"
 "                     formatting of AST dumps).\n"
@@ -82,6 +88,7 @@ struct lint_config
     bool colorize_output;
     bool colorize_errors;
     bool stream;
+    cypher_slowlog_t *slowlog;
 };
 
 
@@ -197,6 +204,30 @@ int main(int argc, char *argv[])
         case STREAM_OPT:
             config.stream = true;
             break;
+        case SLOWLOG_OPT:
+            {
+                char *end;
+                errno = 0;
+                double ms = strtod(optarg, &end);
+                if (end == optarg || *end != '\0' || errno != 0 ||
+                        !(ms >= 0) || ms >= (double)UINT64_MAX / 1000000)
+                {
+                    fprintf(stderr, "%s: invalid --slowlog threshold: %s\n",
+                            prog_name, optarg);
+                    goto cleanup;
+                }
+                // a zero threshold would disable the log, so use 1ns instead
+                uint64_t threshold = (uint64_t)(ms * 1000000);
+                cypher_slowlog_free(config.slowlog);
+                config.slowlog = cypher_slowlog_new(SLOWLOG_CAPACITY,
+                        (threshold > 0)? threshold : 1, 0);
+                if (config.slowlog == NULL)
+                {
+                    perror("cypher_slowlog_new");
+                    goto cleanup;
+                }
+            }
+            break;
         case VERSION_OPT:
             fprintf(stdout, "cypher-lint: %s\n", PACKAGE_VERSION);
             fprintf(stdout, "libcypher-parser: %s\n",
@@ -211,10 +242,11 @@ int main(int argc, char *argv[])
     argc -= optind;
     argv += optind;
 
-    // Always stream if ast dumping is disabled
+    // Always stream, and only validate, if ast dumping is disabled
     if (!config.dump_ast)
     {
         config.stream = true;
+        config.flags |= CYPHER_PARSE_VALIDATE_ONLY;
     }
 
     if (argc > 0)
@@ -261,6 +293,13 @@ int main(int argc, char *argv[])
     result = EXIT_SUCCESS;
 
 cleanup:
+    if (config.slowlog != NULL &&
+            cypher_slowlog_fprint(config.slowlog, stderr))
+    {
+        perror("cypher_slowlog_fprint");
+        result = EXIT_FAILURE;
+    }
+    cypher_slowlog_free(config.slowlog);
     return result;
 }
 
@@ -285,6 +324,8 @@ int process(FILE *stream, const char *filename, struct lint_config *config)
     const struct cypher_parser_colorization *output_colorization =
         config->colorize_output? cypher_parser_ansi_colorization : NULL;
 
+    cypher_parser_config_set_slowlog(cp_config, config->slowlog);
+
     int err = (config->stream)?
         process_streamed(stream, filename, config, cp_config,
               error_colorization, output_colorization) :
@@ -0,0 +1,413 @@
+/* vi:set ts=4 sw=4 expandtab:
+ *
+ * Copyright 2016, Chris Leishman (http://github.com/cleishm)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "../../config.h"
+#include "cypher-parser.h"
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <libgen.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+const char *shortopts = "hn:t";
+
+#define VERSION_OPT 1001
+
+static struct option longopts[] =
+    { { "help", no_argument, NULL, 'h' },
+      { "repeat", required_argument, NULL, 'n' },
+      { "timed", no_argument, NULL, 't' },
+      { "version", no_argument, NULL, VERSION_OPT },
+      { NULL, 0, NULL, 0 } };
+
+static void usage(FILE *s, const char *prog_name)
+{
+    fprintf(s,
+"usage: %s [OPTIONS] capture-file\n"
+"options:\n"
+" --help, -h          Output this usage information.\n"
+" --repeat <n>, -n    Replay the capture the specified number of times.\n"
+" --timed, -t         Replay inputs at their recorded inter-arrival times,\n"
+"                     rather than as fast as possible.\n"
+" --version           Output the version of cypher-replay and\n"
+"                     libcypher-parser\n"
+"\n"
+"Each input in the capture is parsed again, using the same parser and\n"
+"flags as when it was recorded, and the throughput and latency\n"
+"percentiles are reported.\n"
+"\n",
+        prog_name);
+}
+
+
+struct replay_config
+{
+    unsigned int repeat;
+    bool timed;
+};
+
+
+struct input
+{
+    uint64_t time;
+    uint32_t kind;
+    uint64_t flags;
+    const char *s;
+    size_t length;
+};
+
+
+static int load(const char *data, size_t size, struct input **inputs,
+        size_t *ninputs);
+static int replay(const struct input *inputs, size_t ninputs,
+        const struct replay_config *config, uint64_t *latencies);
+static int quick_callback(void *data,
+        const cypher_quick_parse_segment_t *segment);
+static void report(FILE *stream, const struct input *inputs, size_t ninputs,
+        const struct replay_config *config, uint64_t elapsed,
+        uint64_t *latencies);
+static uint64_t percentile(const uint64_t *sorted, size_t n, double p);
+static int compare_latencies(const void *a, const void *b);
+static uint64_t now(void);
+static void sleep_until(uint64_t time);
+
+
+int main(int argc, char *argv[])
+{
+    char *prog_name = basename(argv[0]);
+    if (prog_name == NULL)
+    {
+        perror("unexpected error");
+        exit(EXIT_FAILURE);
+    }
+
+    struct replay_config config = { .repeat = 1, .timed = false };
+
+    int c;
+    while ((c = getopt_long(argc, argv, shortopts, longopts, NULL)) >= 0)
+    {
+        switch (c)
+        {
+        case 'h':
+            usage(stdout, prog_name);
+            return EXIT_SUCCESS;
+        case 'n':
+            {
+                char *end;
+                errno = 0;
+                // strtoul accepts, and negates, a leading minus sign
+                unsigned long n = strtoul(optarg, &end, 10);
+                if (end == optarg || *end != '\0' || errno != 0 ||
+                        strchr(optarg, '-') != NULL || n == 0 ||
+                        n > UINT_MAX)
+                {
+                    fprintf(stderr, "%s: invalid --repeat count: %s\n",
+                            prog_name, optarg);
+                    return EXIT_FAILURE;
+                }
+                config.repeat = (unsigned int)n;
+            }
+            break;
+        case 't':
+            config.timed = true;
+            break;
+        case VERSION_OPT:
+            fprintf(stdout, "cypher-replay: %s\n", PACKAGE_VERSION);
+            fprintf(stdout, "libcypher-parser: %s\n",
+                    libcypher_parser_version());
+            return EXIT_SUCCESS;
+        default:
+            usage(stderr, prog_name);
+            return EXIT_FAILURE;
+        }
+    }
+    argc -= optind;
+    argv += optind;
+
+    if (argc != 1)
+    {
+        usage(stderr, prog_name);
+        return EXIT_FAILURE;
+    }
+
+    int result = EXIT_FAILURE;
+    void *data = MAP_FAILED;
+    size_t size = 0;
+    struct input *inputs = NULL;
+    size_t ninputs = 0;
+    uint64_t *latencies = NULL;
+
+    int fd = open(argv[0], O_RDONLY);
+    if (fd < 0)
+    {
+        fprintf(stderr, "%s: %s: %s\n", prog_name, argv[0], strerror(errno));
+        goto cleanup;
+    }
+    struct stat st;
+    if (fstat(fd, &st))
+    {
+        fprintf(stderr, "%s: %s: %s\n", prog_name, argv[0], strerror(errno));
+        goto cleanup;
+    }
+    size = st.st_size;
+    if (size < CYPHER_CAPTURE_MAGIC_LENGTH)
+    {
+        fprintf(stderr, "%s: %s: not a capture file\n", prog_name, argv[0]);
+        goto cleanup;
+    }
+    data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED)
+    {
+        fprintf(stderr, "%s: %s: %s\n", prog_name, argv[0], strerror(errno));
+        goto cleanup;
+    }
+
+    if (load(data, size, &inputs, &ninputs))
+    {
+        fprintf(stderr, "%s: %s: not a capture file\n", prog_name, argv[0]);
+        goto cleanup;
+    }
+    if (ninputs == 0)
+    {
+        fprintf(stderr, "%s: %s: capture is empty\n", prog_name, argv[0]);
+        goto cleanup;
+    }
+
+    if (config.repeat > SIZE_MAX / ninputs)
+    {
+        fprintf(stderr, "%s: --repeat count is too large\n", prog_name);
+        goto cleanup;
+    }
+    latencies = calloc(ninputs * config.repeat, sizeof(uint64_t));
+    if (latencies == NULL)
+    {
+        perror("calloc");
+        goto cleanup;
+    }
+
+    uint64_t start = now();
+    if (replay(inputs, ninputs, &config, latencies))
+    {
+        perror("replay");
+        goto cleanup;
+    }
+    report(stdout, inputs, ninputs, &config, now() - start, latencies);
+
+    result = EXIT_SUCCESS;
+
+cleanup:
+    free(latencies);
+    free(inputs);
+    if (data != MAP_FAILED)
+    {
+        munmap(data, size);
+    }
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+    return result;
+}
+
+
+/*
+ * Index the records of a mapped capture file. A truncated final record,
+ * left by a capture that could not be completely written, is ignored.
+ */
+int load(const char *data, size_t size, struct input **inputs,
+        size_t *ninputs)
+{
+    if (memcmp(data, CYPHER_CAPTURE_MAGIC, CYPHER_CAPTURE_MAGIC_LENGTH) != 0)
+    {
+        return -1;
+    }
+
+    size_t capacity = 0;
+    size_t n = 0;
+    struct input *in = NULL;
+
+    // record times restart from zero in each session appended to a capture,
+    // so offset them to follow on from the end of the previous session
+    uint64_t base = 0;
+    uint64_t last = 0;
+
+    size_t offset = CYPHER_CAPTURE_MAGIC_LENGTH;
+    while (size - offset >= sizeof(struct cypher_capture_record))
+    {
+        struct cypher_capture_record record;
+        memcpy(&record, data + offset, sizeof(record));
+        offset += sizeof(record);
+        if (size - offset < record.length)
+        {
+            break;
+        }
+
+        if (n >= capacity)
+        {
+            capacity = (capacity > 0)? capacity * 2 : 1024;
+            struct input *resized = realloc(in,
+                    capacity * sizeof(struct input));
+            if (resized == NULL)
+            {
+                free(in);
+                return -1;
+            }
+            in = resized;
+        }
+        if (record.time < last)
+        {
+            base = in[n-1].time;
+        }
+        last = record.time;
+        in[n].time = base + record.time;
+        in[n].kind = record.kind;
+        in[n].flags = record.flags;
+        in[n].s = data + offset;
+        in[n].length = record.length;
+        ++n;
+
+        offset += record.length;
+    }
+
+    *inputs = in;
+    *ninputs = n;
+    return 0;
+}
+
+
+int replay(const struct input *inputs, size_t ninputs,
+        const struct replay_config *config, uint64_t *latencies)
+{
+    for (unsigned int r = 0; r < config->repeat; ++r)
+    {
+        uint64_t start = now();
+        for (size_t i = 0; i < ninputs; ++i)
+        {
+            const struct input *input = &(inputs[i]);
+            if (config->timed)
+            {
+                sleep_until(start + (input->time - inputs[0].time));
+            }
+
+            uint64_t parse_start = now();
+            if (input->kind == CYPHER_CAPTURE_QUICK_PARSE)
+            {
+                if (cypher_quick_uparse(input->s, input->length,
+                            quick_callback, NULL, input->flags) < 0)
+                {
+                    return -1;
+                }
+            }
+            else
+            {
+                cypher_parse_result_t *result = cypher_uparse(input->s,
+                        input->length, NULL, NULL, input->flags);
+                if (result == NULL)
+                {
+                    return -1;
+                }
+                cypher_parse_result_free(result);
+            }
+            latencies[r * ninputs + i] = now() - parse_start;
+        }
+    }
+    return 0;
+}
+
+
+int quick_callback(void *data, const cypher_quick_parse_segment_t *segment)
+{
+    return 0;
+}
+
+
+void report(FILE *stream, const struct input *inputs, size_t ninputs,
+        const struct replay_config *config, uint64_t elapsed,
+        uint64_t *latencies)
+{
+    size_t n = ninputs * config->repeat;
+    uint64_t bytes = 0;
+    for (size_t i = 0; i < ninputs; ++i)
+    {
+        bytes += inputs[i].length;
+    }
+    bytes *= config->repeat;
+
+    qsort(latencies, n, sizeof(uint64_t), compare_latencies);
+
+    double seconds = (double)elapsed / 1e9;
+    fprintf(stream, "inputs:     %zu\n", n);
+    fprintf(stream, "bytes:      %" PRIu64 "\n", bytes);
+    fprintf(stream, "elapsed:    %.3fs\n", seconds);
+    fprintf(stream, "throughput: %.1f inputs/s, %.3f MiB/s\n",
+            (double)n / seconds, (double)bytes / (1024 * 1024) / seconds);
+    fprintf(stream, "latency:    p50 %.1fus, p90 %.1fus, p99 %.1fus, "
+            "p99.9 %.1fus, max %.1fus\n",
+            (double)percentile(latencies, n, 0.5) / 1000,
+            (double)percentile(latencies, n, 0.9) / 1000,
+            (double)percentile(latencies, n, 0.99) / 1000,
+            (double)percentile(latencies, n, 0.999) / 1000,
+            (double)latencies[n - 1] / 1000);
+}
+
+
+// the nearest-rank percentile of a sorted array
+uint64_t percentile(const uint64_t *sorted, size_t n, double p)
+{
+    assert(n > 0);
+    size_t rank = (size_t)(p * n + 0.999999);
+    return sorted[(rank > 0)? rank - 1 : 0];
+}
+
+
+int compare_latencies(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+
+uint64_t now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+
+void sleep_until(uint64_t time)
+{
+    uint64_t t = now();
+    if (t >= time)
+    {
+        return;
+    }
+    uint64_t delay = time - t;
+    struct timespec ts =
+        { .tv_sec = delay / 1000000000, .tv_nsec = delay % 1000000000 };
+    while (nanosleep(&ts, &ts) && errno == EINTR)
+        ;
+}